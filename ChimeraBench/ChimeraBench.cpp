@@ -0,0 +1,896 @@
+//*******************************************************************************************************************
+//*																													*
+//*   File:       ChimeraBench.cpp																					*
+//*   Suite:      xymorg Integration - Chimera CODEC																*
+//*   Version:    1.1.1	(Build: 03)																					*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2026 Ian J. Tree.																					*
+//*******************************************************************************************************************
+//*	ChimeraBench																									*
+//*																													*
+//*	This application measures the compression ratio, the compression and decompression throughput and the peak		*
+//* memory of the Chimera CODEC for each of the compression levels (1 - 9) over a built-in synthetic corpus.		*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		ChimeraBench [-J] [-L:<Level>] [-S:<Size>] [<File> ...]														*
+//*																													*
+//*     where:-																										*
+//*																													*
+//*		-J					-	Writes the results as a JSON document to stdout.									*
+//*		-L:<Level>			-	Measures a single compression level, all levels are measured by default.			*
+//*		-S:<Size>			-	Is the size (KB) of each class of the synthetic corpus, the default is 256.			*
+//*							A K, M or G suffix gives the size in KB, MB or GB.										*
+//*		<File>				-	Is the path to a file to be measured, the synthetic corpus is used if no files		*
+//*							are given.																				*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.		The synthetic corpus holds text, log, binary trace, highly repetitive and random content, each class	*
+//*			is generated from a fixed seed and is identical for every run.											*
+//*	2.		Every run is decompressed and compared with the original content, the exit code is non-zero if any		*
+//*			run fails.																								*
+//*	3.		The contribution of each encoding (symbols, repeat strings, dictionary and runs) is taken from the		*
+//*			statistics (CStats) of the compression.																	*
+//*	4.		Peak memory is the growth in the resident set during a run, it is only available on Linux.				*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		19/10/2026	-	Initial Release																		*
+//*	1.1.0 -		19/10/2026	-	Synthetic corpus, peak memory, encoding contributions and JSON output				*
+//*	1.1.1 -		19/10/2026	-	Corpus sizes are validated and accept K, M and G suffixes							*
+//*																													*
+//*******************************************************************************************************************/
+
+#include	"ChimeraBench.h"
+
+//
+//  Main entry point for the ChimeraBench application
+//
+
+int main(int argc, char* argv[])
+{
+	static const char*	ClassNames[] = { "text", "log", "trace", "repetitive", "random" };
+	static xymorg::BYTE* (*Builders[])(PRNG&, size_t) = { buildText, buildLog, buildTrace, buildRepetitive, buildRandom };
+	xymorg::BYTE*	pContent = nullptr;											//  Content to be measured
+	size_t			Size = 0;													//  Size of the content
+	size_t			CorpusSize = DefaultCorpusSize * 1024;						//  Size of each corpus class
+	int				Level = 0;													//  Level to measure (0 = all)
+	int				Files = 0;													//  Number of files to measure
+	bool			JSON = false;												//  JSON output
+	bool			First = true;												//  First content reported
+	bool			AllVerified = true;											//  All runs were verified
+
+	//
+	//  Process the command line switches
+	//
+
+	for (int AX = 1; AX < argc; AX++) {
+		if (argv[AX][0] != '-') {
+			Files++;
+			continue;
+		}
+		if ((argv[AX][1] == 'J' || argv[AX][1] == 'j') && argv[AX][2] == '\0') JSON = true;
+		else if ((argv[AX][1] == 'L' || argv[AX][1] == 'l') && argv[AX][2] == ':') {
+			Level = atoi(argv[AX] + 3);
+			if (Level < xymorg::Chimera::MinLevel || Level > xymorg::Chimera::MaxLevel) {
+				std::cerr << "ERROR: The level: '" << (argv[AX] + 3) << "' is not valid, levels are " << xymorg::Chimera::MinLevel << " - " << xymorg::Chimera::MaxLevel << "." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		else if ((argv[AX][1] == 'S' || argv[AX][1] == 's') && argv[AX][2] == ':') {
+			CorpusSize = parseSize(argv[AX] + 3);
+			if (CorpusSize == 0) {
+				std::cerr << "ERROR: The corpus size: '" << (argv[AX] + 3) << "' is not valid." << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		else {
+			std::cerr << "ERROR: Unknown switch: '" << argv[AX] << "'." << std::endl;
+			std::cerr << "USAGE: " << APP_NAME << " [-J] [-L:<Level>] [-S:<Size>] [<File> ...]" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	//  Show that program is starting (stdout is reserved for the JSON document)
+	if (JSON) {
+		std::cout << "{" << std::endl;
+		std::cout << "  \"tool\": \"" << APP_NAME << "\"," << std::endl;
+		std::cout << "  \"version\": \"" << APP_VERSION << "\"," << std::endl;
+		std::cout << "  \"contents\": [";
+	}
+	else std::cout << APP_TITLE << " (" << APP_NAME << ") Version: " << APP_VERSION << " is starting." << std::endl;
+
+	//  With no files measure the synthetic corpus
+	if (Files == 0) {
+		for (size_t CX = 0; CX < sizeof(ClassNames) / sizeof(ClassNames[0]); CX++) {
+			PRNG		RGen(CorpusSeed + uint32_t(CX));							//  Pseudo Random Number Generator
+
+			pContent = Builders[CX](RGen, CorpusSize);
+			if (pContent == nullptr) {
+				std::cerr << "ERROR: The " << ClassNames[CX] << " corpus could not be built, storage is exhausted." << std::endl;
+				AllVerified = false;
+				continue;
+			}
+			if (!benchContent(ClassNames[CX], pContent, CorpusSize, Level, JSON, First)) AllVerified = false;
+			First = false;
+			free(pContent);
+		}
+	}
+
+	//  Measure each of the files
+	for (int AX = 1; AX < argc; AX++) {
+		if (argv[AX][0] == '-') continue;
+		pContent = loadFile(argv[AX], Size);
+		if (pContent == nullptr) {
+			std::cerr << "ERROR: The file: '" << argv[AX] << "' could not be loaded." << std::endl;
+			AllVerified = false;
+			continue;
+		}
+		if (!benchContent(argv[AX], pContent, Size, Level, JSON, First)) AllVerified = false;
+		First = false;
+		free(pContent);
+	}
+
+	//  Report the outcome
+	if (JSON) {
+		std::cout << std::endl << "  ]," << std::endl;
+		std::cout << "  \"verified\": " << (AllVerified ? "true" : "false") << std::endl;
+		std::cout << "}" << std::endl;
+	}
+	if (!AllVerified) {
+		std::cerr << "ERROR: One or more runs failed, see above." << std::endl;
+		return EXIT_FAILURE;
+	}
+	if (!JSON) std::cout << APP_NAME << " completed normally." << std::endl;
+	return EXIT_SUCCESS;
+}
+
+//  buildText
+//
+//  Builds the text class of the corpus, lines of text composed of words drawn from a fixed vocabulary.
+//
+//  PARAMETERS:
+//
+//		PRNG&			-		Reference to the Pseudo Random Number Generator
+//		size_t			-		Size of the content to build
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if it could not be allocated
+//
+//  NOTES:
+//
+//	1.		The words are drawn with a skewed frequency.
+//
+
+xymorg::BYTE*	buildText(PRNG& RGen, size_t Size) {
+	static const char*	Vocabulary[] = { "the", "of", "and", "a", "to", "in", "is", "was", "that", "for",
+										 "it", "with", "as", "his", "on", "be", "at", "by", "had", "are",
+										 "compression", "stream", "block", "window", "symbol", "table", "string", "repeat",
+										 "contestant", "door", "car", "goat", "show", "host", "switch", "stick",
+										 "probability", "selection", "original", "remaining", "opened", "closed" };
+	const size_t	Words = sizeof(Vocabulary) / sizeof(Vocabulary[0]);			//  Number of words in the vocabulary
+	xymorg::BYTE*	pContent = (xymorg::BYTE*)malloc(Size);						//  Content
+	size_t			Pos = 0;													//  Position in the content
+	size_t			LineLen = 0;												//  Length of the current line
+	const char*		pWord = nullptr;											//  Selected word
+
+	if (pContent == nullptr) return nullptr;
+
+	while (Pos < Size) {
+
+		//  Skew the selection towards the start of the vocabulary
+		pWord = Vocabulary[(RGen() % Words) * (RGen() % Words) / Words];
+
+		//  End the line or separate the words
+		if (LineLen > 72) {
+			pContent[Pos++] = '\n';
+			LineLen = 0;
+		}
+		else if (LineLen > 0) {
+			pContent[Pos++] = ' ';
+			LineLen++;
+		}
+
+		//  Add the word
+		for (size_t CX = 0; pWord[CX] != '\0' && Pos < Size; CX++) {
+			pContent[Pos++] = xymorg::BYTE(pWord[CX]);
+			LineLen++;
+		}
+	}
+
+	return pContent;
+}
+
+//  buildLog
+//
+//  Builds the log class of the corpus, timestamped request log lines.
+//
+//  PARAMETERS:
+//
+//		PRNG&			-		Reference to the Pseudo Random Number Generator
+//		size_t			-		Size of the content to build
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if it could not be allocated
+//
+//  NOTES:
+//
+
+xymorg::BYTE*	buildLog(PRNG& RGen, size_t Size) {
+	static const char*	Severities[] = { "INFO ", "INFO ", "INFO ", "INFO ", "INFO ", "DEBUG", "DEBUG", "WARN ", "ERROR" };
+	static const char*	Methods[] = { "GET", "GET", "GET", "GET", "POST", "PUT", "DELETE" };
+	static const char*	Paths[] = { "/api/v1/items", "/api/v1/users", "/api/v1/orders", "/static/app.js", "/health" };
+	static const unsigned	Statuses[] = { 200, 200, 200, 200, 200, 201, 204, 304, 404, 500 };
+	xymorg::BYTE*	pContent = (xymorg::BYTE*)malloc(Size);						//  Content
+	size_t			Pos = 0;													//  Position in the content
+	uint64_t		Millis = 8 * 3600 * 1000;									//  Time of day (ms)
+	unsigned		Request = 100000;											//  Request number
+	char			Line[256] = {};												//  Log line
+	int				LineLen = 0;												//  Length of the log line
+
+	if (pContent == nullptr) return nullptr;
+
+	while (Pos < Size) {
+		Millis += RGen() % 250;
+		Request += 1 + (RGen() % 3);
+		LineLen = snprintf(Line, sizeof(Line), "2026-10-19 %02u:%02u:%02u.%03u %s [worker-%02u] request %u %s %s/%u status=%u bytes=%u time=%ums\n",
+			unsigned((Millis / 3600000) % 24), unsigned((Millis / 60000) % 60), unsigned((Millis / 1000) % 60), unsigned(Millis % 1000),
+			Severities[RGen() % (sizeof(Severities) / sizeof(Severities[0]))], unsigned(1 + (RGen() % 8)), Request,
+			Methods[RGen() % (sizeof(Methods) / sizeof(Methods[0]))], Paths[RGen() % (sizeof(Paths) / sizeof(Paths[0]))], unsigned(RGen() % 10000),
+			Statuses[RGen() % (sizeof(Statuses) / sizeof(Statuses[0]))], unsigned(RGen() % 65536), unsigned(RGen() % 500));
+		if (LineLen <= 0) break;
+
+		//  Add the line
+		for (int CX = 0; CX < LineLen && Pos < Size; CX++) pContent[Pos++] = xymorg::BYTE(Line[CX]);
+	}
+
+	//  Pad a short result
+	if (Pos < Size) memset(pContent + Pos, ' ', Size - Pos);
+
+	return pContent;
+}
+
+//  buildTrace
+//
+//  Builds the binary trace class of the corpus, fixed length little endian event records.
+//
+//  PARAMETERS:
+//
+//		PRNG&			-		Reference to the Pseudo Random Number Generator
+//		size_t			-		Size of the content to build
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if it could not be allocated
+//
+//  NOTES:
+//
+//	1.		Each record holds a timestamp (8), an event id (2), a cpu number (2) and a payload (4).
+//
+
+xymorg::BYTE*	buildTrace(PRNG& RGen, size_t Size) {
+	static const uint16_t	Events[] = { 0x0101, 0x0102, 0x0103, 0x0201, 0x0202, 0x0301, 0x0401, 0x0402 };
+	const size_t	EventCount = sizeof(Events) / sizeof(Events[0]);			//  Number of event types
+	xymorg::BYTE*	pContent = (xymorg::BYTE*)malloc(Size);						//  Content
+	xymorg::BYTE	Record[16] = {};											//  Trace record
+	size_t			Pos = 0;													//  Position in the content
+	uint64_t		Timestamp = 1760000000000000000ULL;							//  Event timestamp (ns)
+	uint32_t		Payload = 0;												//  Event payload
+	uint16_t		Event = 0;													//  Event id
+
+	if (pContent == nullptr) return nullptr;
+
+	while (Pos < Size) {
+		Timestamp += 1 + (RGen() % 2000);
+		Event = Events[(RGen() % EventCount) * (RGen() % EventCount) / EventCount];
+
+		//  Payloads are small values, addresses or random
+		switch (RGen() % 4) {
+		case 0:
+		case 1:
+			Payload = RGen() % 256;
+			break;
+		case 2:
+			Payload = 0x7F000000 + ((RGen() % 4096) * 16);
+			break;
+		default:
+			Payload = uint32_t(RGen());
+			break;
+		}
+
+		//  Build the record
+		for (size_t BX = 0; BX < 8; BX++) Record[BX] = xymorg::BYTE(Timestamp >> (8 * BX));
+		Record[8] = xymorg::BYTE(Event);
+		Record[9] = xymorg::BYTE(Event >> 8);
+		Record[10] = xymorg::BYTE(RGen() % 4);
+		Record[11] = 0;
+		for (size_t BX = 0; BX < 4; BX++) Record[12 + BX] = xymorg::BYTE(Payload >> (8 * BX));
+
+		//  Add the record
+		for (size_t BX = 0; BX < sizeof(Record) && Pos < Size; BX++) pContent[Pos++] = Record[BX];
+	}
+
+	return pContent;
+}
+
+//  buildRepetitive
+//
+//  Builds the highly repetitive class of the corpus, runs, repeated patterns and copies of earlier content.
+//
+//  PARAMETERS:
+//
+//		PRNG&			-		Reference to the Pseudo Random Number Generator
+//		size_t			-		Size of the content to build
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if it could not be allocated
+//
+//  NOTES:
+//
+
+xymorg::BYTE*	buildRepetitive(PRNG& RGen, size_t Size) {
+	xymorg::BYTE*	pContent = (xymorg::BYTE*)malloc(Size);						//  Content
+	xymorg::BYTE	Pattern[64] = {};											//  Repeated pattern
+	xymorg::BYTE	Unit[2] = {};												//  Repeated unit
+	size_t			Pos = 0;													//  Position in the content
+	size_t			Len = 0;													//  Length of a segment
+	size_t			Source = 0;													//  Source of a copy
+
+	if (pContent == nullptr) return nullptr;
+	for (size_t PX = 0; PX < sizeof(Pattern); PX++) Pattern[PX] = xymorg::BYTE(RGen());
+
+	while (Pos < Size) {
+		switch (RGen() % 4) {
+
+			//  Run of a single byte (mostly zero)
+		case 0:
+			Len = 16 + (RGen() % 2048);
+			Unit[0] = (RGen() % 4 == 0) ? xymorg::BYTE(RGen()) : 0;
+			for (size_t BX = 0; BX < Len && Pos < Size; BX++) pContent[Pos++] = Unit[0];
+			break;
+
+			//  Repeats of the pattern
+		case 1:
+			Len = sizeof(Pattern) * (2 + (RGen() % 31));
+			for (size_t BX = 0; BX < Len && Pos < Size; BX++) pContent[Pos++] = Pattern[BX % sizeof(Pattern)];
+			break;
+
+			//  Run of a two byte unit
+		case 2:
+			Len = 64 + (RGen() % 960);
+			Unit[0] = xymorg::BYTE(RGen());
+			Unit[1] = xymorg::BYTE(RGen());
+			for (size_t BX = 0; BX < Len && Pos < Size; BX++) pContent[Pos++] = Unit[BX % 2];
+			break;
+
+			//  Copy of earlier content
+		default:
+			if (Pos < 1024) break;
+			Len = 32 + (RGen() % 480);
+			Source = Pos - 1 - (RGen() % ((Pos < 32768) ? Pos : 32768));
+			for (size_t BX = 0; BX < Len && Pos < Size; BX++) pContent[Pos++] = pContent[Source + BX];
+			break;
+		}
+	}
+
+	return pContent;
+}
+
+//  buildRandom
+//
+//  Builds the random class of the corpus.
+//
+//  PARAMETERS:
+//
+//		PRNG&			-		Reference to the Pseudo Random Number Generator
+//		size_t			-		Size of the content to build
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if it could not be allocated
+//
+//  NOTES:
+//
+
+xymorg::BYTE*	buildRandom(PRNG& RGen, size_t Size) {
+	xymorg::BYTE*	pContent = (xymorg::BYTE*)malloc(Size);						//  Content
+
+	if (pContent == nullptr) return nullptr;
+	for (size_t BX = 0; BX < Size; BX++) pContent[BX] = xymorg::BYTE(RGen());
+
+	return pContent;
+}
+
+//  parseSize
+//
+//  Parses a corpus size, the size is in KB unless it has a K, M or G suffix.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the size string
+//
+//  RETURNS:
+//
+//		size_t			-		Size (bytes), 0 if the size is not valid
+//
+//  NOTES:
+//
+//	1.		The whole string must be consumed, a size with any other trailing characters is not valid.
+//
+
+size_t	parseSize(const char* szSize) {
+	char*			pEnd = nullptr;												//  End of the number
+	unsigned long	Value = 0;													//  Number parsed
+	size_t			Scale = 1024;												//  Bytes per unit
+
+	if (szSize == nullptr || szSize[0] < '0' || szSize[0] > '9') return 0;
+	errno = 0;
+	Value = strtoul(szSize, &pEnd, 10);
+	if (errno != 0 || pEnd == szSize) return 0;
+
+	//  Apply the unit suffix
+	switch (*pEnd) {
+	case '\0':
+		break;
+	case 'K':
+	case 'k':
+		pEnd++;
+		break;
+	case 'M':
+	case 'm':
+		Scale = size_t(1024) * 1024;
+		pEnd++;
+		break;
+	case 'G':
+	case 'g':
+		Scale = size_t(1024) * 1024 * 1024;
+		pEnd++;
+		break;
+	default:
+		return 0;
+	}
+	if (*pEnd != '\0') return 0;
+
+	//  Reject sizes that overflow
+	if (size_t(Value) > SIZE_MAX / Scale) return 0;
+	return size_t(Value) * Scale;
+}
+
+//  loadFile
+//
+//  Loads the content of a file into memory.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the file name
+//		size_t&			-		Reference to the variable to receive the size of the content
+//
+//  RETURNS:
+//
+//		BYTE*			-		Pointer to the content, nullptr if the file could not be loaded or is empty
+//
+//  NOTES:
+//
+
+xymorg::BYTE*	loadFile(const char* FileName, size_t& Size) {
+	std::ifstream	File(FileName, std::ios::in | std::ios::binary);			//  Input file
+	xymorg::BYTE*	pContent = nullptr;											//  File content
+
+	Size = 0;
+	if (!File.is_open()) return nullptr;
+
+	File.seekg(0, std::ios::end);
+	Size = size_t(File.tellg());
+	File.seekg(0, std::ios::beg);
+	if (Size == 0) return nullptr;
+
+	pContent = (xymorg::BYTE*)malloc(Size);
+	if (pContent == nullptr) return nullptr;
+	File.read((char*)pContent, Size);
+	if (size_t(File.gcount()) != Size) {
+		free(pContent);
+		return nullptr;
+	}
+
+	return pContent;
+}
+
+//  benchContent
+//
+//  Measures the content at the requested level(s) and reports the results.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the name of the content
+//		BYTE*			-		Const pointer to the content
+//		size_t			-		Size of the content
+//		int				-		Level to measure, 0 measures all levels
+//		bool			-		true for JSON output, false for text
+//		bool			-		true if this is the first content reported
+//
+//  RETURNS:
+//
+//		bool			-		true if every run was verified, otherwise false
+//
+//  NOTES:
+//
+
+bool	benchContent(const char* Name, const xymorg::BYTE* pContent, size_t Size, int Level, bool JSON, bool First) {
+	RunResult		Results[xymorg::Chimera::MaxLevel] = {};					//  Results of each run
+	size_t			Runs = 0;													//  Number of runs
+	bool			AllVerified = true;											//  All runs were verified
+
+	for (int RL = xymorg::Chimera::MinLevel; RL <= xymorg::Chimera::MaxLevel; RL++) {
+		if (Level != 0 && RL != Level) continue;
+		runLevel(pContent, Size, RL, Results[Runs]);
+		if (!Results[Runs].Verified) AllVerified = false;
+		Runs++;
+	}
+
+	if (JSON) reportJSON(Name, Results, Runs, First);
+	else reportText(Name, Results, Runs);
+
+	return AllVerified;
+}
+
+//  runLevel
+//
+//  Compresses and decompresses the content at a level and records the measurements.
+//
+//  PARAMETERS:
+//
+//		BYTE*			-		Const pointer to the content
+//		size_t			-		Size of the content
+//		int				-		Compression level
+//		RunResult&		-		Reference to the result to be filled
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+//	1.		The contributions are taken from the statistics of the compression.
+//
+
+void	runLevel(const xymorg::BYTE* pContent, size_t Size, int Level, RunResult& Result) {
+	xymorg::Chimera		Encoder(std::cerr);										//  Chimera Encoder
+	xymorg::Chimera		Decoder(std::cerr);										//  Chimera Decoder
+	xymorg::ByteStream	bsIn(const_cast<xymorg::BYTE*>(pContent), Size);		//  Content (read only)
+	xymorg::TIMER		CS = xymorg::CLOCK::now();								//  Compression start time
+	xymorg::TIMER		DS = xymorg::CLOCK::now();								//  Decompression start time
+	xymorg::TIMER		DE = xymorg::CLOCK::now();								//  Decompression end time
+	size_t				MemBase = 0;											//  Resident set at the start of a measurement
+	size_t				DecompSize = 0;											//  Decompressed size
+
+	Result = RunResult{};
+	Result.Level = Level;
+	Result.Size = Size;
+	Encoder.setLevel(Level);
+	Decoder.setLevel(Level);
+
+	//  Compress the content
+	MemBase = resetPeakMemory();
+	CS = xymorg::CLOCK::now();
+	xymorg::ByteStream	bsComp((Size / 2) + 4096, (Size / 4) + 4096);			//  Compressed content
+
+	Result.CompSize = Encoder.compress(bsIn, bsComp);
+	DS = xymorg::CLOCK::now();
+	Result.CompPeak = getPeakMemory(MemBase);
+	Result.CompMBs = getMBPerSecond(Size, CS, DS);
+
+	//  Decompress the content, the spare byte exposes any excess output
+	MemBase = resetPeakMemory();
+	DS = xymorg::CLOCK::now();
+	xymorg::ByteStream	bsCIn(bsComp.getBufferAddress(), Result.CompSize);		//  Compressed content
+	xymorg::ByteStream	bsOut(Size + 1);										//  Decompressed content
+
+	DecompSize = Decoder.decompress(bsCIn, bsOut);
+	DE = xymorg::CLOCK::now();
+	Result.DecompPeak = getPeakMemory(MemBase);
+	Result.DecompMBs = getMBPerSecond(Size, DS, DE);
+
+	//  Verify the round trip
+	Result.Verified = DecompSize == Size && memcmp(bsOut.getBufferAddress(), pContent, Size) == 0;
+
+	//  Attribute the content and the compressed stream to the encodings
+	const xymorg::Chimera::CStats&	Stats = Encoder.getStatistics();			//  Compression statistics
+
+	Result.Tokens = Stats.Tokens;
+	Result.ReuseTokens = Stats.ReuseTokens;
+	Result.Symbols.Tokens = Stats.NS1Tokens + Stats.NS2Tokens + Stats.NS3Tokens + Stats.ES1Tokens + Stats.ES2Tokens + Stats.ES3Tokens;
+	Result.Symbols.Bytes = Stats.NS1Tokens + (2 * Stats.NS2Tokens) + (3 * Stats.NS3Tokens) + Stats.ES1Tokens + (2 * Stats.ES2Tokens) + (3 * Stats.ES3Tokens);
+	Result.Symbols.Bits = Stats.NS1Bits + Stats.NS2Bits + Stats.NS3Bits + Stats.ES1Bits + Stats.ES2Bits + Stats.ES3Bits;
+	Result.Strings.Tokens = Stats.StrTokens;
+	Result.Strings.Bytes = Stats.StrBytes;
+	Result.Strings.Bits = Stats.StrBits;
+	Result.Dictionary.Tokens = Stats.DictTokens;
+	Result.Dictionary.Bytes = Stats.DictBytes;
+	Result.Dictionary.Bits = Stats.DictBits;
+	Result.Runs.Tokens = Stats.RL8Tokens + Stats.RL16Tokens + Stats.RL32Tokens;
+	Result.Runs.Bytes = Stats.RL8Bytes + Stats.RL16Bytes + Stats.RL32Bytes;
+	Result.Runs.Bits = Stats.RL8Bits + Stats.RL16Bits + Stats.RL32Bits;
+
+	//  Return to caller
+	return;
+}
+
+//  reportText
+//
+//  Reports the results for a content as text tables.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the name of the content
+//		RunResult*		-		Const pointer to the results
+//		size_t			-		Number of results
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+//	1.		Each contribution is shown as the percentage of the content encoded / percentage of the compressed bits.
+//
+
+void	reportText(const char* Name, const RunResult* pResults, size_t Runs) {
+	const Contribution*	pParts[4] = {};											//  Contributions of a run
+	double				OutBits = 0.0;											//  Compressed bits
+
+	std::cout << std::endl;
+	std::cout << "Content: " << Name << " (" << (Runs > 0 ? pResults[0].Size : 0) << " bytes)." << std::endl;
+	std::cout << "Level      Ratio   Compress MB/s   Decompress MB/s   Compress Peak KB   Decompress Peak KB   Verified" << std::endl;
+	std::cout << "-----   --------   -------------   ---------------   ----------------   ------------------   --------" << std::endl;
+
+	for (size_t RX = 0; RX < Runs; RX++) {
+		std::cout << std::setw(5) << pResults[RX].Level << "   "
+			<< std::fixed << std::setprecision(2) << std::setw(7) << ((double(pResults[RX].CompSize) * 100.0) / double(pResults[RX].Size)) << "%   "
+			<< std::setw(13) << pResults[RX].CompMBs << "   "
+			<< std::setw(15) << pResults[RX].DecompMBs << "   ";
+		if (pResults[RX].CompPeak == NoMemoryProbe) std::cout << std::setw(16) << "n/a" << "   ";
+		else std::cout << std::setw(16) << (pResults[RX].CompPeak / 1024) << "   ";
+		if (pResults[RX].DecompPeak == NoMemoryProbe) std::cout << std::setw(18) << "n/a" << "   ";
+		else std::cout << std::setw(18) << (pResults[RX].DecompPeak / 1024) << "   ";
+		std::cout << (pResults[RX].Verified ? "yes" : "NO") << std::endl;
+	}
+
+	std::cout << std::endl;
+	std::cout << "Level         Symbols    Repeat Strings        Dictionary              Runs   (% content / % compressed)" << std::endl;
+	std::cout << "-----   -------------   ---------------   ---------------   ---------------" << std::endl;
+
+	for (size_t RX = 0; RX < Runs; RX++) {
+		pParts[0] = &pResults[RX].Symbols;
+		pParts[1] = &pResults[RX].Strings;
+		pParts[2] = &pResults[RX].Dictionary;
+		pParts[3] = &pResults[RX].Runs;
+		OutBits = double(pResults[RX].CompSize) * 8.0;
+		if (OutBits < 1.0) OutBits = 1.0;
+
+		std::cout << std::setw(5) << pResults[RX].Level;
+		for (size_t PX = 0; PX < 4; PX++) {
+			std::cout << ((PX == 0) ? "   " : "     ") << std::fixed << std::setprecision(1)
+				<< std::setw(6) << ((double(pParts[PX]->Bytes) * 100.0) / double(pResults[RX].Size)) << " /"
+				<< std::setw(5) << ((double(pParts[PX]->Bits) * 100.0) / OutBits);
+		}
+		std::cout << std::endl;
+	}
+
+	//  Return to caller
+	return;
+}
+
+//  reportJSON
+//
+//  Reports the results for a content as an element of the JSON "contents" array.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the name of the content
+//		RunResult*		-		Const pointer to the results
+//		size_t			-		Number of results
+//		bool			-		true if this is the first element of the array
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+//	1.		Peak memory is null when it is not available.
+//
+
+void	reportJSON(const char* Name, const RunResult* pResults, size_t Runs, bool First) {
+	static const char*	PartNames[4] = { "symbols", "strings", "dictionary", "runs" };
+	const Contribution*	pParts[4] = {};											//  Contributions of a run
+
+	std::cout << (First ? "" : ",") << std::endl;
+	std::cout << "    {" << std::endl;
+	std::cout << "      \"content\": ";
+	writeJSONString(Name);
+	std::cout << "," << std::endl;
+	std::cout << "      \"size\": " << (Runs > 0 ? pResults[0].Size : 0) << "," << std::endl;
+	std::cout << "      \"runs\": [";
+
+	for (size_t RX = 0; RX < Runs; RX++) {
+		pParts[0] = &pResults[RX].Symbols;
+		pParts[1] = &pResults[RX].Strings;
+		pParts[2] = &pResults[RX].Dictionary;
+		pParts[3] = &pResults[RX].Runs;
+
+		std::cout << ((RX == 0) ? "" : ",") << std::endl;
+		std::cout << "        {" << std::endl;
+		std::cout << "          \"level\": " << pResults[RX].Level << "," << std::endl;
+		std::cout << "          \"compressed\": " << pResults[RX].CompSize << "," << std::endl;
+		std::cout << "          \"ratio\": " << std::fixed << std::setprecision(4) << (double(pResults[RX].CompSize) / double(pResults[RX].Size)) << "," << std::endl;
+		std::cout << "          \"compress_mbps\": " << std::setprecision(3) << pResults[RX].CompMBs << "," << std::endl;
+		std::cout << "          \"decompress_mbps\": " << pResults[RX].DecompMBs << "," << std::endl;
+		std::cout << "          \"compress_peak_bytes\": ";
+		if (pResults[RX].CompPeak == NoMemoryProbe) std::cout << "null";
+		else std::cout << pResults[RX].CompPeak;
+		std::cout << "," << std::endl;
+		std::cout << "          \"decompress_peak_bytes\": ";
+		if (pResults[RX].DecompPeak == NoMemoryProbe) std::cout << "null";
+		else std::cout << pResults[RX].DecompPeak;
+		std::cout << "," << std::endl;
+		std::cout << "          \"verified\": " << (pResults[RX].Verified ? "true" : "false") << "," << std::endl;
+		std::cout << "          \"tokens\": " << pResults[RX].Tokens << "," << std::endl;
+		std::cout << "          \"reused_tokens\": " << pResults[RX].ReuseTokens << "," << std::endl;
+		std::cout << "          \"contributions\": {" << std::endl;
+		for (size_t PX = 0; PX < 4; PX++) {
+			std::cout << "            \"" << PartNames[PX] << "\": { \"tokens\": " << pParts[PX]->Tokens
+				<< ", \"bytes\": " << pParts[PX]->Bytes << ", \"bits\": " << pParts[PX]->Bits << " }"
+				<< ((PX < 3) ? "," : "") << std::endl;
+		}
+		std::cout << "          }" << std::endl;
+		std::cout << "        }";
+	}
+
+	std::cout << std::endl << "      ]" << std::endl;
+	std::cout << "    }";
+
+	//  Return to caller
+	return;
+}
+
+//  writeJSONString
+//
+//  Writes a string to stdout as a quoted JSON string.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the string
+//
+//  RETURNS:
+//
+//  NOTES:
+//
+
+void	writeJSONString(const char* String) {
+	static const char*	Hex = "0123456789abcdef";
+
+	std::cout << '"';
+	for (size_t CX = 0; String[CX] != '\0'; CX++) {
+		if (String[CX] == '"' || String[CX] == '\\') std::cout << '\\' << String[CX];
+		else if (xymorg::BYTE(String[CX]) < 0x20) std::cout << "\\u00" << Hex[xymorg::BYTE(String[CX]) >> 4] << Hex[String[CX] & 0x0F];
+		else std::cout << String[CX];
+	}
+	std::cout << '"';
+
+	//  Return to caller
+	return;
+}
+
+//  readMemoryStatus
+//
+//  Reads a memory value from the status of the process.
+//
+//  PARAMETERS:
+//
+//		char*			-		Const pointer to the key of the value (e.g. "VmRSS:")
+//
+//  RETURNS:
+//
+//		size_t			-		The value in bytes, NoMemoryProbe if it is not available
+//
+//  NOTES:
+//
+//	1.		Only available on Linux (/proc/self/status).
+//
+
+size_t	readMemoryStatus(const char* Key) {
+#if (defined(__linux__))
+	std::ifstream	Status("/proc/self/status");								//  Process status
+	char			Line[256] = {};												//  Status line
+	size_t			KeyLen = strlen(Key);										//  Length of the key
+
+	if (!Status.is_open()) return NoMemoryProbe;
+	while (Status.getline(Line, sizeof(Line))) {
+		if (strncmp(Line, Key, KeyLen) == 0) return size_t(strtoull(Line + KeyLen, nullptr, 10)) * 1024;
+	}
+#else
+	(void)Key;
+#endif
+	return NoMemoryProbe;
+}
+
+//  resetPeakMemory
+//
+//  Starts a peak memory measurement by resetting the peak resident set of the process.
+//
+//  PARAMETERS:
+//
+//  RETURNS:
+//
+//		size_t			-		The resident set at the start of the measurement, NoMemoryProbe if it is not available
+//
+//  NOTES:
+//
+//	1.		Free heap memory is first returned to the system so that its reuse is visible in the resident set.
+//
+
+size_t	resetPeakMemory() {
+#if (defined(__linux__))
+#if (defined(__GLIBC__))
+	malloc_trim(0);
+#endif
+	std::ofstream	ClearRefs("/proc/self/clear_refs");							//  Process reference controls
+
+	if (!ClearRefs.is_open()) return NoMemoryProbe;
+	ClearRefs << "5";
+	ClearRefs.close();
+	if (ClearRefs.fail()) return NoMemoryProbe;
+	return readMemoryStatus("VmRSS:");
+#else
+	return NoMemoryProbe;
+#endif
+}
+
+//  getPeakMemory
+//
+//  Completes a peak memory measurement.
+//
+//  PARAMETERS:
+//
+//		size_t			-		The resident set at the start of the measurement
+//
+//  RETURNS:
+//
+//		size_t			-		Growth of the resident set during the measurement, NoMemoryProbe if it is not available
+//
+//  NOTES:
+//
+
+size_t	getPeakMemory(size_t Base) {
+	size_t			Peak = 0;													//  Peak resident set
+
+	if (Base == NoMemoryProbe) return NoMemoryProbe;
+	Peak = readMemoryStatus("VmHWM:");
+	if (Peak == NoMemoryProbe) return NoMemoryProbe;
+	return (Peak > Base) ? Peak - Base : 0;
+}
+
+//  getMBPerSecond
+//
+//  Computes the throughput for the given number of bytes over an interval.
+//
+//  PARAMETERS:
+//
+//		size_t			-		Number of bytes processed
+//		TIMER			-		Start of the interval
+//		TIMER			-		End of the interval
+//
+//  RETURNS:
+//
+//		double			-		Throughput in MB (10^6 bytes) per second
+//
+//  NOTES:
+//
+
+double	getMBPerSecond(size_t Bytes, xymorg::TIMER Start, xymorg::TIMER End) {
+	double			Micros = double(DURATION(xymorg::MICROSECONDS, End - Start).count());	//  Interval in microseconds
+
+	if (Micros < 1.0) Micros = 1.0;
+	return double(Bytes) / Micros;
+}
@@ -0,0 +1,128 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       ChimeraBench.h																					*
+//*   Suite:      xymorg Integration - Chimera CODEC																*
+//*   Version:    1.1.1	(Build: 03)																					*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2026 Ian J. Tree.																					*
+//*******************************************************************************************************************
+//*	ChimeraBench																									*
+//*																													*
+//*	This application measures the compression ratio, the compression and decompression throughput and the peak		*
+//* memory of the Chimera CODEC for each of the compression levels (1 - 9) over a built-in synthetic corpus.		*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		ChimeraBench [-J] [-L:<Level>] [-S:<Size>] [<File> ...]														*
+//*																													*
+//*     where:-																										*
+//*																													*
+//*		-J					-	Writes the results as a JSON document to stdout.									*
+//*		-L:<Level>			-	Measures a single compression level, all levels are measured by default.			*
+//*		-S:<Size>			-	Is the size (KB) of each class of the synthetic corpus, the default is 256.			*
+//*							A K, M or G suffix gives the size in KB, MB or GB.										*
+//*		<File>				-	Is the path to a file to be measured, the synthetic corpus is used if no files		*
+//*							are given.																				*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.		The synthetic corpus holds text, log, binary trace, highly repetitive and random content, each class	*
+//*			is generated from a fixed seed and is identical for every run.											*
+//*	2.		Every run is decompressed and compared with the original content, the exit code is non-zero if any		*
+//*			run fails.																								*
+//*	3.		The contribution of each encoding (symbols, repeat strings, dictionary and runs) is taken from the		*
+//*			statistics (CStats) of the compression.																	*
+//*	4.		Peak memory is the growth in the resident set during a run, it is only available on Linux.				*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		19/10/2026	-	Initial Release																		*
+//*	1.1.0 -		19/10/2026	-	Synthetic corpus, peak memory, encoding contributions and JSON output				*
+//*	1.1.1 -		19/10/2026	-	Corpus sizes are validated and accept K, M and G suffixes							*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"../xymorg/CODECS/Chimera.h"													//  Chimera CODEC
+
+//  Additional Language Headers
+#include	<fstream>																		//  Input files
+#include	<iomanip>																		//  Report formatting
+#include	<random>																		//  Corpus generation
+
+//  Platform Headers
+#if (defined(__linux__))
+#include	<malloc.h>																		//  Heap trimming
+#endif
+
+//  Define the type of Pseudo Random Number Generator (PRNG) to use
+typedef		std::mt19937			PRNG;
+
+//  Identification Constants
+constexpr auto		APP_NAME = "ChimeraBench";
+constexpr auto		APP_TITLE = "Chimera CODEC Benchmark";
+#ifdef _DEBUG
+constexpr auto		APP_VERSION = "1.1.1 build: 03 Debug";
+#else
+constexpr auto		APP_VERSION = "1.1.1 build: 03";
+#endif
+
+//  Corpus Constants
+constexpr size_t	DefaultCorpusSize = 256;														//  Default size (KB) of each corpus class
+constexpr uint32_t	CorpusSeed = 19102026;															//  Seed for the synthetic corpus
+
+//  Memory Constants
+constexpr size_t	NoMemoryProbe = SIZE_MAX;														//  Peak memory is not available
+
+//
+//  Encoding Contribution
+//
+
+typedef struct Contribution {
+	size_t			Tokens;																			//  Tokens emitted
+	size_t			Bytes;																			//  Content bytes encoded
+	size_t			Bits;																			//  Bits emitted
+} Contribution;
+
+//
+//  Result of a measurement run
+//
+
+typedef struct RunResult {
+	int				Level;																			//  Compression level
+	size_t			Size;																			//  Content size
+	size_t			CompSize;																		//  Compressed size
+	double			CompMBs;																		//  Compression throughput (MB/s)
+	double			DecompMBs;																		//  Decompression throughput (MB/s)
+	size_t			CompPeak;																		//  Compression peak memory (bytes)
+	size_t			DecompPeak;																		//  Decompression peak memory (bytes)
+	bool			Verified;																		//  Round trip was verified
+	size_t			Tokens;																			//  Tokens emitted
+	size_t			ReuseTokens;																	//  Modal re-use of the last token
+	Contribution	Symbols;																		//  Symbol (entropy) encoding
+	Contribution	Strings;																		//  Repeat string (LZ77) encoding
+	Contribution	Dictionary;																		//  Dictionary encoding
+	Contribution	Runs;																			//  Run length encoding
+} RunResult;
+
+//  Forward Declarations/ Function Prototypes
+xymorg::BYTE*	buildText(PRNG& RGen, size_t Size);													//  Build the text corpus class
+xymorg::BYTE*	buildLog(PRNG& RGen, size_t Size);													//  Build the log corpus class
+xymorg::BYTE*	buildTrace(PRNG& RGen, size_t Size);												//  Build the binary trace corpus class
+xymorg::BYTE*	buildRepetitive(PRNG& RGen, size_t Size);											//  Build the repetitive corpus class
+xymorg::BYTE*	buildRandom(PRNG& RGen, size_t Size);												//  Build the random corpus class
+size_t	parseSize(const char* szSize);																//  Parse a corpus size
+xymorg::BYTE*	loadFile(const char* FileName, size_t& Size);										//  Load a file into memory
+bool	benchContent(const char* Name, const xymorg::BYTE* pContent, size_t Size, int Level, bool JSON, bool First);	//  Measure content
+void	runLevel(const xymorg::BYTE* pContent, size_t Size, int Level, RunResult& Result);			//  Measure a level
+void	reportText(const char* Name, const RunResult* pResults, size_t Runs);						//  Report the results (text)
+void	reportJSON(const char* Name, const RunResult* pResults, size_t Runs, bool First);			//  Report the results (JSON)
+void	writeJSONString(const char* String);														//  Write a JSON string
+size_t	readMemoryStatus(const char* Key);															//  Read a process memory status value
+size_t	resetPeakMemory();																			//  Start a peak memory measurement
+size_t	getPeakMemory(size_t Base);																	//  Complete a peak memory measurement
+double	getMBPerSecond(size_t Bytes, xymorg::TIMER Start, xymorg::TIMER End);						//  Compute the throughput
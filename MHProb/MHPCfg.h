@@ -289,7 +289,7 @@ private:
 	//
 
 	void	handleConfig() {
-		xymorg::XMLMicroParser					CfgXML(pCfgImg);									//  XML Micro Parser for the application configuration file
+		xymorg::XMLMicroParser					CfgXML(pCfgImg, true);								//  XML Micro Parser for the application configuration file
 		xymorg::XMLMicroParser::XMLIterator		MNode = CfgXML.getScope("monty");					//  Monty definition node of the configuration
 
 		//  Safety/Validity
@@ -67,6 +67,7 @@ constexpr auto ACYCLES_PARM = "acycles";													//  Autonomics action cycle
 #include	"MP/MPQueues.h"																	//  MP Queues
 #include	"MP/ThreadPool.h"																//  MP ThreadPool
 #include	"MP/Dispatcher.h"																//  MP Dispatcher
+#include	"MP/ConcurrentStringPool.h"														//  MP String Pool
 
 //  Configuration nodes and attribute names
 constexpr auto		THREADS_NODE = "threads";
@@ -1331,7 +1332,7 @@ namespace xymorg {
 		//  
 
 		void		parseCoreConfiguration(char* pImg) {
-			xymorg::XMLMicroParser			Parser(pImg);											//  XML Micro Parser for the application configuration file
+			xymorg::XMLMicroParser			Parser(pImg, true);										//  XML Micro Parser for the application configuration file
 			xymorg::XMLMicroParser::XMLIterator		XIt(nullptr);										//  XML Iterator
 			size_t			RLen = 0;																	//  Length of parameter value
 			const char*		pRVal;																		//  Pointer to parameter value
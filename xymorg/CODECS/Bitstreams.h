@@ -4,20 +4,22 @@
 //*																													*
 //*   File:       Bitstreams.h																						*
 //*   Suite:      xymorg integration																				*
-//*   Version:    2.0.0	  Build:  02																				*
+//*   Version:    2.1.0	  Build:  04																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2016 - 2023 Ian J. Tree																				*
+//*   Copyright 2016 - 2026 Ian J. Tree																				*
 //*******************************************************************************************************************
 //*	Bitstreams.h																									*
 //*																													*
 //*	This header file contains the class definition for the the bitstream classes.									*
 //* The bitstream classes provide mechanisms for reading and writing arbitrary data as a stream of bit strings.		*
-//* The header file also defines the bytestream classes that act as providers of a serial 8 bit wide stream for     *
+//* The header file also defines the bytestream classes that act as providers of a serial 8 bit wide stream for		*
 //* the bitstreams.																									*
 //*																													*
 //*	NOTES:																											*
 //*																													*
+//*	1.		The bitstreams hold up to 64 bits in a word buffer that exchanges whole words with a byte stage,		*
+//*			the stage is transferred to and from the underlying ByteStream through readSpan() and writeSpan().		*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -25,6 +27,7 @@
 //*																													*
 //*	1.0.0 - 26/09/2016   -  Initial version																			*
 //*	2.0.0 - 10/02/2018   -  xymorg integration																		*
+//*	2.1.0 - 19/10/2026   -  Word buffered bitstreams with span access to the ByteStream								*
 //*																													*
 //*******************************************************************************************************************
 
@@ -444,6 +447,83 @@ namespace xymorg {
 			return;
 		}
 
+		//  readSpan
+		//
+		//  Reads a span of bytes from the input buffer
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the area to receive the bytes
+		//		size_t			-		Number of bytes requested
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes actually read, less than requested at the end of the stream
+		//
+		//	NOTES
+		//
+		//	1.	Specialisations that override next() must override this function to apply the same transformation.
+		//
+
+		virtual size_t readSpan(BYTE* pSpan, size_t SpanLen) {
+
+			//  If end-of-stream has already been detected nothing can be read
+			if (EndOfStream) return 0;
+
+			//  Limit the span to the remaining content
+			if (SpanLen > (BufferSize - BytesRead)) SpanLen = BufferSize - BytesRead;
+
+			//  Copy the span and test for end-of-stream
+			memcpy(pSpan, Buffer + BytesRead, SpanLen);
+			BytesRead += SpanLen;
+			if (BytesRead == BufferSize) EndOfStream = true;
+
+			//  Return the count of bytes read
+			return SpanLen;
+		}
+
+		//  writeSpan
+		//
+		//  Writes a span of bytes to the output buffer
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the bytes to be written
+		//		size_t			-		Number of bytes to write
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes actually written, less than requested if the buffer is filled
+		//
+		//	NOTES
+		//
+		//	1.	Specialisations that override next(BYTE) must override this function to apply the same transformation.
+		//
+
+		virtual size_t writeSpan(const BYTE* pSpan, size_t SpanLen) {
+			//  Check to see if the output buffer is full - if so dump the span
+			if (EndOfStream) return 0;
+
+			//  If the Buffer is extensible then extend it in whole increments to hold the span
+			if (BufferInc != 0 && (BytesWritten + SpanLen) >= BufferSize) {
+				size_t		NewSize = BufferSize + (BufferInc * ((((BytesWritten + SpanLen) - BufferSize) / BufferInc) + 1));
+				BYTE*		NewBuffer = (BYTE*)realloc(Buffer, NewSize);
+				if (NewBuffer != nullptr) {
+					Buffer = NewBuffer;
+					BufferSize = NewSize;
+				}
+			}
+
+			//  Limit the span to the space available and post it to the buffer
+			if (SpanLen > (BufferSize - BytesWritten)) SpanLen = BufferSize - BytesWritten;
+			memcpy(Buffer + BytesWritten, pSpan, SpanLen);
+			BytesWritten += SpanLen;
+			if (BytesWritten == BufferSize) EndOfStream = true;
+
+			//  Return the count of bytes written
+			return SpanLen;
+		}
+
 		//  Buffer management functions
 
 		//  Getters & Setters for members
@@ -973,6 +1053,50 @@ namespace xymorg {
 			return;
 		}
 
+		//  readSpan
+		//
+		//  Reads a span of bytes from the input buffer, segment boundaries are handled by next().
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the area to receive the bytes
+		//		size_t			-		Number of bytes requested
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes actually read
+		//
+		//	NOTES
+		//
+
+		virtual size_t readSpan(BYTE* pSpan, size_t SpanLen) {
+			size_t		Count = 0;												//  Count of bytes read
+
+			while (Count < SpanLen && !EndOfStream) pSpan[Count++] = next();
+			return Count;
+		}
+
+		//  writeSpan
+		//
+		//  Writes a span of bytes to the output buffer, segment boundaries are handled by next(BYTE).
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the bytes to be written
+		//		size_t			-		Number of bytes to write
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes presented for writing
+		//
+		//	NOTES
+		//
+
+		virtual size_t writeSpan(const BYTE* pSpan, size_t SpanLen) {
+			for (size_t Count = 0; Count < SpanLen; Count++) next(pSpan[Count]);
+			return SpanLen;
+		}
+
 		//
 		//  advance, retreat and peek api is NOT supported on a segmented stream
 		//
@@ -1283,6 +1407,50 @@ namespace xymorg {
 			return;
 		}
 
+		//  readSpan
+		//
+		//  Reads a span of bytes from the input buffer, destuffing is handled by next().
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the area to receive the bytes
+		//		size_t			-		Number of bytes requested
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes actually read
+		//
+		//	NOTES
+		//
+
+		virtual size_t readSpan(BYTE* pSpan, size_t SpanLen) {
+			size_t		Count = 0;												//  Count of bytes read
+
+			while (Count < SpanLen && !EndOfStream) pSpan[Count++] = next();
+			return Count;
+		}
+
+		//  writeSpan
+		//
+		//  Writes a span of bytes to the output buffer, stuffing is handled by next(BYTE).
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the bytes to be written
+		//		size_t			-		Number of bytes to write
+		//
+		//	RETURNS
+		//
+		//		size_t			-		Number of bytes presented for writing
+		//
+		//	NOTES
+		//
+
+		virtual size_t writeSpan(const BYTE* pSpan, size_t SpanLen) {
+			for (size_t Count = 0; Count < SpanLen; Count++) next(pSpan[Count]);
+			return SpanLen;
+		}
+
 		//
 		//  advance, retreat and peek api is NOT supported on a stuffed stream
 		//
@@ -1309,6 +1477,7 @@ namespace xymorg {
 	//*		The bit order is MSB first to support various compression implementations of Huffman & Lempel-Ziv			*
 	//*		algorithms.																									*
 	//*		This implementation supports a maximum of 32 bits in an individual bit string.								*
+	//*		Bits are held left aligned in a 64 bit word buffer that is filled and emptied a word at a time.				*
 	//*																													*
 	//*******************************************************************************************************************
 
@@ -1334,54 +1503,25 @@ namespace xymorg {
 		//
 		//	NOTES
 		//
+		//	1.	A reading stream consumes the backing ByteStream ahead of the bits that have been read.
+		//
 
 		MSBitStream(ByteStream& BackingStream, bool Writeable) : bsBase(BackingStream) {
-			BitOffset = 0;
-			EndOfStream = true;
+			BitBuffer = 0;
 			BufferedBits = 0;
 			BitsWritten = 0;
 			BitsRead = 0;
+			StagePos = 0;
+			StageLen = 0;
+			Writer = Writeable;
+			EndOfStream = true;
 
 			//  Condition the stream for writing or for reading
-			if (Writeable) {
-				//  Condition for writing
-				BitOffset = 0;
-				BitsWritten = 0;
-				EndOfStream = false;
-				BufferedBits = 0;
-
-				//  Clear the byte array
-				ByteArray[0] = 0;
-				ByteArray[1] = 0;
-				ByteArray[2] = 0;
-			}
+			if (Writeable) EndOfStream = false;
 			else {
-				//  Condition for reading
-				BitOffset = 0;
-				BitsRead = 0;
-				EndOfStream = true;
-				BufferedBits = 0;
-
-				//  Fill the byte array from the underlying byte stream
-				if (!bsBase.eos())
-				{
-					EndOfStream = false;
-					ByteArray[0] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[0] = 0;
-				if (!bsBase.eos())
-				{
-					ByteArray[1] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[1] = 0;
-				if (!bsBase.eos())
-				{
-					ByteArray[2] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[2] = 0;
+				//  Fill the bit buffer from the underlying byte stream
+				refill();
+				if (BufferedBits > 0) EndOfStream = false;
 			}
 
 			//  Return to caller
@@ -1395,6 +1535,13 @@ namespace xymorg {
 		//*******************************************************************************************************************
 
 		~MSBitStream() {
+
+			//  Any complete bytes still staged are written to the underlying stream, partial bytes require a flush()
+			if (Writer) {
+				spill();
+				drain();
+			}
+
 			//  Return to caller
 			return;
 		};
@@ -1417,34 +1564,72 @@ namespace xymorg {
 		//
 		//  PARAMETERS
 		//
-		//		uint32_t			-	Size of the bit string to read	
-		// 
+		//		uint32_t			-	Size of the bit string to read
+		//
 		//	RETURNS
 		//
 		//		uint32_t			-	String
 		//
 		//	NOTES
 		//
+		//	1.	Bits read beyond the end of the stream are returned as zero.
+		//
 
 		uint32_t next(uint32_t Bits)
 		{
-			uint32_t				Junior, Senior;												//  Junior and senior part of the string
+			uint32_t				String = 0;													//  String read
 
 			//  Envelope check
 			if (Bits > 32) return 0;
 
-			//  Read the parts of the string
-			if (Bits > 16)
-			{
-				Senior = next(Bits - 16);
-				Junior = next16(16);
-			}
-			else
-			{
-				Junior = next16(Bits);
-				Senior = 0;
+			if (Bits > 0) {
+				//  Top up the bit buffer if it cannot supply the string
+				if (Bits > BufferedBits) refill();
+
+				//  Take the string from the top of the bit buffer
+				String = uint32_t(BitBuffer >> (64 - Bits));
+				BitBuffer <<= Bits;
+				if (Bits > BufferedBits) BufferedBits = 0;
+				else BufferedBits -= Bits;
+				BitsRead += Bits;
 			}
-			return (Senior << 16) | Junior;
+
+			//  Test for end of stream
+			if (BufferedBits == 0 && StagePos == StageLen && bsBase.eos()) EndOfStream = true;
+
+			//  Return the string
+			return String;
+		}
+
+		//  peek
+		//
+		//  Returns the next bit string from the stream without consuming it
+		//
+		//  PARAMETERS
+		//
+		//		uint32_t			-	Size of the bit string to read
+		//		uint32_t&			-	Reference to the variable that receives the string
+		//
+		//	RETURNS
+		//
+		//		bool				-	true if the stream holds the whole string, false if it was padded with zeros
+		//
+		//	NOTES
+		//
+
+		bool peek(uint32_t Bits, uint32_t& String)
+		{
+			//  Envelope check
+			String = 0;
+			if (Bits > 32) return false;
+			if (Bits == 0) return true;
+
+			//  Top up the bit buffer if it cannot supply the string
+			if (Bits > BufferedBits) refill();
+
+			//  Return the string leaving the bit buffer unchanged
+			String = uint32_t(BitBuffer >> (64 - Bits));
+			return Bits <= BufferedBits;
 		}
 
 		//  next
@@ -1454,22 +1639,26 @@ namespace xymorg {
 		//  PARAMETERS
 		//
 		//		uint32_t			-	Bit string to be written
-		//		size_t				-	Size of the bit string to write	
-		// 
+		//		size_t				-	Size of the bit string to write
+		//
 		//	RETURNS
 		//
 		//	NOTES
 		//
+		//	1.	Bits in the string above the requested size are ignored.
+		//
 
 		void next(uint32_t Out, uint32_t Bits)
 		{
-			if (Bits > 32) return;
-			if (Bits > 16)
-			{
-				next16(static_cast<unsigned short>(Out >> 16), Bits - 16);
-				next16(static_cast<unsigned short>(Out & 0x0000FFFF), 16);
-			}
-			else next16(static_cast<unsigned short>(Out), Bits);
+			if (Bits > 32 || Bits == 0) return;
+
+			//  Empty the bit buffer if it cannot hold the string
+			if ((BufferedBits + Bits) > 64) spill();
+
+			//  Append the string below the bits already buffered
+			BitBuffer |= uint64_t(Out & (0xFFFFFFFF >> (32 - Bits))) << ((64 - BufferedBits) - Bits);
+			BufferedBits += Bits;
+			BitsWritten += Bits;
 			return;
 		}
 
@@ -1486,18 +1675,17 @@ namespace xymorg {
 
 		void flush() {
 
-			//  Output any complete BYTES
-			while (BitOffset > 0)
-			{
-				bsBase.next(ByteArray[0]);
-				ByteArray[0] = ByteArray[1];
-				ByteArray[1] = ByteArray[2];
-				ByteArray[2] = 0;
-				if (BitOffset < 8) BitOffset = 0;
-				else BitOffset -= 8;
+			//  Stage any complete BYTES followed by the zero padded partial BYTE
+			spill();
+			if (BufferedBits > 0) {
+				if (StagePos == StageSize) drain();
+				Stage[StagePos++] = BYTE(BitBuffer >> 56);
+				BitBuffer = 0;
+				BufferedBits = 0;
 			}
 
-			//  Signal flush on the underlying ByteStream
+			//  Write the stage to the underlying ByteStream and signal flush
+			drain();
 			bsBase.flush();
 
 			return;
@@ -1533,12 +1721,17 @@ namespace xymorg {
 		//*																													*
 		//*******************************************************************************************************************
 
+		static const size_t	StageSize = 256;													//  Size of the byte stage
+
 		ByteStream&			bsBase;																//  Underlying Byte Stream
-		uint32_t			BitOffset;															//  Offset of the next Bit to be read/written
+		uint64_t			BitBuffer;															//  Bit buffer (left aligned)
+		uint32_t			BufferedBits;														//  Count of buffered bits
 		uint32_t			BitsRead;															//  Bits read (consumed) from the stream
 		uint32_t			BitsWritten;														//  Bits written to the stream
-		BYTE				ByteArray[3];														//  Array of bytes read from the underlying stream
-		uint32_t			BufferedBits;														//  Count of buffered bits
+		BYTE				Stage[StageSize];													//  Bytes staged to/from the underlying stream
+		size_t				StagePos;															//  Offset of the next staged byte
+		size_t				StageLen;															//  Length of the staged bytes (reading)
+		bool				Writer;																//  Stream is conditioned for writing
 		bool				EndOfStream;														//  End of stream indicator
 
 		//*******************************************************************************************************************
@@ -1547,115 +1740,144 @@ namespace xymorg {
 		//*																													*
 		//*******************************************************************************************************************
 
-		//  next16
+		//  refill
 		//
-		//  Reads the next bit string (up to 16 bits) from the stream
+		//  Tops up the bit buffer from the stage, the stage is replenished from the underlying stream when less than
+		//  a whole word remains.
 		//
 		//  PARAMETERS
 		//
-		//		uint16_t			-	Size of the bit string to read	
-		// 
 		//	RETURNS
 		//
-		//		uint16_t			-	String
-		//
 		//	NOTES
 		//
+		//	1.	A word load may leave bits from the following byte below the buffered bits, these are identical to
+		//		the bits that the next load will merge.
+		//
 
-		uint16_t next16(uint32_t Bits)
-		{
-			uint32_t			Acc = 0;														//  Accumulator for the bit string
-			uint32_t			Mask = 0xffffffff;												//  Mak for the Accumulator values
-
-			//  Build the bitstring for the next n Bits
-			Acc = ByteArray[0];
-			Acc <<= 8;
-			Acc |= ByteArray[1];
-			Acc <<= 8;
-			Acc |= ByteArray[2];
-
-			Acc <<= BitOffset;
-			Acc >>= (24 - Bits);
-
-			Mask <<= (32 - Bits);
-			Mask >>= (32 - Bits);
-			Acc &= Mask;
-			BitOffset += Bits;
-			BitsRead += Bits;
-			if (Bits > BufferedBits) BufferedBits = 0;
-			else BufferedBits -= Bits;
-
-			//  Replace any whole bytes that have been consumed
-			while (BitOffset >= 8)
-			{
-				ByteArray[0] = ByteArray[1];
-				ByteArray[1] = ByteArray[2];
-				if (!bsBase.eos())
-				{
-					ByteArray[2] = bsBase.next();
+		void refill() {
+			size_t				Whole = 0;														//  Whole bytes taken from the word
+
+			//  Replenish the stage when less than a word remains
+			if ((StageLen - StagePos) < 8 && !bsBase.eos()) {
+				memmove(Stage, Stage + StagePos, StageLen - StagePos);
+				StageLen -= StagePos;
+				StagePos = 0;
+				StageLen += bsBase.readSpan(Stage + StageLen, StageSize - StageLen);
+			}
+
+			//  Merge a whole word when one is available otherwise merge the remaining bytes
+			if ((StageLen - StagePos) >= 8) {
+				BitBuffer |= loadWord(Stage + StagePos) >> BufferedBits;
+				Whole = (63 - BufferedBits) >> 3;
+				StagePos += Whole;
+				BufferedBits += uint32_t(Whole * 8);
+			}
+			else {
+				while (BufferedBits <= 56 && StagePos < StageLen) {
+					BitBuffer |= uint64_t(Stage[StagePos++]) << (56 - BufferedBits);
 					BufferedBits += 8;
 				}
-				else ByteArray[2] = 0;
-				BitOffset -= 8;
 			}
 
-			//  Test for end of string
-			if (bsBase.eos() && BufferedBits == 0) EndOfStream = true;
-
-			//  Return the string
-			return uint16_t(Acc);
+			//  Return to caller
+			return;
 		}
 
-		//  next16
+		//  spill
 		//
-		//  Writes the next bit string (up to 16 bits) to the stream
+		//  Moves the complete bytes in the bit buffer to the stage.
 		//
 		//  PARAMETERS
 		//
-		//		uint16_t			-   Value to be written
-		//		size_t				-	Size of the bit string to read	
-		// 
 		//	RETURNS
 		//
 		//	NOTES
 		//
 
-		void next16(uint16_t Out, uint32_t Bits)
-		{
-			unsigned int			Acc = 0;									//  Bit string accumulator
+		void spill() {
+			size_t				Whole = BufferedBits >> 3;										//  Whole bytes in the bit buffer
 
-			//  Load the existing BYTE array into the accumulator
-			Acc = ByteArray[0];
-			Acc <<= 8;
-			Acc |= ByteArray[1];
-			Acc <<= 8;
-			Acc |= ByteArray[2];
+			//  Store the whole word and keep the complete bytes
+			if ((StagePos + 8) > StageSize) drain();
+			storeWord(Stage + StagePos, BitBuffer);
+			StagePos += Whole;
+			if (Whole == 8) BitBuffer = 0;
+			else BitBuffer <<= (Whole * 8);
+			BufferedBits -= uint32_t(Whole * 8);
 
-			//  Accumulate the output bits
-			Acc |= (Out << ((24 - BitOffset) - Bits));
+			//  Return to caller
+			return;
+		}
 
-			//  Store back the accumulated value
-			ByteArray[2] = BYTE(Acc & 0x000000FF);
-			ByteArray[1] = BYTE((Acc >> 8) & 0x000000FF);
-			ByteArray[0] = BYTE((Acc >> 16) & 0x000000FF);
+		//  drain
+		//
+		//  Writes the stage to the underlying stream.
+		//
+		//  PARAMETERS
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
 
-			BitOffset += Bits;
-			BitsWritten += Bits;
+		void drain() {
 
-			//  Output any complete BYTES
-			while (BitOffset >= 8)
-			{
-				bsBase.next(ByteArray[0]);
-				ByteArray[0] = ByteArray[1];
-				ByteArray[1] = ByteArray[2];
-				ByteArray[2] = 0;
-				BitOffset -= 8;
-			}
+			if (StagePos > 0) bsBase.writeSpan(Stage, StagePos);
+			StagePos = 0;
 
 			//  Test for End-Of-Stream
 			if (bsBase.eos()) EndOfStream = true;
 			return;
 		}
+
+		//  loadWord
+		//
+		//  Loads a big-endian word from the passed location.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*				-	Pointer to the first of 8 bytes
+		//
+		//	RETURNS
+		//
+		//		uint64_t			-	The word
+		//
+		//	NOTES
+		//
+		//	1.	The shift and merge form is compiled as a single unaligned load (and byte swap) on common platforms.
+		//
+
+		static uint64_t loadWord(const BYTE* pWord) {
+			return (uint64_t(pWord[0]) << 56) | (uint64_t(pWord[1]) << 48) | (uint64_t(pWord[2]) << 40) | (uint64_t(pWord[3]) << 32) |
+				(uint64_t(pWord[4]) << 24) | (uint64_t(pWord[5]) << 16) | (uint64_t(pWord[6]) << 8) | uint64_t(pWord[7]);
+		}
+
+		//  storeWord
+		//
+		//  Stores a word big-endian at the passed location.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*				-	Pointer to the first of 8 bytes
+		//		uint64_t			-	The word
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+
+		static void storeWord(BYTE* pWord, uint64_t Word) {
+			pWord[0] = BYTE(Word >> 56);
+			pWord[1] = BYTE(Word >> 48);
+			pWord[2] = BYTE(Word >> 40);
+			pWord[3] = BYTE(Word >> 32);
+			pWord[4] = BYTE(Word >> 24);
+			pWord[5] = BYTE(Word >> 16);
+			pWord[6] = BYTE(Word >> 8);
+			pWord[7] = BYTE(Word);
+			return;
+		}
 	};
 
 	//*******************************************************************************************************************
@@ -1665,6 +1887,7 @@ namespace xymorg {
 	//*		The LSBitStream class virtualises access to a stream of bytes treating it as a continuous stream of bits.	*
 	//*		The bit order is LSB first to support compressed image formats such as GIF.									*
 	//*		This implementation supports a maximum of 32 bits in an individual bit string.								*
+	//*		Bits are held right aligned in a 64 bit word buffer that is filled and emptied a word at a time.			*
 	//*																													*
 	//*******************************************************************************************************************
 
@@ -1679,7 +1902,7 @@ namespace xymorg {
 
 		//  LSBitStream		-		Normal Constructor
 		//
-		//	Constructs a new MSBitStream object backed by the reference ByteStream.
+		//	Constructs a new LSBitStream object backed by the reference ByteStream.
 		//
 		//  PARAMETERS
 		//
@@ -1690,54 +1913,25 @@ namespace xymorg {
 		//
 		//	NOTES
 		//
+		//	1.	A reading stream consumes the backing ByteStream ahead of the bits that have been read.
+		//
 
 		LSBitStream(ByteStream& BackingStream, bool Writeable) : bsBase(BackingStream) {
-			BitOffset = 0;
-			EndOfStream = true;
+			BitBuffer = 0;
 			BufferedBits = 0;
 			BitsWritten = 0;
 			BitsRead = 0;
+			StagePos = 0;
+			StageLen = 0;
+			Writer = Writeable;
+			EndOfStream = true;
 
 			//  Condition the stream for writing or for reading
-			if (Writeable) {
-				//  Condition for writing
-				BitOffset = 0;
-				BitsWritten = 0;
-				EndOfStream = false;
-				BufferedBits = 0;
-
-				//  Clear the byte array
-				ByteArray[0] = 0;
-				ByteArray[1] = 0;
-				ByteArray[2] = 0;
-			}
+			if (Writeable) EndOfStream = false;
 			else {
-				//  Condition for reading
-				BitOffset = 0;
-				BitsRead = 0;
-				EndOfStream = true;
-				BufferedBits = 0;
-
-				//  Fill the byte array from the underlying byte stream
-				if (!bsBase.eos())
-				{
-					EndOfStream = false;
-					ByteArray[0] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[0] = 0;
-				if (!bsBase.eos())
-				{
-					ByteArray[1] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[1] = 0;
-				if (!bsBase.eos())
-				{
-					ByteArray[2] = bsBase.next();
-					BufferedBits += 8;
-				}
-				else ByteArray[2] = 0;
+				//  Fill the bit buffer from the underlying byte stream
+				refill();
+				if (BufferedBits > 0) EndOfStream = false;
 			}
 
 			//  Return to caller
@@ -1751,6 +1945,13 @@ namespace xymorg {
 		//*******************************************************************************************************************
 
 		~LSBitStream() {
+
+			//  Any complete bytes still staged are written to the underlying stream, partial bytes require a flush()
+			if (Writer) {
+				spill();
+				drain();
+			}
+
 			//  Return to caller
 			return;
 		};
@@ -1773,34 +1974,72 @@ namespace xymorg {
 		//
 		//  PARAMETERS
 		//
-		//		uint32_t			-	Size of the bit string to read	
-		// 
+		//		uint32_t			-	Size of the bit string to read
+		//
 		//	RETURNS
 		//
 		//		uint32_t			-	String
 		//
 		//	NOTES
 		//
+		//	1.	Bits read beyond the end of the stream are returned as zero.
+		//
 
 		uint32_t next(uint32_t Bits)
 		{
-			uint32_t				Junior, Senior;												//  Junior and senior part of the string
+			uint32_t				String = 0;													//  String read
 
 			//  Envelope check
 			if (Bits > 32) return 0;
 
-			//  Read the parts of the string
-			if (Bits > 16)
-			{
-				Junior = next16(16);
-				Senior = next(Bits - 16);
-			}
-			else
-			{
-				Junior = next16(Bits);
-				Senior = 0;
+			if (Bits > 0) {
+				//  Top up the bit buffer if it cannot supply the string
+				if (Bits > BufferedBits) refill();
+
+				//  Take the string from the bottom of the bit buffer
+				String = uint32_t(BitBuffer) & (0xFFFFFFFF >> (32 - Bits));
+				BitBuffer >>= Bits;
+				if (Bits > BufferedBits) BufferedBits = 0;
+				else BufferedBits -= Bits;
+				BitsRead += Bits;
 			}
-			return (Senior << 16) | Junior;
+
+			//  Test for end of stream
+			if (BufferedBits == 0 && StagePos == StageLen && bsBase.eos()) EndOfStream = true;
+
+			//  Return the string
+			return String;
+		}
+
+		//  peek
+		//
+		//  Returns the next bit string from the stream without consuming it
+		//
+		//  PARAMETERS
+		//
+		//		uint32_t			-	Size of the bit string to read
+		//		uint32_t&			-	Reference to the variable that receives the string
+		//
+		//	RETURNS
+		//
+		//		bool				-	true if the stream holds the whole string, false if it was padded with zeros
+		//
+		//	NOTES
+		//
+
+		bool peek(uint32_t Bits, uint32_t& String)
+		{
+			//  Envelope check
+			String = 0;
+			if (Bits > 32) return false;
+			if (Bits == 0) return true;
+
+			//  Top up the bit buffer if it cannot supply the string
+			if (Bits > BufferedBits) refill();
+
+			//  Return the string leaving the bit buffer unchanged
+			String = uint32_t(BitBuffer) & (0xFFFFFFFF >> (32 - Bits));
+			return Bits <= BufferedBits;
 		}
 
 		//  next
@@ -1810,22 +2049,26 @@ namespace xymorg {
 		//  PARAMETERS
 		//
 		//		uint32_t			-	Bit string to be written
-		//		uint32_t			-	Size of the bit string to write	
-		// 
+		//		uint32_t			-	Size of the bit string to write
+		//
 		//	RETURNS
 		//
 		//	NOTES
 		//
+		//	1.	Bits in the string above the requested size are ignored.
+		//
 
 		void next(uint32_t Out, uint32_t Bits)
 		{
-			if (Bits > 32) return;
-			if (Bits > 16)
-			{
-				next16(static_cast<unsigned short>(Out & 0x0000FFFF), 16);
-				next16(static_cast<unsigned short>(Out >> 16), Bits - 16);
-			}
-			else next16(static_cast<unsigned short>(Out), Bits);
+			if (Bits > 32 || Bits == 0) return;
+
+			//  Empty the bit buffer if it cannot hold the string
+			if ((BufferedBits + Bits) > 64) spill();
+
+			//  Append the string above the bits already buffered
+			BitBuffer |= uint64_t(Out & (0xFFFFFFFF >> (32 - Bits))) << BufferedBits;
+			BufferedBits += Bits;
+			BitsWritten += Bits;
 			return;
 		}
 
@@ -1842,18 +2085,17 @@ namespace xymorg {
 
 		void flush() {
 
-			//  Output any complete BYTES
-			while (BitOffset > 0)
-			{
-				bsBase.next(ByteArray[2]);
-				ByteArray[2] = ByteArray[1];
-				ByteArray[1] = ByteArray[0];
-				ByteArray[0] = 0;
-				if (BitOffset < 8) BitOffset = 0;
-				else BitOffset -= 8;
+			//  Stage any complete BYTES followed by the zero padded partial BYTE
+			spill();
+			if (BufferedBits > 0) {
+				if (StagePos == StageSize) drain();
+				Stage[StagePos++] = BYTE(BitBuffer);
+				BitBuffer = 0;
+				BufferedBits = 0;
 			}
 
-			//  Signal flush on the underlying ByteStream
+			//  Write the stage to the underlying ByteStream and signal flush
+			drain();
 			bsBase.flush();
 
 			return;
@@ -1889,12 +2131,17 @@ namespace xymorg {
 		//*																													*
 		//*******************************************************************************************************************
 
+		static const size_t	StageSize = 256;													//  Size of the byte stage
+
 		ByteStream&			bsBase;																//  Underlying Byte Stream
-		uint32_t			BitOffset;															//  Offset of the next Bit to be read/written
+		uint64_t			BitBuffer;															//  Bit buffer (right aligned)
+		uint32_t			BufferedBits;														//  Count of buffered bits
 		uint32_t			BitsRead;															//  Bits read (consumed) from the stream
 		uint32_t			BitsWritten;														//  Bits written to the stream
-		BYTE				ByteArray[3];														//  Array of bytes read from the underlying stream
-		uint32_t			BufferedBits;														//  Count of buffered bits
+		BYTE				Stage[StageSize];													//  Bytes staged to/from the underlying stream
+		size_t				StagePos;															//  Offset of the next staged byte
+		size_t				StageLen;															//  Length of the staged bytes (reading)
+		bool				Writer;																//  Stream is conditioned for writing
 		bool				EndOfStream;														//  End of stream indicator
 
 		//*******************************************************************************************************************
@@ -1903,107 +2150,142 @@ namespace xymorg {
 		//*																													*
 		//*******************************************************************************************************************
 
-		//  next16
+		//  refill
 		//
-		//  Reads the next bit string (up to 16 bits) from the stream
+		//  Tops up the bit buffer from the stage, the stage is replenished from the underlying stream when less than
+		//  a whole word remains.
 		//
 		//  PARAMETERS
 		//
-		//		uint16_t			-	Size of the bit string to read	
-		// 
 		//	RETURNS
 		//
-		//		uint16_t			-	String
-		//
 		//	NOTES
 		//
+		//	1.	A word load may leave bits from the following byte above the buffered bits, these are identical to
+		//		the bits that the next load will merge.
+		//
 
-		uint16_t next16(uint32_t Bits)
-		{
-			uint32_t			Acc = 0;														//  Accumulator for the bit string
-
-			//  Build the bitstring for the next n Bits
-
-			Acc = ByteArray[2];
-			Acc <<= 8;
-			Acc |= ByteArray[1];
-			Acc <<= 8;
-			Acc |= ByteArray[0];
-			Acc >>= BitOffset;
-			Acc <<= (24 - Bits);
-			Acc &= 0x00FFFFFF;
-			Acc >>= (24 - Bits);
-
-			BitOffset += Bits;
-			BitsRead += Bits;
-			if (Bits > BufferedBits) BufferedBits = 0;
-			else BufferedBits -= Bits;
-
-			//  Replace any whole bytes that have been consumed
-			while (BitOffset >= 8)
-			{
-				ByteArray[0] = ByteArray[1];
-				ByteArray[1] = ByteArray[2];
-				if (!bsBase.eos())
-				{
-					ByteArray[2] = bsBase.next();
+		void refill() {
+			size_t				Whole = 0;														//  Whole bytes taken from the word
+
+			//  Replenish the stage when less than a word remains
+			if ((StageLen - StagePos) < 8 && !bsBase.eos()) {
+				memmove(Stage, Stage + StagePos, StageLen - StagePos);
+				StageLen -= StagePos;
+				StagePos = 0;
+				StageLen += bsBase.readSpan(Stage + StageLen, StageSize - StageLen);
+			}
+
+			//  Merge a whole word when one is available otherwise merge the remaining bytes
+			if ((StageLen - StagePos) >= 8) {
+				BitBuffer |= loadWord(Stage + StagePos) << BufferedBits;
+				Whole = (63 - BufferedBits) >> 3;
+				StagePos += Whole;
+				BufferedBits += uint32_t(Whole * 8);
+			}
+			else {
+				while (BufferedBits <= 56 && StagePos < StageLen) {
+					BitBuffer |= uint64_t(Stage[StagePos++]) << BufferedBits;
 					BufferedBits += 8;
 				}
-				else ByteArray[2] = 0;
-				BitOffset -= 8;
 			}
 
-			//  Test for end of string
-			if (bsBase.eos() && BufferedBits == 0) EndOfStream = true;
+			//  Return to caller
+			return;
+		}
 
-			//  Return the string
-			return uint16_t(Acc);
+		//  spill
+		//
+		//  Moves the complete bytes in the bit buffer to the stage.
+		//
+		//  PARAMETERS
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+
+		void spill() {
+			size_t				Whole = BufferedBits >> 3;										//  Whole bytes in the bit buffer
+
+			//  Store the whole word and keep the complete bytes
+			if ((StagePos + 8) > StageSize) drain();
+			storeWord(Stage + StagePos, BitBuffer);
+			StagePos += Whole;
+			if (Whole == 8) BitBuffer = 0;
+			else BitBuffer >>= (Whole * 8);
+			BufferedBits -= uint32_t(Whole * 8);
+
+			//  Return to caller
+			return;
 		}
 
-		//  next16
+		//  drain
 		//
-		//  Writes the next bit string (up to 16 bits) to the stream
+		//  Writes the stage to the underlying stream.
 		//
 		//  PARAMETERS
 		//
-		//		uint16_t			-   Value to be written
-		//		size_t				-	Size of the bit string to read	
-		// 
 		//	RETURNS
 		//
 		//	NOTES
 		//
 
-		void next16(uint16_t Out, uint32_t Bits)
-		{
-			unsigned int			Acc = 0;									//  Bit string accumulator
+		void drain() {
 
-			//  Load the existing BYTE array into the accumulator
-			Acc = ByteArray[0];
-			Acc <<= 8;
-			Acc |= ByteArray[1];
-			Acc <<= 8;
-			Acc |= ByteArray[2];
+			if (StagePos > 0) bsBase.writeSpan(Stage, StagePos);
+			StagePos = 0;
 
-			//  Accumulate the output bits
-			Acc |= (Out << BitOffset);
+			//  Test for End-Of-Stream
+			if (bsBase.eos()) EndOfStream = true;
+			return;
+		}
 
-			//  Store back the accumulated value
-			ByteArray[2] = BYTE(Acc & 0x000000FF);
-			ByteArray[1] = BYTE((Acc >> 8) & 0x000000FF);
-			ByteArray[0] = BYTE((Acc >> 16) & 0x000000FF);
+		//  loadWord
+		//
+		//  Loads a little-endian word from the passed location.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*				-	Pointer to the first of 8 bytes
+		//
+		//	RETURNS
+		//
+		//		uint64_t			-	The word
+		//
+		//	NOTES
+		//
+		//	1.	The shift and merge form is compiled as a single unaligned load on common platforms.
+		//
 
-			BitOffset += Bits;
+		static uint64_t loadWord(const BYTE* pWord) {
+			return uint64_t(pWord[0]) | (uint64_t(pWord[1]) << 8) | (uint64_t(pWord[2]) << 16) | (uint64_t(pWord[3]) << 24) |
+				(uint64_t(pWord[4]) << 32) | (uint64_t(pWord[5]) << 40) | (uint64_t(pWord[6]) << 48) | (uint64_t(pWord[7]) << 56);
+		}
 
-			//  Output any complete BYTES
-			while (BitOffset >= 8)
-			{
-				bsBase.next(ByteArray[2]);
-				ByteArray[2] = ByteArray[1];
-				ByteArray[1] = ByteArray[0];
-				ByteArray[0] = 0;
-				BitOffset -= 8;
-			}
+		//  storeWord
+		//
+		//  Stores a word little-endian at the passed location.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*				-	Pointer to the first of 8 bytes
+		//		uint64_t			-	The word
+		//
+		//	RETURNS
+		//
+		//	NOTES
+		//
+
+		static void storeWord(BYTE* pWord, uint64_t Word) {
+			pWord[0] = BYTE(Word);
+			pWord[1] = BYTE(Word >> 8);
+			pWord[2] = BYTE(Word >> 16);
+			pWord[3] = BYTE(Word >> 24);
+			pWord[4] = BYTE(Word >> 32);
+			pWord[5] = BYTE(Word >> 40);
+			pWord[6] = BYTE(Word >> 48);
+			pWord[7] = BYTE(Word >> 56);
 			return;
 		}
 	};
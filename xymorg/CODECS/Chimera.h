@@ -3,10 +3,10 @@
 //*																													*
 //*   File:       Chimera.h																							*
 //*   Suite:      xymorg Integration - Chimera CODEC																*
-//*   Version:    2.1.0	  Build:  03																				*
+//*   Version:    2.6.1	  Build:  09																				*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2016 - 2023 Ian J. Tree																				*
+//*   Copyright 2016 - 2026 Ian J. Tree																				*
 //*******************************************************************************************************************
 //*	Chimera.h																										*
 //*																													*
@@ -18,6 +18,15 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
+//*	1.		Repeat strings (LZ77) are located through hash chains on the first 4 bytes of each position, the number	*
+//*			of candidates compared is set by setMatchDepth() (0 compares every candidate in the window).			*
+//*	2.		compressFramed() splits the input into independently compressed blocks that are compressed in parallel,	*
+//*			the frame carries a block index so that blocks can be decompressed in parallel or individually.			*
+//*	3.		Huffman codes are decoded up to 10 bits at a time through a table that follows the adaptive tree,		*
+//*			symbols are located for encoding through a hashed lookup table.											*
+//*	4.		StreamEncoder and StreamDecoder compress and decompress incrementally (feed/drain) holding one block	*
+//*			at a time, flush points end the current block so that the content fed so far can be decoded.			*
+//*	5.		setLevel() selects a preset configuration from 1 (fastest) to 9 (best compression).						*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -28,6 +37,12 @@
 //* 2.1.0 - 27/02/2018   -  STRREF Offset handling changed															*
 //*							Greedy Algorithm Defeating																*
 //*							DICTREF encoding																		*
+//* 2.2.0 - 19/10/2026   -  Hash chain repeat string match finder													*
+//* 2.3.0 - 19/10/2026   -  Framed block parallel compression														*
+//* 2.4.0 - 19/10/2026   -  Table driven Huffman decoding and hashed ELUT											*
+//* 2.5.0 - 19/10/2026   -  Streaming (incremental) compression and decompression									*
+//* 2.6.0 - 19/10/2026   -  Compression levels, bounded RLE runs													*
+//* 2.6.1 - 19/10/2026   -  Frame workers report through private streams											*
 //*																													*
 //*******************************************************************************************************************
 
@@ -39,6 +54,12 @@
 #include	"../consts.h"
 #include	"Bitstreams.h"																			//  Bit/Byte Stream classes
 
+//  Additional Language Headers
+#include	<atomic>																				//  Frame block dispatch
+#include	<sstream>																				//  Frame worker reports
+#include	<system_error>																			//  Frame worker creation failures
+#include	<thread>																				//  Frame worker threads
+
 //  xymorg namespace
 namespace xymorg {
 
@@ -62,9 +83,19 @@ namespace xymorg {
 		class AdaptiveHuffmanTree;
 		class OffsetCODEC;
 		class DictRefCODEC;
+		class MatchFinder;
 
 	public:
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Nested Classes                                                                                         *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class StreamEncoder;
+		class StreamDecoder;
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Public Constants                                                                                              *
@@ -81,6 +112,10 @@ namespace xymorg {
 		static const uint32_t	EOS = 262;															//  End-Of-Stream code
 
 		static const USHORT		DefaultWindowSize = 4096;											//  Default window size
+		static const size_t		DefaultMatchDepth = 128;											//  Default repeat string search depth
+		static const size_t		DefaultLazyLength = SIZE_MAX;										//  Default lazy evaluation limit (always)
+		static const size_t		DefaultBlockSize = 1024 * 1024;										//  Default frame block size
+		static const size_t		DefaultStreamBlockSize = 256 * 1024;								//  Default streaming block size
 
 		static const SWITCHES	LZPermitted = 0x00000001;											//  Permit Lempel-Ziv (77)
 		static const SWITCHES	DICPermitted = 0x00000002;											//  Permit (LZ) dictionary
@@ -89,6 +124,9 @@ namespace xymorg {
 		static const SWITCHES	MSPermitted = 0x00000010;											//  Permit Modal Streaming
 		static const SWITCHES	AllPermitted = 0x00000007;											//  All options permitted
 
+		static const int		MinLevel = 1;														//  Fastest compression level
+		static const int		MaxLevel = 9;														//  Best compression level
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Public Structures                                                                                             *
@@ -158,6 +196,8 @@ namespace xymorg {
 
 			//  Set the default configuration
 			WindowSize = DefaultWindowSize;
+			MatchDepth = DefaultMatchDepth;
+			LazyLength = DefaultLazyLength;
 			PermittedOptions = AllPermitted;
 			StatsTrace = false;
 			DebugTrace = false;
@@ -190,6 +230,8 @@ namespace xymorg {
 
 			//  Set the default configuration
 			WindowSize = DefaultWindowSize;
+			MatchDepth = DefaultMatchDepth;
+			LazyLength = DefaultLazyLength;
 			PermittedOptions = ConfigOpts;
 			StatsTrace = false;
 			DebugTrace = false;
@@ -289,6 +331,7 @@ namespace xymorg {
 			AdaptiveHuffmanTree		Excoder(AlphabetSize, WindowSize, os);							//  Adaptive huffman tree to use for encoding Extended Symbols
 			OffsetCODEC		OffCoder(os);															//  Adaptive offset encoder/decoder
 			DictRefCODEC	Dictionary(os);															//  Dictionary store and encode/decoder
+			MatchFinder		Finder(MatchDepth);														//  Repeat string match finder
 			MSBitStream		OBS(bsOut, true);														//  Output Bit Stream
 
 			//  Clear the statistics block
@@ -341,7 +384,7 @@ namespace xymorg {
 				//
 
 				if (PermittedOptions & LZPermitted) {
-					TrialLength = findLongestNewString(bsIn, StringOffset);
+					TrialLength = findLongestNewString(bsIn, StringOffset, Finder);
 					if (TrialLength > (BestLength + 2)) {
 						BestOption = 2;
 						BestLength = TrialLength;
@@ -367,7 +410,7 @@ namespace xymorg {
 				//
 
 				if (BestLength == 0 && PermittedOptions & XSPermitted) {
-					BestLength = findExtendedSymbol(bsIn, Excoder, XSCode, Dictionary);
+					BestLength = findExtendedSymbol(bsIn, Excoder, XSCode, Dictionary, Finder);
 					if (BestLength == 3) BestOption = 6;
 					else if (BestLength == 2) BestOption = 7;
 				}
@@ -376,9 +419,9 @@ namespace xymorg {
 				//  Defeat of the greedy nature of the algorithm.
 				//  
 
-				if (BestLength > 0) {
+				if (BestLength > 0 && BestLength < LazyLength) {
 					//  If we could do better by dropping the current chunk then do so
-					if (canDoBetter(bsIn, BestLength, Dictionary)) {
+					if (canDoBetter(bsIn, BestLength, Dictionary, Finder)) {
 						BestOption = 0;
 						BestLength = 0;
 					}
@@ -1046,8 +1089,15 @@ namespace xymorg {
 						}
 						ChunkLen += 3;
 
+						//  A reference outside the content emitted so far can only come from a damaged stream
+						if (StrOffset == 0 || StrOffset > OutOffset) {
+							os << "ERROR: A string reference (offset: -" << StrOffset << ") at Offset: " << OutOffset << " is invalid, the compressed stream is invalid or damaged." << std::endl;
+							Stats.BytesIn = bsIn.getBytesRead();
+							return 0;
+						}
+
 						//  Emit the string to the output stream
-						for (size_t cIndex = 0; cIndex < ChunkLen; cIndex++) bsOut.next(pOutBuffer[OutOffset - StrOffset + cIndex]);
+						for (size_t cIndex = 0; cIndex < ChunkLen && !bsOut.eos(); cIndex++) bsOut.next(pOutBuffer[OutOffset - StrOffset + cIndex]);
 
 						//  Add the string to the dictionary - if enabled
 						if (PermittedOptions & DICPermitted) Dictionary.addToDictionary(OutOffset, ChunkLen);
@@ -1200,6 +1250,301 @@ namespace xymorg {
 			return bsOut.getBytesWritten();
 		}
 
+		//
+		//  Framed (Block Parallel) Functions
+		//  =================================
+		//
+
+		//  compressFramed
+		//
+		//  Compresses the content of an input ByteStream as a frame of independently compressed blocks, the blocks are
+		//  compressed concurrently.
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream
+		//		ByteStream&		-		Reference to the output ByteStream
+		//		size_t			-		Size of the blocks (bytes)
+		//		size_t			-		Number of threads to use, 0 uses one per hardware thread
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of bytes written to the output bytestream, 0 if the frame could not be built
+		//
+		//  NOTES
+		//
+		//	1.		The frame starts with a header and a block index that allows the blocks to be located without
+		//			decompressing the preceding blocks (see decompressFrameBlock()).
+		//	2.		Blocks that do not compress are stored as is.
+		//	3.		Each block has its own adaptive model, small blocks reduce the compression ratio.
+		//
+
+		size_t	compressFramed(ByteStream& bsIn, ByteStream& bsOut, size_t BlockSize = DefaultBlockSize, size_t Threads = 0) {
+			BYTE*			pIn = bsIn.getReadAddress();											//  Input content
+			size_t			InLen = bsIn.getRemainder();											//  Length of the input
+			size_t			Blocks = 0;																//  Number of blocks
+			FrameBlock*		pBlocks = nullptr;														//  Block table
+			BYTE*			pHeader = nullptr;														//  Frame header and index
+			size_t			HdrLen = 0;																//  Length of the header and index
+			bool			Complete = true;														//  All blocks were compressed
+
+			//  Clear the statistics block
+			memset(&Stats, 0, sizeof(CStats));
+
+			//  Validate the block size
+			if (BlockSize < MinBlockSize) BlockSize = MinBlockSize;
+			if (BlockSize > MaxBlockSize) BlockSize = MaxBlockSize;
+
+			//
+			//  Build the block table over the input
+			//
+
+			Blocks = (InLen + BlockSize - 1) / BlockSize;
+			if (Blocks > 0) {
+				pBlocks = (FrameBlock*)malloc(Blocks * sizeof(FrameBlock));
+				if (pBlocks == nullptr) return 0;
+				memset(pBlocks, 0, Blocks * sizeof(FrameBlock));
+				for (size_t BX = 0; BX < Blocks; BX++) {
+					pBlocks[BX].pRaw = pIn + (BX * BlockSize);
+					pBlocks[BX].RLen = (BX == Blocks - 1) ? InLen - (BX * BlockSize) : BlockSize;
+				}
+			}
+
+			//  Compress the blocks
+			runFrameWorkers(pBlocks, Blocks, Threads, PermittedOptions, WindowSize, true);
+
+			//
+			//  Build the header and index, then emit it followed by the blocks
+			//
+
+			HdrLen = FrameHeaderSize + (Blocks * FrameIndexSize);
+			pHeader = (BYTE*)malloc(HdrLen);
+			if (pHeader == nullptr) Complete = false;
+			for (size_t BX = 0; BX < Blocks; BX++) if (!pBlocks[BX].Done) Complete = false;
+
+			if (Complete) {
+				memcpy(pHeader, "CHF1", 4);
+				putFrameValue(pHeader + 4, PermittedOptions, 4);
+				putFrameValue(pHeader + 8, WindowSize, 2);
+				putFrameValue(pHeader + 10, 0, 2);
+				putFrameValue(pHeader + 12, BlockSize, 4);
+				putFrameValue(pHeader + 16, Blocks, 4);
+				putFrameValue(pHeader + 20, InLen, 8);
+				for (size_t BX = 0; BX < Blocks; BX++) {
+					putFrameValue(pHeader + FrameHeaderSize + (BX * FrameIndexSize), pBlocks[BX].CLen, 4);
+					putFrameValue(pHeader + FrameHeaderSize + (BX * FrameIndexSize) + 4, pBlocks[BX].RLen, 4);
+				}
+
+				putBytes(bsOut, pHeader, HdrLen);
+				for (size_t BX = 0; BX < Blocks; BX++) {
+					if (pBlocks[BX].pComp == nullptr) putBytes(bsOut, pBlocks[BX].pRaw, pBlocks[BX].RLen);
+					else putBytes(bsOut, pBlocks[BX].pComp, pBlocks[BX].CLen);
+				}
+				bsIn.advance(InLen);
+			}
+			else os << "ERROR: The Chimera frame could not be built, storage is exhausted." << std::endl;
+
+			//  Free the compressed blocks and the tables
+			for (size_t BX = 0; BX < Blocks; BX++) if (pBlocks[BX].pComp != nullptr) free(pBlocks[BX].pComp);
+			if (pBlocks != nullptr) free(pBlocks);
+			if (pHeader != nullptr) free(pHeader);
+
+			//  Bookeeping
+			Stats.BytesIn = InLen;
+			Stats.BytesOut = Complete ? bsOut.getBytesWritten() : 0;
+
+			//  Return to caller
+			return Stats.BytesOut;
+		}
+
+		//  decompressFramed
+		//
+		//  Decompresses a frame of independently compressed blocks from an input ByteStream into another ByteStream,
+		//  the blocks are decompressed concurrently.
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream
+		//		ByteStream&		-		Reference to the output ByteStream
+		//		size_t			-		Number of threads to use, 0 uses one per hardware thread
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of bytes written to the output bytestream, 0 if the frame is invalid or damaged
+		//
+		//  NOTES
+		//
+		//	1.		The options and window size are taken from the frame header.
+		//
+
+		size_t	decompressFramed(ByteStream& bsIn, ByteStream& bsOut, size_t Threads = 0) {
+			FrameInfo		Frame = {};																//  Frame description
+			FrameBlock*		pBlocks = nullptr;														//  Block table
+			BYTE*			pOut = nullptr;															//  Decompressed content
+			bool			Complete = true;														//  All blocks were decompressed
+
+			//  Clear the statistics block
+			memset(&Stats, 0, sizeof(CStats));
+
+			//  Validate the frame
+			if (!readFrame(bsIn.getReadAddress(), bsIn.getRemainder(), Frame)) {
+				os << "ERROR: The input stream is not a valid Chimera frame." << std::endl;
+				return 0;
+			}
+			if (Frame.Blocks == 0) {
+				bsIn.advance(Frame.FrameLen);
+				return 0;
+			}
+
+			//
+			//  Build the block table over the frame and the output
+			//
+
+			pBlocks = (FrameBlock*)malloc(Frame.Blocks * sizeof(FrameBlock));
+			pOut = (BYTE*)malloc(Frame.RawSize);
+			if (pBlocks == nullptr || pOut == nullptr) {
+				if (pBlocks != nullptr) free(pBlocks);
+				if (pOut != nullptr) free(pOut);
+				os << "ERROR: The Chimera frame could not be decompressed, storage is exhausted." << std::endl;
+				return 0;
+			}
+			locateFrameBlocks(Frame, pBlocks, pOut);
+
+			//  Decompress the blocks
+			runFrameWorkers(pBlocks, Frame.Blocks, Threads, Frame.Options, Frame.Window, false);
+			for (size_t BX = 0; BX < Frame.Blocks; BX++) if (!pBlocks[BX].Done) Complete = false;
+
+			//  Emit the content
+			if (Complete) {
+				putBytes(bsOut, pOut, Frame.RawSize);
+				bsIn.advance(Frame.FrameLen);
+			}
+			else os << "ERROR: One or more blocks of the Chimera frame are invalid or damaged." << std::endl;
+
+			free(pBlocks);
+			free(pOut);
+
+			//  Bookeeping
+			Stats.BytesIn = Frame.FrameLen;
+			Stats.BytesOut = Complete ? Frame.RawSize : 0;
+
+			//  Return to caller
+			return Stats.BytesOut;
+		}
+
+		//  decompressFrameBlock
+		//
+		//  Decompresses a single block from a frame in an input ByteStream into another ByteStream.
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream (positioned at the start of the frame)
+		//		size_t			-		Index of the block to decompress
+		//		ByteStream&		-		Reference to the output ByteStream
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of bytes written to the output bytestream, 0 if the block could not be decompressed
+		//
+		//  NOTES
+		//
+		//	1.		Block n holds the content starting at offset n * block size (getFrameBlockSize()).
+		//	2.		The position of the input stream is unchanged.
+		//
+
+		size_t	decompressFrameBlock(ByteStream& bsIn, size_t BlockNo, ByteStream& bsOut) {
+			FrameInfo		Frame = {};																//  Frame description
+			FrameBlock		Block = {};																//  Selected block
+			size_t			Offset = 0;																//  Offset of the block in the frame data
+
+			//  Validate the frame and block
+			if (!readFrame(bsIn.getReadAddress(), bsIn.getRemainder(), Frame)) return 0;
+			if (BlockNo >= Frame.Blocks) return 0;
+
+			//  Locate the block
+			for (size_t BX = 0; BX < BlockNo; BX++) Offset += getFrameValue(Frame.pIndex + (BX * FrameIndexSize), 4);
+			Block.pComp = const_cast<BYTE*>(Frame.pData) + Offset;
+			Block.CLen = getFrameValue(Frame.pIndex + (BlockNo * FrameIndexSize), 4);
+			Block.RLen = getFrameValue(Frame.pIndex + (BlockNo * FrameIndexSize) + 4, 4);
+			Block.pRaw = (BYTE*)malloc(Block.RLen);
+			if (Block.pRaw == nullptr) return 0;
+
+			//  Decompress the block and emit the content
+			codeFrameBlock(Block, Frame.Options, Frame.Window, false, os);
+			if (Block.Done) putBytes(bsOut, Block.pRaw, Block.RLen);
+			free(Block.pRaw);
+			return Block.Done ? Block.RLen : 0;
+		}
+
+		//  getFrameBlocks
+		//
+		//  Returns the number of blocks in the frame in an input ByteStream.
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream (positioned at the start of the frame)
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Number of blocks in the frame, 0 if the stream is not a valid frame
+		//
+		//  NOTES
+		//
+
+		size_t	getFrameBlocks(ByteStream& bsIn) {
+			FrameInfo		Frame = {};																//  Frame description
+
+			if (!readFrame(bsIn.getReadAddress(), bsIn.getRemainder(), Frame)) return 0;
+			return Frame.Blocks;
+		}
+
+		//  getFrameBlockSize
+		//
+		//  Returns the block size of the frame in an input ByteStream.
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream (positioned at the start of the frame)
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Block size of the frame, 0 if the stream is not a valid frame
+		//
+		//  NOTES
+		//
+
+		size_t	getFrameBlockSize(ByteStream& bsIn) {
+			FrameInfo		Frame = {};																//  Frame description
+
+			if (!readFrame(bsIn.getReadAddress(), bsIn.getRemainder(), Frame)) return 0;
+			return Frame.BlockSize;
+		}
+
+		//  getFrameLength
+		//
+		//  Returns the length of a frame held in memory.
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Const pointer to the start of the frame
+		//		size_t			-		Length of the memory holding the frame
+		//
+		//  RETURNS
+		//
+		//		size_t			-		Length of the frame, 0 if the memory does not start with a valid frame
+		//
+		//  NOTES
+		//
+		//	1.		The header and index are validated, the block content is not.
+		//
+
+		static size_t	getFrameLength(const BYTE* pFrame, size_t Len) {
+			FrameInfo		Frame = {};																//  Frame description
+
+			if (!readFrame(pFrame, Len, Frame)) return 0;
+			return Frame.FrameLen;
+		}
+
 		//
 		//  Configuration Control Functions
 		//  ===============================
@@ -1239,6 +1584,83 @@ namespace xymorg {
 
 		void	permitOptions(SWITCHES NewOptions) { PermittedOptions = NewOptions; return; }
 
+		//  setMatchDepth
+		//
+		//  Sets the maximum number of candidate strings that are compared when searching for a repeat string (LZ77).
+		//  Deeper searches find longer strings at the cost of compression speed, the decompression is unaffected.
+		//
+		//  PARAMETERS
+		//
+		//		size_t				-		Maximum number of candidates to compare, 0 compares every candidate in the window
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//
+
+		void	setMatchDepth(size_t NewDepth) { MatchDepth = NewDepth; return; }
+
+		//  setLazyLength
+		//
+		//  Sets the limit for lazy evaluation, a chunk that is selected for encoding is only dropped in favour of a longer
+		//  chunk at the next position (see canDoBetter()) when it is shorter than the limit. The decompression is unaffected.
+		//
+		//  PARAMETERS
+		//
+		//		size_t				-		Lazy evaluation limit, 0 disables lazy evaluation
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//
+
+		void	setLazyLength(size_t NewLength) { LazyLength = NewLength; return; }
+
+		//  setLevel
+		//
+		//  Sets the configuration for a compression level from 1 (fastest) to 9 (best compression).
+		//
+		//  PARAMETERS
+		//
+		//		int					-		Compression level (clamped to MinLevel - MaxLevel)
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//	1.		The level sets the permitted options, window size, match depth and lazy evaluation limit.
+		//	2.		Only the permitted options and window size affect decompression, a paired decompression must use the
+		//			same level (frames and streams carry the options and window size in their headers).
+		//	3.		Levels 1 - 8 use repeat strings (LZ77) and (from level 3) RLE with a progressively deeper search,
+		//			level 9 adds the dictionary and is equivalent to the default configuration.
+		//	4.		Extended symbols are not used by any level.
+		//
+
+		void	setLevel(int Level) {
+			static const LevelPreset	Presets[MaxLevel] = {
+				{ LZPermitted, 4, 0 },
+				{ LZPermitted, 8, 0 },
+				{ LZPermitted | RLEPermitted, 16, 0 },
+				{ LZPermitted | RLEPermitted, 16, 16 },
+				{ LZPermitted | RLEPermitted, 32, 32 },
+				{ LZPermitted | RLEPermitted, 128, DefaultLazyLength },
+				{ LZPermitted | RLEPermitted, 1024, DefaultLazyLength },
+				{ LZPermitted | RLEPermitted, 0, DefaultLazyLength },
+				{ AllPermitted, DefaultMatchDepth, DefaultLazyLength }
+			};
+
+			if (Level < MinLevel) Level = MinLevel;
+			if (Level > MaxLevel) Level = MaxLevel;
+
+			PermittedOptions = Presets[Level - 1].Options;
+			WindowSize = DefaultWindowSize;
+			MatchDepth = Presets[Level - 1].Depth;
+			LazyLength = Presets[Level - 1].Lazy;
+			return;
+		}
+
 		//
 		//  Debugging Control Functions
 		//  ===========================
@@ -1343,8 +1765,84 @@ namespace xymorg {
 			return;
 		}
 
+		//  getStatistics
+		//
+		//  This function will return the accumulated statistics from the last function
+		//
+		//  PARAMETERS
+		//
+		//
+		//  RETURNS
+		//
+		//		CStats&			-		Const reference to the statistics
+		//
+		//  NOTES
+		//
+		//
+
+		const CStats&	getStatistics() const { return Stats; }
+
 	private:
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Constants                                                                                             *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		static const size_t		MinBlockSize = 4096;												//  Minimum frame block size
+		static const size_t		MaxBlockSize = 256 * 1024 * 1024;									//  Maximum frame block size
+		static const size_t		FrameHeaderSize = 28;												//  Size of the frame header
+		static const size_t		FrameIndexSize = 8;													//  Size of a frame index entry
+		static const size_t		StreamHeaderSize = 16;												//  Size of the stream header
+		static const size_t		StreamRecordSize = 8;												//  Size of a stream block record header
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Structures                                                                                            *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//
+		//   LevelPreset	-		Configuration for a compression level
+		//
+
+		typedef struct LevelPreset {
+			SWITCHES		Options;																//  Permitted options
+			size_t			Depth;																	//  Repeat string search depth
+			size_t			Lazy;																	//  Lazy evaluation limit
+		} LevelPreset;
+
+		//
+		//   FrameBlock		-		Block of a frame being compressed or decompressed
+		//
+
+		typedef struct FrameBlock {
+			BYTE*			pRaw;																	//  Block content
+			size_t			RLen;																	//  Length of the content
+			BYTE*			pComp;																	//  Compressed block (nullptr if stored)
+			size_t			CLen;																	//  Length of the compressed block
+			bool			Done;																	//  Block has been processed
+		} FrameBlock;
+
+		//
+		//   FrameInfo		-		Description of a frame
+		//
+		//   Header:	"CHF1", Options (4), Window Size (2), Reserved (2), Block Size (4), Blocks (4), Content Size (8)
+		//   Index:		Compressed Length (4), Content Length (4) for each block, a block that is stored has equal lengths
+		//
+
+		typedef struct FrameInfo {
+			SWITCHES		Options;																//  Permitted options
+			USHORT			Window;																	//  Window size
+			size_t			BlockSize;																//  Block size
+			size_t			Blocks;																	//  Number of blocks
+			size_t			RawSize;																//  Content size
+			const BYTE*		pIndex;																	//  Block index
+			const BYTE*		pData;																	//  Start of the first block
+			size_t			FrameLen;																//  Length of the frame
+		} FrameInfo;
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Members                                                                                               *
@@ -1354,6 +1852,8 @@ namespace xymorg {
 		//  Consfiguration
 		std::ostream&	os;																			//  ostream for stats/debugging
 		USHORT			WindowSize;																	//  Adaption window size
+		size_t			MatchDepth;																	//  Repeat string search depth
+		size_t			LazyLength;																	//  Lazy evaluation limit
 		SWITCHES		PermittedOptions;															//  Permitted compression options
 
 		//  Debugging Controls
@@ -1381,6 +1881,7 @@ namespace xymorg {
 		//		ByteStream&		-		Reference to the input ByteStream
 		//		size_t			-		The current best length that will be emitted
 		//		DictRefCODEC&	-		Reference to the dictionary 
+		//		MatchFinder&	-		Reference to the repeat string match finder
 		//
 		//  RETURNS
 		//
@@ -1390,7 +1891,7 @@ namespace xymorg {
 		//
 		//
 
-		bool	canDoBetter(ByteStream& bsIn, size_t CurrentBest, DictRefCODEC& Dictionary) {
+		bool	canDoBetter(ByteStream& bsIn, size_t CurrentBest, DictRefCODEC& Dictionary, MatchFinder& Finder) {
 			size_t			BestLength = 0;															//  New best length
 			int				iDummy = 0;
 			USHORT			usDummy = 0;
@@ -1415,7 +1916,7 @@ namespace xymorg {
 			//
 
 			if (PermittedOptions & LZPermitted) {
-				BestLength = findLongestNewString(bsIn, usDummy);
+				BestLength = findLongestNewString(bsIn, usDummy, Finder);
 				if (BestLength > (CurrentBest + 1)) {
 					bsIn.retreat(1);
 					return true;
@@ -1440,87 +1941,371 @@ namespace xymorg {
 			return false;
 		}
 
-		//  emitSymbol
+		//  runFrameWorkers
 		//
-		//  This function will emit the passed extended symbol to the output stream
+		//  This function will compress or decompress the blocks of a frame using a set of worker threads
 		//
 		//  PARAMETERS
 		//
-		//		ByteStream&		-		Reference to the output ByteStream
-		//		uint32_t		-		The extended symbol to be emitted
+		//		FrameBlock*		-		Pointer to the block table
+		//		size_t			-		Number of blocks
+		//		size_t			-		Number of threads to use, 0 uses one per hardware thread
+		//		SWITCHES		-		Options for the blocks
+		//		USHORT			-		Window size for the blocks
+		//		bool			-		true to compress, false to decompress
 		//
 		//  RETURNS
 		//
 		//  NOTES
 		//
-		//
+		//	1.		The calling thread works on the blocks alongside the additional threads.
+		//	2.		Each thread reports to a private stream, the reports are written to the trace stream by the calling
+		//			thread once all of the threads have completed.
+		//	3.		If an additional thread cannot be started the blocks are processed by the threads that are running.
+		//
+
+		void	runFrameWorkers(FrameBlock* pBlocks, size_t Blocks, size_t Threads, SWITCHES Options, USHORT Window, bool Compressing) {
+			std::atomic<size_t>		NextBlock(0);													//  Next block to be processed
+			std::thread*			pWorkers = nullptr;												//  Additional worker threads
+			std::ostringstream*		pReports = nullptr;												//  Worker reports (one per thread)
+			size_t					Started = 0;													//  Additional threads started
+
+			if (Blocks == 0) return;
+
+			//  Determine the number of threads
+			if (Threads == 0) Threads = std::thread::hardware_concurrency();
+			if (Threads == 0) Threads = 1;
+			if (Threads > Blocks) Threads = Blocks;
+
+			//  Start the additional threads, the calling thread reports to the last stream
+			pReports = new std::ostringstream[Threads];
+			if (Threads > 1) {
+				pWorkers = new std::thread[Threads - 1];
+				try {
+					while (Started < Threads - 1) {
+						pWorkers[Started] = std::thread(&Chimera::frameWorker, this, pBlocks, Blocks, std::ref(NextBlock), Options, Window, Compressing, std::ref(pReports[Started]));
+						Started++;
+					}
+				}
+				catch (const std::system_error& Err) {
+					pReports[Threads - 1] << "WARNING: Only " << Started << " of " << (Threads - 1) << " additional frame worker threads could be started (" << Err.what() << ")." << std::endl;
+				}
+			}
 
-		void	emitSymbol(ByteStream& bsOut, uint32_t XSCode) {
+			//  Work on the blocks in this thread
+			frameWorker(pBlocks, Blocks, NextBlock, Options, Window, Compressing, pReports[Threads - 1]);
 
-			//  Emit the code symbol(s)
-			if (XSCode >= (3 << 24)) bsOut.next(BYTE((XSCode & 0x00FF0000) >> 16));
-			if (XSCode >= (2 << 24)) bsOut.next(BYTE((XSCode & 0x0000FF00) >> 8));
-			bsOut.next(BYTE(XSCode & 0x000000FF));
+			//  Wait for the additional threads to complete
+			if (pWorkers != nullptr) {
+				for (size_t TX = 0; TX < Started; TX++) pWorkers[TX].join();
+				delete[] pWorkers;
+			}
+
+			//  Pass the reports to the trace stream
+			for (size_t TX = 0; TX < Threads; TX++) {
+				if (pReports[TX].tellp() > 0) os << pReports[TX].str();
+			}
+			delete[] pReports;
+
+			//  Return to caller
 			return;
 		}
 
-		//  findLongestNewString
+		//  frameWorker
 		//
-		//  This function will attempt to find the longest string within the already encoded byffer that matches the current input
+		//  This function is the worker for compressing or decompressing the blocks of a frame
 		//
 		//  PARAMETERS
 		//
-		//		ByteStream&		-		Reference to the input ByteStream
-		//		USHORT&			-		Reference to the offset back in the buffer to the matching string
+		//		FrameBlock*				-		Pointer to the block table
+		//		size_t					-		Number of blocks
+		//		std::atomic<size_t>&	-		Reference to the index of the next block to be processed
+		//		SWITCHES				-		Options for the blocks
+		//		USHORT					-		Window size for the blocks
+		//		bool					-		true to compress, false to decompress
+		//		std::ostream&			-		Reference to the private report stream of the worker
 		//
 		//  RETURNS
 		//
-		//		uint32_t		-		Length of the matching string
-		//
 		//  NOTES
 		//
-		//
 
-		uint32_t		findLongestNewString(ByteStream& bsIn, USHORT& StrOffset) {
-			size_t		WSz = 0;																			//  Search window size
-			BYTE*		pSOW = bsIn.getPreReadWindow(64 * 1024, WSz);										//  Pointer to the start of the window
-			BYTE*		pChunk = bsIn.getReadAddress();														//  Start of the chunk
-			size_t		ChunkLen = bsIn.getRemainder();														//  Length of the chunk
-			BYTE*		pBestString = nullptr;																//  Best string found so far
-			uint32_t	BestLen = 0;																		//  Best string length so far
-			uint32_t	cIndex = 0;																			//  Character compare index
-			size_t		MinStringLen = 4;																	//  Minimum string length
+		void	frameWorker(FrameBlock* pBlocks, size_t Blocks, std::atomic<size_t>& NextBlock, SWITCHES Options, USHORT Window, bool Compressing, std::ostream& Report) {
+			size_t		BX = NextBlock.fetch_add(1);														//  Block being processed
 
-			//  Clear the offset
-			StrOffset = 0;
+			while (BX < Blocks) {
+				codeFrameBlock(pBlocks[BX], Options, Window, Compressing, Report);
+				BX = NextBlock.fetch_add(1);
+			}
 
-			//  If there is insufficient window then exit
-			if (WindowSize < MinStringLen) return 0;
-
-			//  Search the window for matching strings
-			for (BYTE* pSearch = pChunk - MinStringLen; pSearch >= pSOW; pSearch--) {
-				//  Compare the first character of the search with the first character of the chunk
-				if (pSearch[0] == pChunk[0]) {
-					for (cIndex = 1; cIndex < 256 && cIndex < (ChunkLen - 1); cIndex++) {
-						if (pSearch[cIndex] != pChunk[cIndex]) break;
-					}
+			//  Return to caller
+			return;
+		}
 
-					//  See if this is a candidate string
-					if (cIndex >= MinStringLen) {
-						if (cIndex > BestLen) {
-							pBestString = pSearch;
-							BestLen = cIndex;
-						}
-					}
+		//  codeFrameBlock
+		//
+		//  This function will compress or decompress a single block of a frame
+		//
+		//  PARAMETERS
+		//
+		//		FrameBlock&		-		Reference to the block
+		//		SWITCHES		-		Options for the block
+		//		USHORT			-		Window size for the block
+		//		bool			-		true to compress, false to decompress
+		//		std::ostream&	-		Reference to the stream that receives the reports of the block CODEC
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//	1.		Each block is coded by a separate CODEC, the block is marked as done if it was coded successfully.
+		//	2.		A compressed block that is no smaller than the content is discarded, the block is stored as is.
+		//	3.		Blocks coded by frame worker threads must report to a stream that is private to the thread.
+		//
+
+		void	codeFrameBlock(FrameBlock& Block, SWITCHES Options, USHORT Window, bool Compressing, std::ostream& Report) {
+			Chimera		Coder(Options, Report);																//  Block CODEC
+
+			Coder.setWindowSize(Window);
+			Coder.setMatchDepth(MatchDepth);
+			Coder.setLazyLength(LazyLength);
+
+			if (Compressing) {
+				ByteStream		bsBlockIn(Block.pRaw, Block.RLen);											//  Block content
+				ByteStream		bsBlockOut((Block.RLen / 2) + 1024, 64 * 1024);								//  Compressed block
+
+				Coder.compress(bsBlockIn, bsBlockOut);
+				Block.pComp = bsBlockOut.acquireBuffer(Block.CLen);
+				if (Block.pComp == nullptr) return;
+
+				//  Store the block if it did not compress
+				if (Block.CLen >= Block.RLen) {
+					free(Block.pComp);
+					Block.pComp = nullptr;
+					Block.CLen = Block.RLen;
+				}
+			}
+			else {
+
+				//  Stored blocks are copied as is
+				if (Block.CLen == Block.RLen) memcpy(Block.pRaw, Block.pComp, Block.RLen);
+				else {
+					ByteStream		bsBlockIn(Block.pComp, Block.CLen);										//  Compressed block
+					ByteStream		bsBlockOut(Block.pRaw, Block.RLen);										//  Block content
+
+					if (Coder.decompress(bsBlockIn, bsBlockOut) != Block.RLen) return;
 				}
 			}
 
-			//  If no match was found indicate this to the caller
-			if (BestLen == 0) return 0;
+			//  Mark the block as done
+			Block.Done = true;
+			return;
+		}
+
+		//  locateFrameBlocks
+		//
+		//  This function will build the block table for decompressing a frame
+		//
+		//  PARAMETERS
+		//
+		//		FrameInfo&		-		Reference to the frame description
+		//		FrameBlock*		-		Pointer to the block table
+		//		BYTE*			-		Pointer to the buffer for the decompressed content
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		void	locateFrameBlocks(FrameInfo& Frame, FrameBlock* pBlocks, BYTE* pOut) {
+			size_t		CPos = 0;																			//  Position in the frame data
+			size_t		RPos = 0;																			//  Position in the content
+
+			memset(pBlocks, 0, Frame.Blocks * sizeof(FrameBlock));
+			for (size_t BX = 0; BX < Frame.Blocks; BX++) {
+				pBlocks[BX].CLen = getFrameValue(Frame.pIndex + (BX * FrameIndexSize), 4);
+				pBlocks[BX].RLen = getFrameValue(Frame.pIndex + (BX * FrameIndexSize) + 4, 4);
+				pBlocks[BX].pComp = const_cast<BYTE*>(Frame.pData) + CPos;
+				pBlocks[BX].pRaw = pOut + RPos;
+				CPos += pBlocks[BX].CLen;
+				RPos += pBlocks[BX].RLen;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  readFrame
+		//
+		//  This function will validate the header and index of a frame and describe the frame
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Const pointer to the start of the frame
+		//		size_t			-		Length of the memory holding the frame
+		//		FrameInfo&		-		Reference to the frame description
+		//
+		//  RETURNS
+		//
+		//		bool			-		true if the frame is valid, otherwise false
+		//
+		//  NOTES
+		//
+		//	1.		Every block except the last must hold a full block of content.
+		//
+
+		static bool	readFrame(const BYTE* pFrame, size_t Len, FrameInfo& Frame) {
+			size_t		CTotal = 0;																			//  Total compressed length
+			size_t		RTotal = 0;																			//  Total content length
+			size_t		CLen = 0;																			//  Compressed block length
+			size_t		RLen = 0;																			//  Block content length
+
+			//  Validate the header
+			if (pFrame == nullptr || Len < FrameHeaderSize) return false;
+			if (memcmp(pFrame, "CHF1", 4) != 0) return false;
+			Frame.Options = SWITCHES(getFrameValue(pFrame + 4, 4));
+			Frame.Window = USHORT(getFrameValue(pFrame + 8, 2));
+			Frame.BlockSize = size_t(getFrameValue(pFrame + 12, 4));
+			Frame.Blocks = size_t(getFrameValue(pFrame + 16, 4));
+			Frame.RawSize = size_t(getFrameValue(pFrame + 20, 8));
+			if (getFrameValue(pFrame + 10, 2) != 0) return false;
+			if (Frame.BlockSize < MinBlockSize || Frame.BlockSize > MaxBlockSize) return false;
+			if (Frame.Blocks > (Len - FrameHeaderSize) / FrameIndexSize) return false;
+			Frame.pIndex = pFrame + FrameHeaderSize;
+			Frame.pData = Frame.pIndex + (Frame.Blocks * FrameIndexSize);
+
+			//  Validate the index
+			for (size_t BX = 0; BX < Frame.Blocks; BX++) {
+				CLen = size_t(getFrameValue(Frame.pIndex + (BX * FrameIndexSize), 4));
+				RLen = size_t(getFrameValue(Frame.pIndex + (BX * FrameIndexSize) + 4, 4));
+				if (CLen == 0 || RLen == 0 || RLen > Frame.BlockSize) return false;
+				if (BX < Frame.Blocks - 1 && RLen != Frame.BlockSize) return false;
+				CTotal += CLen;
+				RTotal += RLen;
+			}
+			if (RTotal != Frame.RawSize) return false;
+
+			//  Check that the blocks are present
+			Frame.FrameLen = FrameHeaderSize + (Frame.Blocks * FrameIndexSize) + CTotal;
+			if (Frame.FrameLen > Len) return false;
+			return true;
+		}
+
+		//  putFrameValue
+		//
+		//  This function will store a value in a frame header (little endian)
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Pointer to the location of the value
+		//		uint64_t		-		Value to store
+		//		size_t			-		Number of bytes to store
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		static void	putFrameValue(BYTE* pValue, uint64_t Value, size_t Bytes) {
+			for (size_t BX = 0; BX < Bytes; BX++) pValue[BX] = BYTE(Value >> (8 * BX));
+			return;
+		}
+
+		//  getFrameValue
+		//
+		//  This function will return a value from a frame header (little endian)
+		//
+		//  PARAMETERS
+		//
+		//		BYTE*			-		Const pointer to the location of the value
+		//		size_t			-		Number of bytes in the value
+		//
+		//  RETURNS
+		//
+		//		uint64_t		-		The value
+		//
+		//  NOTES
+		//
+
+		static uint64_t	getFrameValue(const BYTE* pValue, size_t Bytes) {
+			uint64_t		Value = 0;																	//  Value
+
+			for (size_t BX = Bytes; BX > 0; BX--) Value = (Value << 8) + pValue[BX - 1];
+			return Value;
+		}
+
+		//  putBytes
+		//
+		//  This function will write a sequence of bytes to an output stream
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the output ByteStream
+		//		BYTE*			-		Const pointer to the bytes
+		//		size_t			-		Number of bytes
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+
+		void	putBytes(ByteStream& bsOut, const BYTE* pBytes, size_t Len) {
+			for (size_t BX = 0; BX < Len; BX++) bsOut.next(pBytes[BX]);
+			return;
+		}
+
+		//  emitSymbol
+		//
+		//  This function will emit the passed extended symbol to the output stream
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the output ByteStream
+		//		uint32_t		-		The extended symbol to be emitted
+		//
+		//  RETURNS
+		//
+		//  NOTES
+		//
+		//
+
+		void	emitSymbol(ByteStream& bsOut, uint32_t XSCode) {
+
+			//  Emit the code symbol(s)
+			if (XSCode >= (3 << 24)) bsOut.next(BYTE((XSCode & 0x00FF0000) >> 16));
+			if (XSCode >= (2 << 24)) bsOut.next(BYTE((XSCode & 0x0000FF00) >> 8));
+			bsOut.next(BYTE(XSCode & 0x000000FF));
+			return;
+		}
+
+		//  findLongestNewString
+		//
+		//  This function will attempt to find the longest string within the already encoded byffer that matches the current input
+		//
+		//  PARAMETERS
+		//
+		//		ByteStream&		-		Reference to the input ByteStream
+		//		USHORT&			-		Reference to the offset back in the buffer to the matching string
+		//		MatchFinder&	-		Reference to the repeat string match finder
+		//
+		//  RETURNS
+		//
+		//		uint32_t		-		Length of the matching string
+		//
+		//  NOTES
+		//
+		//
+
+		uint32_t		findLongestNewString(ByteStream& bsIn, USHORT& StrOffset, MatchFinder& Finder) {
 
-			//  Return the best (longest) string that was located
-			StrOffset = USHORT(pChunk - pBestString);
-			return BestLen;
+			//  Clear the offset
+			StrOffset = 0;
+
+			//  If there is insufficient window then exit
+			if (WindowSize < MatchFinder::MinStringLen) return 0;
+
+			//  Search the window through the hash chains
+			return Finder.findLongestString(bsIn, StrOffset);
 		}
 
 		//  findLongestRun
@@ -1538,37 +2323,27 @@ namespace xymorg {
 		//
 		//  NOTES
 		//
+		//	1.		Runs are limited to the remaining input and to 256 repeats of the unit (the capacity of the repeat count).
 		//
 
 		uint32_t		findLongestRun(ByteStream& bsIn, int& RunFactor) {
 			uint32_t		Run8 = 1;																//  8 bit run
 			uint32_t		Run16 = 2;																//  16 bit run
 			uint32_t		Run32 = 4;																//  32 bit run
-			BYTE*			pR8 = bsIn.getReadAddress();											//  Pointer for 8 bit run
-			uint16_t*		pR16 = (uint16_t*)pR8;													//  Pointer for 16 bit run
-			uint32_t*		pR32 = (uint32_t*)pR8;													//  Pointer for 32 bit run
+			const BYTE*		pRun = bsIn.getReadAddress();											//  Start of the run
 			size_t			ChunkLen = bsIn.getRemainder();											//  Length of the chunk
 
 			//  Clear the run factor
 			RunFactor = 0;
 
-			//  Compute the 8 bit run length
-			while (pR8[0] == pR8[1] && Run8 < ChunkLen) {
-				Run8++;
-				pR8++;
-			}
+			//  Compute the 8 bit run length (limited to 256 repeats)
+			while (Run8 < ChunkLen && Run8 < 256 && pRun[Run8] == pRun[Run8 - 1]) Run8++;
 
-			//  Compute the 16 bit run length
-			while (pR16[0] == pR16[1] && Run16 < ChunkLen) {
-				Run16 += 2;
-				pR16++;
-			}
+			//  Compute the 16 bit run length (limited to 256 repeats)
+			while (Run16 + 2 <= ChunkLen && Run16 < 512 && memcmp(pRun + Run16 - 2, pRun + Run16, 2) == 0) Run16 += 2;
 
-			//  Compute the 32 bit run length
-			while (pR32[0] == pR32[1] && Run32 < ChunkLen) {
-				Run32 += 4;
-				pR32++;
-			}
+			//  Compute the 32 bit run length (limited to 256 repeats)
+			while (Run32 + 4 <= ChunkLen && Run32 < 1024 && memcmp(pRun + Run32 - 4, pRun + Run32, 4) == 0) Run32 += 4;
 
 			//  Check for no runs possible
 			if (Run8 + Run16 + Run32 == 7) return 0;
@@ -1609,6 +2384,7 @@ namespace xymorg {
 		//		AdaptiveHuffManTree&	-		Reference to the Encoder
 		//		uint32_t&				-		Reference to the extended symbol code
 		//		DictRefCODEC&			-		Reference to the Dictionary store, encoder decoder
+		//		MatchFinder&			-		Reference to the repeat string match finder
 		//
 		//  RETURNS
 		//
@@ -1618,7 +2394,7 @@ namespace xymorg {
 		//
 		//
 
-		uint32_t		findExtendedSymbol(ByteStream& bsIn, AdaptiveHuffmanTree& Encoder, uint32_t& XSCode, DictRefCODEC& Dictionary) {
+		uint32_t		findExtendedSymbol(ByteStream& bsIn, AdaptiveHuffmanTree& Encoder, uint32_t& XSCode, DictRefCODEC& Dictionary, MatchFinder& Finder) {
 			size_t			XS2Count = 0;																		//  Count of matching doublets within window
 			size_t			XS3Count = 0;																		//  Count of matching triplets within window
 			BYTE*			pChunk = bsIn.getReadAddress();														//  Start of the chunk
@@ -1675,7 +2451,7 @@ namespace xymorg {
 					XS3Count = 0;
 				}
 				else {
-					if (findLongestNewString(bsIn, TempOff) > 0) {
+					if (findLongestNewString(bsIn, TempOff, Finder) > 0) {
 						XS2Count = 0;
 						XS3Count = 0;
 					}
@@ -1689,7 +2465,7 @@ namespace xymorg {
 					XS3Count = 0;
 				}
 				else {
-					if (findLongestNewString(bsIn, TempOff) > 0) {
+					if (findLongestNewString(bsIn, TempOff, Finder) > 0) {
 						XS3Count = 0;
 					}
 				}
@@ -1843,6 +2619,13 @@ namespace xymorg {
 				HuffmanNode* pNode;														//  Pointer to the node in the tree
 			} ELUTEntry;
 
+			//  Decoding Table entry
+
+			typedef struct DecodeEntry {
+				HuffmanNode*		pNode;														//  Leaf (or branch at the table depth) reached
+				USHORT				Length;														//  Number of bits consumed to reach the node
+			} DecodeEntry;
+
 		public:
 
 			//*******************************************************************************************************************
@@ -1884,9 +2667,9 @@ namespace xymorg {
 				//  Create and clear the Encoding Lookup Table
 				ELUTCapacity = 1024;
 				ELUTUsed = 0;
-				ELUT1S = 0;
-				ELUT2S = 0;
-				ELUT3S = 0;
+
+				//  The Decoding Table is built on first use
+				DecodeTable = nullptr;
 
 				//  Set the initial recording window position
 				WindowPos = 0;
@@ -1907,7 +2690,7 @@ namespace xymorg {
 				}
 
 				//  Clear the Encoding Lookup Table
-				memset(ELUT, 0, ELUTCapacity * sizeof(HuffmanNode*));
+				memset(ELUT, 0, ELUTCapacity * sizeof(ELUTEntry));
 
 				//  Create and clear the recording buffer
 				RecordingBuffer = (uint32_t*)malloc(size_t(WindowSize) * sizeof(uint32_t));
@@ -1946,8 +2729,9 @@ namespace xymorg {
 				//  If there is at least a root then delete it - this will cascade the deletion to all nodes in the tree
 				if (Root != nullptr) delete Root;
 
-				//  Free the Encoding Lookup Table & Recording Buffer
+				//  Free the Encoding Lookup Table, Decoding Table & Recording Buffer
 				if (ELUT != nullptr) free(ELUT);
+				if (DecodeTable != nullptr) free(DecodeTable);
 				if (RecordingBuffer != nullptr) free(RecordingBuffer);
 
 				//  Return to caller
@@ -1983,14 +2767,9 @@ namespace xymorg {
 			//
 
 			bool	hasEncoding(uint32_t Symbol) {
-				size_t			ELUTIndex = 0;														//  Index in the ELUT table
 
 				//  Search the Encoding LookUp Table to find the node in the tree for the requested symbol
-				ELUTIndex = findELUTEntry(Symbol);
-
-				//  Not found conditions
-				if (ELUTIndex == ELUTUsed) return false;
-				if (ELUT[ELUTIndex].XSCode != Symbol) return false;
+				if (findELUTEntry(Symbol) == nullptr) return false;
 
 				//  Return to caller
 				return true;
@@ -2016,8 +2795,6 @@ namespace xymorg {
 			//
 
 			bool	hasEncoding(uint32_t Symbol, uint32_t& Encodon, int& EncLen) {
-				uint32_t		NXCode = (1 << 24) + AlphabetSize;									//  Unused code
-				size_t			ELUTIndex = 0;														//  Index in the ELUT table
 				HuffmanNode*	pNode = nullptr;													//  Current Node
 
 				//  Clear the encoded value
@@ -2025,27 +2802,17 @@ namespace xymorg {
 				EncLen = 0;
 
 				//  Search the Encoding LookUp Table to find the node in the tree for the requested symbol
-				ELUTIndex = findELUTEntry(Symbol);
+				pNode = findELUTEntry(Symbol);
 
-				//  Not found conditions
-				if (ELUTIndex == ELUTUsed) return false;
-				if (ELUT[ELUTIndex].XSCode != Symbol) return false;
+				//  Not found condition
+				if (pNode == nullptr) return false;
 
 				//  Get the encoding for the symbol
-				LastEncodon = Encodon = getEncoding(ELUT[ELUTIndex].pNode, EncLen);
+				LastEncodon = Encodon = getEncoding(pNode, EncLen);
 				LastCodeLen = EncLen;
 
 				//  Perform the bookeeping
-				pNode = ELUT[ELUTIndex].pNode;
-				if (RecordingBuffer[WindowPos] != NXCode) {
-					size_t	DecIndex = findELUTEntry(RecordingBuffer[WindowPos]);
-					(*(ELUT[DecIndex].pNode))--;
-				}
-				RecordingBuffer[WindowPos] = Symbol;
-				WindowPos++;
-				if (WindowPos == WindowSize) WindowPos = 0;
-				(*pNode)++;
-				promoteNode(pNode);
+				recordHit(Symbol, pNode);
 
 				//  Return to caller
 				return true;
@@ -2087,12 +2854,15 @@ namespace xymorg {
 						insertELUTEntry(NewSymbol, InsertPoint);
 						InsertPoint->setSymbol(NewSymbol);
 						InsertPoint->setHits(NewHits);
+						refreshDecodeTable(InsertPoint);
 						return;
 					}
 
 					bool Direction = true;
 					if (NewHits > InsertPoint->getHits()) Direction = false;
-					insertELUTEntry(NewSymbol, InsertPoint->fork(Direction, NewSymbol, NewHits));
+					InsertPoint = InsertPoint->fork(Direction, NewSymbol, NewHits);
+					insertELUTEntry(NewSymbol, InsertPoint);
+					refreshDecodeTable(InsertPoint->getParent());
 					return;
 				}
 
@@ -2101,17 +2871,21 @@ namespace xymorg {
 				if (InsertPoint->getZero() == nullptr) {
 					InsertPoint->setZero(new HuffmanNode(true, InsertPoint, nullptr, nullptr, NewHits, NewSymbol));
 					insertELUTEntry(NewSymbol, InsertPoint->getZero());
+					refreshDecodeTable(InsertPoint->getZero());
 					return;
 				}
 
 				if (InsertPoint->getOne() == nullptr) {
 					InsertPoint->setOne(new HuffmanNode(true, InsertPoint, nullptr, nullptr, NewHits, NewSymbol));
 					insertELUTEntry(NewSymbol, InsertPoint->getOne());
+					refreshDecodeTable(InsertPoint->getOne());
 					return;
 				}
 
 				//  Fork the current entry
-				insertELUTEntry(NewSymbol, InsertPoint->fork(false, NewSymbol, NewHits));
+				InsertPoint = InsertPoint->fork(false, NewSymbol, NewHits);
+				insertELUTEntry(NewSymbol, InsertPoint);
+				refreshDecodeTable(InsertPoint->getParent());
 
 				return;
 			}
@@ -2130,16 +2904,31 @@ namespace xymorg {
 			//
 			//  NOTES
 			//
+			//	1.	The first DecodeBits of the token are resolved with a single Decoding Table lookup, longer codes continue
+			//		bit by bit from the branch reached. The tree is walked bit by bit when tracing or near the end of the stream.
 			//
 
 			int32_t		getNextToken(MSBitStream& bsIn) {
 				uint32_t			NextBit;
+				uint32_t			Prefix = 0;														//  Table lookup prefix
 				HuffmanNode*		pNode = Root;													//  Current node in the tree
-				uint32_t			NXCode = (1 << 24) + AlphabetSize;								// Unused code
 
 				//  Loop until a leaf node is encounteresd or EOS detected
 				LastCodeLen = 0;
 				LastEncodon = 0;
+
+				//  Resolve the leading bits through the Decoding Table
+				if (!DebugTrace) {
+					if (DecodeTable == nullptr) buildDecodeTable();
+					if (DecodeTable != nullptr && bsIn.peek(DecodeBits, Prefix) && DecodeTable[Prefix].pNode != nullptr) {
+						pNode = DecodeTable[Prefix].pNode;
+						LastCodeLen = DecodeTable[Prefix].Length;
+						LastEncodon = Prefix >> (DecodeBits - LastCodeLen);
+						bsIn.next(LastCodeLen);
+						if (pNode->isLeaf()) return decodedSymbol(pNode);
+					}
+				}
+
 				if (DebugTrace) os << "TRACE: getNextToken() read: '";
 				while (!bsIn.eos()) {
 					NextBit = bsIn.next(1);
@@ -2152,20 +2941,8 @@ namespace xymorg {
 					}
 					if (NextBit == 0) pNode = pNode->getZero();										//  Move to the next node in the tree
 					else pNode = pNode->getOne();
-					if (pNode->isLeaf()) {
-						//  Perform the bookeeping
-						if (RecordingBuffer[WindowPos] != NXCode) {
-							size_t	ELUTIndex = findELUTEntry(RecordingBuffer[WindowPos]);
-							(*(ELUT[ELUTIndex].pNode))--;
-						}
-						RecordingBuffer[WindowPos] = pNode->getSymbol();
-						WindowPos++;
-						if (WindowPos == WindowSize) WindowPos = 0;
-						(*pNode)++;
-						promoteNode(pNode);
-						if (DebugTrace) os << "', Symbol: " << pNode->getSymbol() << ", Hits: " << pNode->getHits() << "." << std::endl;
-						return pNode->getSymbol();
-					}
+					if (pNode == nullptr) break;
+					if (pNode->isLeaf()) return decodedSymbol(pNode);
 				}
 				if (DebugTrace) os << " - OOOOPs forced EOS." << std::endl;
 				//  End-Of-Stream encountered before the current token is acquired
@@ -2186,7 +2963,6 @@ namespace xymorg {
 			//
 
 			void	documentTree() {
-				USHORT			sIndex;
 
 				//  Show titles
 				os << std::endl;
@@ -2201,8 +2977,8 @@ namespace xymorg {
 
 				//  Dump the Encoding Lookup Table
 				os << "Encoding Lookup Table :-" << std::endl << std::endl;
-				for (sIndex = 0; sIndex < ELUTUsed; sIndex++) {
-					if (ELUT[sIndex].pNode != nullptr) os << " Symbol: " << (ELUT[sIndex].XSCode & 0x00FFFFFF) << " ----> Node: 0x" << ELUT[sIndex].pNode << "." << std::endl;
+				for (size_t eIndex = 0; eIndex < ELUTCapacity; eIndex++) {
+					if (ELUT[eIndex].pNode != nullptr) os << " Symbol: " << (ELUT[eIndex].XSCode & 0x00FFFFFF) << " ----> Node: 0x" << ELUT[eIndex].pNode << "." << std::endl;
 				}
 				os << std::endl;
 
@@ -2252,12 +3028,13 @@ namespace xymorg {
 			USHORT			Nodes;																		//  Count of Nodes in the tree
 
 			//  Encoding Lookup Table
-			ELUTEntry* ELUT;																		//  Encoding looku[p table
-			size_t			ELUTCapacity;																//  Capacity of the ELUT
+			ELUTEntry* ELUT;																		//  Encoding looku[p table (hashed on the symbol)
+			size_t			ELUTCapacity;																//  Capacity of the ELUT (power of 2)
 			size_t			ELUTUsed;																	//  Number of entries in the ELUT
-			size_t			ELUT1S;																		//  Number of L=1 symbols
-			size_t			ELUT2S;																		//  Number of L=2 symbols
-			size_t			ELUT3S;																		//  Number of L=3 symbols
+
+			//  Decoding Table
+			static const uint32_t	DecodeBits = 10;													//  Bits resolved by a single lookup
+			DecodeEntry*	DecodeTable;																//  Decoding table (indexed by code prefix)
 
 			//  Window controls
 			USHORT			WindowPos;																	//  Current position in window
@@ -2288,10 +3065,10 @@ namespace xymorg {
 			//
 			//  NOTES
 			//
+			//	1.	The ELUT is an open addressed hash table, it is doubled in size when it becomes half full.
 			//
 
 			void	insertELUTEntry(uint32_t NewSymbol, HuffmanNode* pNode) {
-				int		SymbolClass = NewSymbol >> 24;														//  Symbol Class
 				size_t	ELUTIndex = 0;																		//  Index into the ELUT
 
 				//  Safety
@@ -2299,27 +3076,31 @@ namespace xymorg {
 				if (pNode == nullptr) return;
 
 				//  Check that we have capacity for the new symbol - if not expand the ELUT
-				if (ELUTUsed == ELUTCapacity) {
-					ELUTCapacity += 256;
-					ELUTEntry* NewELUT = (ELUTEntry*)realloc(ELUT, ELUTCapacity * sizeof(ELUTEntry));
-					if (NewELUT == nullptr) {
-						free(ELUT);
+				if ((ELUTUsed + 1) * 2 > ELUTCapacity) {
+					ELUTEntry*	OldELUT = ELUT;
+					size_t		OldCapacity = ELUTCapacity;
+
+					ELUT = (ELUTEntry*)malloc(2 * OldCapacity * sizeof(ELUTEntry));
+					if (ELUT == nullptr) {
+						ELUT = OldELUT;
 						os << "ERROR: The Huffman Tree failed to allocate the Encoding Lookup Table." << std::endl;
 						return;
 					}
+					ELUTCapacity = 2 * OldCapacity;
+					memset(ELUT, 0, ELUTCapacity * sizeof(ELUTEntry));
 
-					ELUT = NewELUT;
-					memset(&ELUT[ELUTUsed], 0, (ELUTCapacity - ELUTUsed) * sizeof(ELUTEntry));
+					//  Rehash the existing entries
+					for (size_t OldIndex = 0; OldIndex < OldCapacity; OldIndex++) {
+						if (OldELUT[OldIndex].pNode != nullptr) ELUT[probeELUT(OldELUT[OldIndex].XSCode)] = OldELUT[OldIndex];
+					}
+					free(OldELUT);
 				}
 
 				//  Find the point in the ELUT to insert the new entry
-				ELUTIndex = findELUTEntry(NewSymbol);
+				ELUTIndex = probeELUT(NewSymbol);
 
 				//  SNO - Check for an entry that is already in the table
-				if (ELUTIndex < ELUTUsed && ELUT[ELUTIndex].XSCode == NewSymbol) return;
-
-				//  If the insertion is not at the end of the table then open an entry in the table
-				if (ELUTIndex < ELUTUsed) memmove(&ELUT[ELUTIndex + 1], &ELUT[ELUTIndex], (ELUTUsed - ELUTIndex) * sizeof(ELUTEntry));
+				if (ELUT[ELUTIndex].pNode != nullptr) return;
 
 				//  Add the new entry
 				ELUT[ELUTIndex].XSCode = NewSymbol;
@@ -2327,9 +3108,6 @@ namespace xymorg {
 
 				//  Bookeeping
 				ELUTUsed++;
-				if (SymbolClass == 1) ELUT1S++;
-				else if (SymbolClass == 2) ELUT2S++;
-				else ELUT3S++;
 
 				//  Return to caller
 				return;
@@ -2337,7 +3115,7 @@ namespace xymorg {
 
 			//  findELUTEntry
 			//
-			//  This function will locate an existing ELUT entry or the point at which the entry should be inserted in the ELUT
+			//  This function will locate the node in the tree for a symbol through the ELUT
 			//
 			//  PARAMETERS
 			//
@@ -2345,102 +3123,272 @@ namespace xymorg {
 			//
 			//  RETURNS
 			//
-			//		size_t				-		The index position of the entry in the ELUT
+			//		HuffmanNode*		-		Pointer to the Node in the tree containing the symbol, nullptr if not present
 			//
 			//  NOTES
 			//
 			//
 
-			size_t	findELUTEntry(uint32_t Symbol) {
-				int			SymbolClass = Symbol >> 24;														//  Symbol Class
-				size_t		ELUTIndex = 0;																	//  Search start point
+			HuffmanNode* findELUTEntry(uint32_t Symbol) {
 
-				//  Determine the start point for the search
-				if (SymbolClass > 1) ELUTIndex += ELUT1S;
-				if (SymbolClass > 2) ELUTIndex += ELUT2S;
+				//  Safety
+				if (ELUT == nullptr) return nullptr;
 
-				//  Linear search the ELUT until a matching (or greater) symbol is encountered
-				for (; ELUTIndex < ELUTUsed; ELUTIndex++) {
-					if (ELUT[ELUTIndex].XSCode >= Symbol) break;
-				}
+				//  Return the node (if any) from the slot for the symbol
+				return ELUT[probeELUT(Symbol)].pNode;
+			}
+
+			//  probeELUT
+			//
+			//  This function will locate the ELUT slot that holds the symbol or the empty slot where it should be inserted
+			//
+			//  PARAMETERS
+			//
+			//		unit32_t			-		The symbol that is to be located		
+			//
+			//  RETURNS
+			//
+			//		size_t				-		The index position of the slot in the ELUT
+			//
+			//  NOTES
+			//
+			//	1.	The table is never more than half full so the linear probe always ends.
+			//
+
+			size_t	probeELUT(uint32_t Symbol) {
+				size_t		Mask = ELUTCapacity - 1;														//  Index mask
+				size_t		ELUTIndex = size_t((uint64_t(Symbol) * 0x9E3779B97F4A7C15ULL) >> 40) & Mask;	//  Home slot
+
+				//  Linear probe until the symbol or an empty slot is encountered
+				while (ELUT[ELUTIndex].pNode != nullptr && ELUT[ELUTIndex].XSCode != Symbol) ELUTIndex = (ELUTIndex + 1) & Mask;
 
 				//  Return the index position
 				return ELUTIndex;
 			}
 
-			//  findInsertPoint
-			//
-			//  This function will locate the position in the tree to use for a new symbol.
-			//  It will return a pointer to the Node that indicates where the new symbol should be placed, this could be :-
+			//  recordHit
 			//
-			//		A pointer to a branch node with an unused branch
-			//		A pointer to a leaf node that is unused (zero hits)
-			//		A pointer to a leaf node must be forked to create the insert point
+			//  This function will record an encoding/decoding of a symbol in the adaption window, the symbol leaving
+			//  the window loses a hit and the node for the symbol gains a hit and may be promoted in the tree.
 			//
 			//  PARAMETERS
 			//
-			//		USHORT		-		the initial hit count to be set for the symbol
+			//		uint32_t			-		The symbol
+			//		HuffmanNode*		-		Pointer to the node for the symbol
 			//
 			//  RETURNS
 			//
-			//		HuffmanNode*		-		Pointer to the Node in the tree where the new leaf should be inserted
-			//
 			//  NOTES
 			//
 			//
 
-			HuffmanNode* findInsertPoint(USHORT NewHits) {
-				HuffmanNode* InsertPoint = nullptr;												//  Insertion point
+			void	recordHit(uint32_t Symbol, HuffmanNode* pNode) {
+				uint32_t		NXCode = (1 << 24) + AlphabetSize;									//  Unused code
 
-				//  SNO:  There is no root node, insert a new one and return it
-				if (Root == nullptr) {
-					if (DebugTrace) os << "SNO-ERROR: No root node availabe in the tree, recreating root." << std::endl;
-					Root = new HuffmanNode(false, nullptr, nullptr, nullptr, 0, 0);
-					return Root;
+				if (RecordingBuffer[WindowPos] != NXCode) {
+					HuffmanNode*	pAged = findELUTEntry(RecordingBuffer[WindowPos]);				//  Node leaving the window
+					if (pAged != nullptr) (*pAged)--;
 				}
+				RecordingBuffer[WindowPos] = Symbol;
+				WindowPos++;
+				if (WindowPos == WindowSize) WindowPos = 0;
+				(*pNode)++;
+				promoteNode(pNode);
 
-				//  Recursively search for the best insertion point
-				searchForInsertPoint(NewHits, 0, Root, &InsertPoint);
-
-				//  Return the selected insert point
-				return InsertPoint;
+				//  Return to caller
+				return;
 			}
 
-			//  searchForInsertPoint
+			//  decodedSymbol
 			//
-			//  This function will search each node in the tree to locate the best node to use for a new symbol.
+			//  This function will perform the bookeeping for a symbol that has been decoded.
 			//
 			//  PARAMETERS
 			//
-			//		USHORT				-		the initial hit count to be set for the symbol
-			//		int					-		Level of the current node in the tree
-			//		HuffmanNode*		-		Pointer to the current node to be considered
-			//		HuffmanNode**		-		Pointer to a pointer to the node, where the best node found so far will be returned
+			//		HuffmanNode*		-		Pointer to the leaf node reached by the decoding
 			//
 			//  RETURNS
 			//
+			//		uint32_t			-		The decoded extended symbol value
+			//
 			//  NOTES
 			//
 			//
 
-			void	searchForInsertPoint(USHORT NewHits, int Level, HuffmanNode* pNode, HuffmanNode** InsertPoint) {
+			uint32_t	decodedSymbol(HuffmanNode* pNode) {
+				uint32_t		Symbol = pNode->getSymbol();										//  Decoded symbol
 
-				//  If there is no insert point located yet then the passed node will qualify
-				if (*InsertPoint == nullptr) *InsertPoint = pNode;
+				//  Perform the bookeeping
+				recordHit(Symbol, pNode);
+				if (DebugTrace) os << "', Symbol: " << pNode->getSymbol() << ", Hits: " << pNode->getHits() << "." << std::endl;
+				return Symbol;
+			}
 
-				//  If a default qualifying node has been located then do no more
-				if ((*InsertPoint)->isLeaf() && (*InsertPoint)->getHits() == 0) return;
-				if ((*InsertPoint)->isBranch() && ((*InsertPoint)->getZero() == nullptr || (*InsertPoint)->getOne() == nullptr)) return;
+			//  buildDecodeTable
+			//
+			//  This function will allocate the Decoding Table and populate it from the current tree.
+			//
+			//  PARAMETERS
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//	1.	Once built the table is kept in step with the tree by refreshDecodeTable() as the tree is restructured.
+			//
 
-				//  If the current node is an unsaturated branch then it automatically qualifies as the best option
-				if (pNode->isBranch()) {
-					if (pNode->getZero() == nullptr || pNode->getOne() == nullptr) {
-						*InsertPoint = pNode;
-						return;
-					}
-				}
+			void	buildDecodeTable() {
 
-				//  If the current branch is a leaf placeholder then it automatically qualifies as the best option
+				DecodeTable = (DecodeEntry*)malloc((size_t(1) << DecodeBits) * sizeof(DecodeEntry));
+				if (DecodeTable == nullptr) return;
+				fillDecodeTable(Root, 0, 0);
+
+				//  Return to caller
+				return;
+			}
+
+			//  refreshDecodeTable
+			//
+			//  This function will repopulate the Decoding Table entries covered by the subtree at a node that has
+			//  been moved, forked or added in the tree.
+			//
+			//  PARAMETERS
+			//
+			//		HuffmanNode*		-		Pointer to the node at the root of the changed subtree
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//	1.	Changes below the table depth need no refresh, the entry holds the branch at the table depth.
+			//
+
+			void	refreshDecodeTable(HuffmanNode* pNode) {
+				int				Length = 0;															//  Length of the code for the node
+				uint32_t		Code = 0;															//  Code for the node
+
+				//  Nothing to do until the table has been built or when the change is below the table depth
+				if (DecodeTable == nullptr) return;
+				if (pNode->getLevel() > DecodeBits) return;
+
+				//  Repopulate the entries from the node
+				if (!pNode->isRoot()) Code = getEncoding(pNode, Length);
+				fillDecodeTable(pNode, Code, Length);
+
+				//  Return to caller
+				return;
+			}
+
+			//  fillDecodeTable
+			//
+			//  This function will populate the Decoding Table entries for all codes that start with the passed prefix.
+			//
+			//  PARAMETERS
+			//
+			//		HuffmanNode*		-		Pointer to the node reached by the prefix (may be nullptr)
+			//		uint32_t			-		The prefix
+			//		int					-		Length of the prefix (bits)
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void	fillDecodeTable(HuffmanNode* pNode, uint32_t Prefix, int Length) {
+				size_t			First = size_t(Prefix) << (DecodeBits - Length);					//  First entry for the prefix
+				size_t			Span = size_t(1) << (DecodeBits - Length);							//  Number of entries for the prefix
+
+				//  Leaves, unused paths and branches at the table depth occupy all entries for the prefix
+				if (pNode == nullptr || pNode->isLeaf() || Length == int(DecodeBits)) {
+					for (size_t eIndex = First; eIndex < First + Span; eIndex++) {
+						DecodeTable[eIndex].pNode = pNode;
+						DecodeTable[eIndex].Length = USHORT(Length);
+					}
+					return;
+				}
+
+				//  Recurse into the branches
+				fillDecodeTable(pNode->getZero(), Prefix << 1, Length + 1);
+				fillDecodeTable(pNode->getOne(), (Prefix << 1) | 1, Length + 1);
+
+				//  Return to caller
+				return;
+			}
+
+			//  findInsertPoint
+			//
+			//  This function will locate the position in the tree to use for a new symbol.
+			//  It will return a pointer to the Node that indicates where the new symbol should be placed, this could be :-
+			//
+			//		A pointer to a branch node with an unused branch
+			//		A pointer to a leaf node that is unused (zero hits)
+			//		A pointer to a leaf node must be forked to create the insert point
+			//
+			//  PARAMETERS
+			//
+			//		USHORT		-		the initial hit count to be set for the symbol
+			//
+			//  RETURNS
+			//
+			//		HuffmanNode*		-		Pointer to the Node in the tree where the new leaf should be inserted
+			//
+			//  NOTES
+			//
+			//
+
+			HuffmanNode* findInsertPoint(USHORT NewHits) {
+				HuffmanNode* InsertPoint = nullptr;												//  Insertion point
+
+				//  SNO:  There is no root node, insert a new one and return it
+				if (Root == nullptr) {
+					if (DebugTrace) os << "SNO-ERROR: No root node availabe in the tree, recreating root." << std::endl;
+					Root = new HuffmanNode(false, nullptr, nullptr, nullptr, 0, 0);
+					return Root;
+				}
+
+				//  Recursively search for the best insertion point
+				searchForInsertPoint(NewHits, 0, Root, &InsertPoint);
+
+				//  Return the selected insert point
+				return InsertPoint;
+			}
+
+			//  searchForInsertPoint
+			//
+			//  This function will search each node in the tree to locate the best node to use for a new symbol.
+			//
+			//  PARAMETERS
+			//
+			//		USHORT				-		the initial hit count to be set for the symbol
+			//		int					-		Level of the current node in the tree
+			//		HuffmanNode*		-		Pointer to the current node to be considered
+			//		HuffmanNode**		-		Pointer to a pointer to the node, where the best node found so far will be returned
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void	searchForInsertPoint(USHORT NewHits, int Level, HuffmanNode* pNode, HuffmanNode** InsertPoint) {
+
+				//  If there is no insert point located yet then the passed node will qualify
+				if (*InsertPoint == nullptr) *InsertPoint = pNode;
+
+				//  If a default qualifying node has been located then do no more
+				if ((*InsertPoint)->isLeaf() && (*InsertPoint)->getHits() == 0) return;
+				if ((*InsertPoint)->isBranch() && ((*InsertPoint)->getZero() == nullptr || (*InsertPoint)->getOne() == nullptr)) return;
+
+				//  If the current node is an unsaturated branch then it automatically qualifies as the best option
+				if (pNode->isBranch()) {
+					if (pNode->getZero() == nullptr || pNode->getOne() == nullptr) {
+						*InsertPoint = pNode;
+						return;
+					}
+				}
+
+				//  If the current branch is a leaf placeholder then it automatically qualifies as the best option
 				if (pNode->isLeaf()) {
 					if (pNode->getHits() == 0) {
 						*InsertPoint = pNode;
@@ -2533,19 +3481,44 @@ namespace xymorg {
 				HuffmanNode*		pPromoteTo = locatePromotePoint(pNode, pNode, Root);
 
 				//  Determine if a swap should be made
-				if (pPromoteTo != pNode) pNode->swap(*pPromoteTo);
+				if (pPromoteTo != pNode) swapNodes(pNode, pPromoteTo);
 
 				//  Percolate the promotion up to the root
 				while (pNode->getLevel() > 2) {
 					pNode = pNode->getParent();
 					pPromoteTo = locatePromotePoint(pNode, pNode, Root);
-					if (pPromoteTo != pNode) pNode->swap(*pPromoteTo);
+					if (pPromoteTo != pNode) swapNodes(pNode, pPromoteTo);
 				}
 
 				//  Return to caller
 				return;
 			}
 
+			//  swapNodes
+			//
+			//  This function will exchange the positions of two nodes in the tree and keep the Decoding Table in step.
+			//
+			//  PARAMETERS
+			//
+			//		HuffmanNode*	-		Pointer to the node being promoted
+			//		HuffmanNode*	-		Pointer to the node it is exchanged with
+			//
+			//  RETURNS
+			//
+			//  NOTES
+			//
+			//
+
+			void	swapNodes(HuffmanNode* pNode, HuffmanNode* pTarget) {
+
+				pNode->swap(*pTarget);
+				refreshDecodeTable(pNode);
+				refreshDecodeTable(pTarget);
+
+				//  Return to caller
+				return;
+			}
+
 			//  locatePromotePoint
 			//
 			//  This function will recusively search the tree (indented explosion) to find the best qualifying node to [promote an updated node to.
@@ -2571,8 +3544,14 @@ namespace xymorg {
 				if (pSearch->getHits() <= pRef->getHits()) {
 					//  If the node is at a higher level than the current best node then it supplants the best
 					if (pSearch->getLevel() < pMyBest->getLevel()) pMyBest = pSearch;
+
+					//  Nodes below a qualifying node are at lower levels and cannot supplant it
+					return pMyBest;
 				}
 
+				//  Nodes below this one cannot be at a higher level than the current best node
+				if ((pSearch->getLevel() + 1) >= pMyBest->getLevel()) return pMyBest;
+
 				//  If the current node is a branch then recurse into the structure
 				if (pSearch->isBranch()) {
 					if (pSearch->getZero() != nullptr) pMyBest = locatePromotePoint(pRef, pMyBest, pSearch->getZero());
@@ -2719,8 +3698,8 @@ namespace xymorg {
 
 				//  Make a pass over the ELUT to capture the leaves
 				lIndex = 0;
-				for (nIndex = 0; nIndex < ELUTUsed; nIndex++) {
-					if (ELUT[nIndex].pNode != nullptr) PQ[lIndex++] = ELUT[nIndex].pNode;
+				for (size_t eIndex = 0; eIndex < ELUTCapacity && lIndex < Leaves; eIndex++) {
+					if (ELUT[eIndex].pNode != nullptr) PQ[lIndex++] = ELUT[eIndex].pNode;
 				}
 
 				//  Bubble sort the priority queue into descending order of hits
@@ -4048,6 +5027,1000 @@ namespace xymorg {
 
 		};
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   MatchFinder Class																								*
+		//*                                                                                                                 *
+		//*   This class provides the implementation of the Repeat String (LZ77) match finder. Positions in the input are	*
+		//*   chained by a hash of their first 4 bytes so that only candidate strings are compared.							*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class MatchFinder {
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Constants                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			static const size_t		MinStringLen = 4;														//  Minimum string length (and offset)
+			static const size_t		MaxStringLen = 256;														//  Maximum string length
+			static const size_t		MaxOffset = 65535;														//  Maximum offset back to a string
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors                                                                                                  *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  MatchFinder  -  Default Constructor
+			//
+			//  Constructs a new MatchFinder object, the hash heads and chains are lazy initialised.
+			//
+			//	PARAMETERS:
+			//
+			//		size_t					-			Maximum number of candidates to compare (0 = all)
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			MatchFinder(size_t Depth) : MaxProbes(Depth), pHead(nullptr), pChain(nullptr), InsertPos(NoPosition) {
+
+				//  Return to caller
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Destructor	                                                                                                *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//	destructor
+			//
+			//	Destroys a MatchFinder object.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			~MatchFinder() {
+
+				//  Free the hash heads and chains
+				if (pHead != nullptr) free(pHead);
+				if (pChain != nullptr) free(pChain);
+				pHead = nullptr;
+				pChain = nullptr;
+
+				//  Return to caller
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  findLongestString
+			//
+			//  This function will find the longest string within the already encoded buffer that matches the current input
+			//
+			//  PARAMETERS
+			//
+			//		ByteStream&		-		Reference to the input ByteStream
+			//		USHORT&			-		Reference to the offset back in the buffer to the matching string
+			//
+			//  RETURNS
+			//
+			//		uint32_t		-		Length of the matching string, 0 if there is no match
+			//
+			//  NOTES
+			//
+			//	1.		Positions up to the current position are added to the chains before the search, the input may be
+			//			searched ahead of the position that is finally encoded (lazy matching).
+			//	2.		Of the longest strings found the nearest is selected.
+			//	3.		With no limit on the candidates compared the result is the same as an exhaustive search of the window.
+			//
+
+			uint32_t	findLongestString(ByteStream& bsIn, USHORT& StrOffset) {
+				BYTE*		pBfr = bsIn.getBufferAddress();													//  Start of buffer address
+				BYTE*		pChunk = bsIn.getReadAddress();													//  Start of the chunk
+				size_t		ChunkLen = bsIn.getRemainder();													//  Length of the chunk
+				size_t		Pos = bsIn.getBytesRead();														//  Position of the chunk
+				size_t		WSz = 0;																		//  Search window size
+				size_t		Floor = 0;																		//  Earliest position in the window
+				size_t		MaxLen = 0;																		//  Longest string permitted
+				size_t		BestLen = 0;																	//  Best string length so far
+				size_t		BestPos = 0;																	//  Position of the best string
+				size_t		Cand = 0;																		//  Candidate position
+				size_t		Next = 0;																		//  Next candidate position
+				size_t		Len = 0;																		//  Candidate string length
+				size_t		Probes = 0;																		//  Candidates compared
+
+				//  Clear the offset
+				StrOffset = 0;
+
+				//  Check that there is sufficient input remaining for a string
+				if (ChunkLen <= MinStringLen) return 0;
+				MaxLen = ChunkLen - 1;
+				if (MaxLen > MaxStringLen) MaxLen = MaxStringLen;
+
+				//  Allocate the hash heads and chains on first use
+				if (pHead == nullptr) {
+					pHead = (size_t*)malloc(HashSize * sizeof(size_t));
+					pChain = (size_t*)malloc(ChainSize * sizeof(size_t));
+					if (pHead == nullptr || pChain == nullptr) return 0;
+					for (size_t HX = 0; HX < HashSize; HX++) pHead[HX] = NoPosition;
+				}
+
+				//
+				//  Bring the chains up to the current position, positions that have left the window are not added
+				//
+
+				Floor = size_t(bsIn.getPreReadWindow(MaxOffset, WSz) - pBfr);
+				if (InsertPos == NoPosition || InsertPos < Floor) InsertPos = Floor;
+				while (InsertPos < Pos) {
+					Next = hashString(pBfr + InsertPos);
+					pChain[InsertPos & ChainMask] = pHead[Next];
+					pHead[Next] = InsertPos;
+					InsertPos++;
+				}
+
+				//
+				//  Follow the chain for the current position from the nearest candidate backwards
+				//
+
+				Cand = pHead[hashString(pChunk)];
+				while (Cand != NoPosition && Cand >= Floor) {
+
+					//  Candidates that are too close (including those added ahead of the position) are passed over
+					if (Cand + MinStringLen <= Pos) {
+
+						//  Quick reject - a candidate that differs at the current best length cannot be longer
+						if (pBfr[Cand + BestLen] == pChunk[BestLen]) {
+							for (Len = 0; Len < MaxLen; Len++) {
+								if (pBfr[Cand + Len] != pChunk[Len]) break;
+							}
+
+							//  See if this is a better candidate string
+							if (Len >= MinStringLen && Len > BestLen) {
+								BestLen = Len;
+								BestPos = Cand;
+								if (BestLen == MaxLen) break;
+							}
+						}
+
+						//  Limit the search depth
+						Probes++;
+						if (MaxProbes > 0 && Probes >= MaxProbes) break;
+					}
+
+					//  Stop if the chain slot has been reused by a later position
+					if (Cand + ChainSize < InsertPos) break;
+					Next = pChain[Cand & ChainMask];
+					if (Next == NoPosition || Next >= Cand) break;
+					Cand = Next;
+				}
+
+				//  If no match was found indicate this to the caller
+				if (BestLen == 0) return 0;
+
+				//  Return the best (longest) string that was located
+				StrOffset = USHORT(Pos - BestPos);
+				return uint32_t(BestLen);
+			}
+
+		private:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Constants                                                                                             *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			static const size_t		HashBits = 16;															//  Hash size (bits)
+			static const size_t		HashSize = size_t(1) << HashBits;										//  Number of hash heads
+			static const size_t		ChainSize = 65536;														//  Number of chain slots (>= window)
+			static const size_t		ChainMask = ChainSize - 1;												//  Chain slot mask
+			static const size_t		NoPosition = ~size_t(0);												//  Empty head or chain
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Members                                                                                               *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			size_t			MaxProbes;																	//  Maximum candidates compared (0 = all)
+			size_t*			pHead;																		//  Hash heads (most recent position)
+			size_t*			pChain;																		//  Chains (previous position with the same hash)
+			size_t			InsertPos;																	//  Next position to be added to the chains
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Functions                                                                                             *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  hashString
+			//
+			//  This function will compute the hash of the first 4 bytes of a string
+			//
+			//  PARAMETERS
+			//
+			//		BYTE*			-		Pointer to the string
+			//
+			//  RETURNS
+			//
+			//		size_t			-		Hash head index
+			//
+			//  NOTES
+			//
+			//
+
+			static size_t	hashString(const BYTE* pString) {
+				uint32_t		Prefix = 0;																	//  First 4 bytes
+
+				memcpy(&Prefix, pString, 4);
+				return size_t((Prefix * 2654435761U) >> (32 - HashBits));
+			}
+
+		};
+
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   StreamEncoder Class																							*
+		//*                                                                                                                 *
+		//*   This class provides an incremental Chimera compressor. Content is fed to the encoder as it is produced and	*
+		//*   the compressed stream is drained as it becomes available, only a single block is held at any time.			*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class StreamEncoder {
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors                                                                                                  *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  StreamEncoder  -  Normal Constructor
+			//
+			//  Constructs a new StreamEncoder using the configuration of the passed Chimera CODEC.
+			//
+			//	PARAMETERS:
+			//
+			//		Chimera&				-			Reference to the configured CODEC (must outlive the encoder)
+			//		size_t					-			Size of the blocks (bytes)
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		The options and window size of the CODEC are captured at construction.
+			//
+
+			StreamEncoder(Chimera& Owner, size_t Size = DefaultStreamBlockSize) : Codec(Owner) {
+
+				Options = Owner.PermittedOptions;
+				Window = Owner.WindowSize;
+				BlockSize = Size;
+				if (BlockSize < MinBlockSize) BlockSize = MinBlockSize;
+				if (BlockSize > MaxBlockSize) BlockSize = MaxBlockSize;
+				BlockLen = 0;
+				OutSize = StreamHeaderSize + (2 * StreamRecordSize) + BlockSize;
+				OutLen = 0;
+				OutPos = 0;
+				FlushPending = false;
+				Finishing = false;
+				Finished = false;
+				Failed = false;
+
+				//  Allocate the block and output buffers
+				pBlock = (BYTE*)malloc(BlockSize);
+				pOut = (BYTE*)malloc(OutSize);
+				if (pBlock == nullptr || pOut == nullptr) {
+					Codec.os << "ERROR: The Chimera stream encoder could not be created, storage is exhausted." << std::endl;
+					Failed = true;
+					return;
+				}
+
+				//  Queue the stream header
+				memcpy(pOut, "CHS1", 4);
+				putFrameValue(pOut + 4, Options, 4);
+				putFrameValue(pOut + 8, Window, 2);
+				putFrameValue(pOut + 10, 0, 2);
+				putFrameValue(pOut + 12, BlockSize, 4);
+				OutLen = StreamHeaderSize;
+
+				//  Return to caller
+				return;
+			}
+
+			//  Encoders are not copyable nor moveable
+			StreamEncoder(const StreamEncoder& Src) = delete;
+			StreamEncoder(StreamEncoder&& Src) = delete;
+			StreamEncoder& operator = (const StreamEncoder& rhs) = delete;
+			StreamEncoder& operator = (StreamEncoder&& rhs) = delete;
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Destructor	                                                                                                *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//	destructor
+			//
+			//	Destroys a StreamEncoder object, any content that has not been drained is discarded.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			~StreamEncoder() {
+
+				if (pBlock != nullptr) free(pBlock);
+				if (pOut != nullptr) free(pOut);
+
+				//  Return to caller
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  feed
+			//
+			//  Passes content to the encoder.
+			//
+			//	PARAMETERS:
+			//
+			//		BYTE*					-			Const pointer to the content
+			//		size_t					-			Length of the content
+			//
+			//	RETURNS:
+			//
+			//		size_t					-			Number of bytes accepted
+			//
+			//  NOTES:
+			//
+			//	1.		Fewer bytes than offered are accepted when the output is full, drain() the output and feed the remainder.
+			//	2.		No content is accepted while a flush is pending or after finish().
+			//
+
+			size_t	feed(const BYTE* pData, size_t Len) {
+				size_t		Accepted = 0;																		//  Bytes accepted
+				size_t		Chunk = 0;																			//  Bytes copied to the block
+
+				if (Failed || Finishing || pData == nullptr) return 0;
+				pump();
+				if (FlushPending) return 0;
+
+				while (Accepted < Len) {
+					if (BlockLen == BlockSize && !codeBlock()) break;
+					Chunk = Len - Accepted;
+					if (Chunk > BlockSize - BlockLen) Chunk = BlockSize - BlockLen;
+					memcpy(pBlock + BlockLen, pData + Accepted, Chunk);
+					BlockLen += Chunk;
+					Accepted += Chunk;
+				}
+
+				return Accepted;
+			}
+
+			//  drain
+			//
+			//  Takes compressed content from the encoder.
+			//
+			//	PARAMETERS:
+			//
+			//		BYTE*					-			Pointer to the buffer to receive the compressed content
+			//		size_t					-			Size of the buffer
+			//
+			//	RETURNS:
+			//
+			//		size_t					-			Number of bytes returned, 0 when no compressed content is available
+			//
+			//  NOTES:
+			//
+
+			size_t	drain(BYTE* pBuf, size_t Len) {
+				size_t		Given = 0;																			//  Bytes returned
+				size_t		Chunk = 0;																			//  Bytes copied
+
+				if (pBuf == nullptr || pOut == nullptr) return 0;
+
+				while (Given < Len) {
+					if (OutPos == OutLen) {
+						pump();
+						if (OutPos == OutLen) break;
+					}
+					Chunk = OutLen - OutPos;
+					if (Chunk > Len - Given) Chunk = Len - Given;
+					memcpy(pBuf + Given, pOut + OutPos, Chunk);
+					OutPos += Chunk;
+					Given += Chunk;
+				}
+
+				return Given;
+			}
+
+			//  flush
+			//
+			//  Requests a flush point, the content fed so far is compressed as a (possibly short) block.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		Once the flushed content has been drained a decoder can reproduce all of the content fed so far.
+			//	2.		Every flush point ends a block, frequent flushes reduce the compression ratio.
+			//
+
+			void	flush() {
+
+				if (Failed || Finishing) return;
+				FlushPending = true;
+				pump();
+				return;
+			}
+
+			//  finish
+			//
+			//  Ends the stream, the remaining content and the end of stream marker are queued for draining.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			void	finish() {
+
+				if (Failed) return;
+				Finishing = true;
+				FlushPending = true;
+				pump();
+				return;
+			}
+
+			//  isFinished
+			//
+			//  Determines if the stream has been finished and completely drained.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the stream is complete, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	isFinished() const { return Finished && OutPos == OutLen; }
+
+			//  hasFailed
+			//
+			//  Determines if the encoder could not be created.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the encoder is unusable, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	hasFailed() const { return Failed; }
+
+		private:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Members                                                                                               *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			Chimera&		Codec;																		//  Owning CODEC
+			SWITCHES		Options;																	//  Permitted options
+			USHORT			Window;																		//  Window size
+			size_t			BlockSize;																	//  Block size
+			BYTE*			pBlock;																		//  Block being accumulated
+			size_t			BlockLen;																	//  Length of the block content
+			BYTE*			pOut;																		//  Compressed output buffer
+			size_t			OutSize;																	//  Size of the output buffer
+			size_t			OutLen;																		//  Length of the output
+			size_t			OutPos;																		//  Next output byte to drain
+			bool			FlushPending;																//  Flush point requested
+			bool			Finishing;																	//  Stream end requested
+			bool			Finished;																	//  End of stream marker queued
+			bool			Failed;																		//  Encoder is unusable
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Functions                                                                                             *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  pump
+			//
+			//  This function will move pending blocks and the end of stream marker into the output buffer when there is space.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			void	pump() {
+
+				if (Failed) return;
+				if (BlockLen == BlockSize || (FlushPending && BlockLen > 0)) codeBlock();
+				if (FlushPending && BlockLen == 0) FlushPending = false;
+
+				//  Queue the end of stream marker
+				if (Finishing && !Finished && BlockLen == 0 && compact(StreamRecordSize)) {
+					putFrameValue(pOut + OutLen, 0, 4);
+					putFrameValue(pOut + OutLen + 4, 0, 4);
+					OutLen += StreamRecordSize;
+					Finished = true;
+				}
+
+				//  Return to caller
+				return;
+			}
+
+			//  codeBlock
+			//
+			//  This function will compress the accumulated block into the output buffer.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the block was moved to the output, false if the output is full
+			//
+			//  NOTES:
+			//
+			//	1.		Blocks that do not compress (or that could not be compressed) are stored as is.
+			//
+
+			bool	codeBlock() {
+				FrameBlock		Block = {};																//  Block descriptor
+
+				if (BlockLen == 0) return true;
+				if (!compact(StreamRecordSize + BlockLen)) return false;
+
+				Block.pRaw = pBlock;
+				Block.RLen = BlockLen;
+				Codec.codeFrameBlock(Block, Options, Window, true, Codec.os);
+				if (Block.pComp == nullptr) Block.CLen = Block.RLen;
+
+				//  Queue the block record
+				putFrameValue(pOut + OutLen, Block.RLen, 4);
+				putFrameValue(pOut + OutLen + 4, Block.CLen, 4);
+				memcpy(pOut + OutLen + StreamRecordSize, (Block.pComp == nullptr) ? Block.pRaw : Block.pComp, Block.CLen);
+				OutLen += StreamRecordSize + Block.CLen;
+				if (Block.pComp != nullptr) free(Block.pComp);
+
+				BlockLen = 0;
+				return true;
+			}
+
+			//  compact
+			//
+			//  This function will discard drained output and determine if there is space for more output.
+			//
+			//	PARAMETERS:
+			//
+			//		size_t					-			Space required (bytes)
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the space is available, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	compact(size_t Needed) {
+
+				if (OutPos > 0) {
+					if (OutLen > OutPos) memmove(pOut, pOut + OutPos, OutLen - OutPos);
+					OutLen -= OutPos;
+					OutPos = 0;
+				}
+
+				return (OutSize - OutLen) >= Needed;
+			}
+
+		};
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   StreamDecoder Class																							*
+		//*                                                                                                                 *
+		//*   This class provides an incremental Chimera decompressor for streams produced by StreamEncoder. The			*
+		//*   compressed stream is fed as it arrives and the content is drained a block at a time.							*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class StreamDecoder {
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors                                                                                                  *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  StreamDecoder  -  Normal Constructor
+			//
+			//  Constructs a new StreamDecoder using the passed Chimera CODEC.
+			//
+			//	PARAMETERS:
+			//
+			//		Chimera&				-			Reference to the CODEC (must outlive the decoder)
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		The options, window size and block size are taken from the stream header, the buffers are allocated
+			//			when the header has been read.
+			//
+
+			StreamDecoder(Chimera& Owner) : Codec(Owner) {
+
+				memset(Header, 0, StreamHeaderSize);
+				HdrLen = 0;
+				Options = 0;
+				Window = 0;
+				BlockSize = 0;
+				pIn = nullptr;
+				InLen = 0;
+				Need = StreamRecordSize;
+				RLen = 0;
+				pOut = nullptr;
+				OutLen = 0;
+				OutPos = 0;
+				Complete = false;
+				Failed = false;
+
+				//  Return to caller
+				return;
+			}
+
+			//  Decoders are not copyable nor moveable
+			StreamDecoder(const StreamDecoder& Src) = delete;
+			StreamDecoder(StreamDecoder&& Src) = delete;
+			StreamDecoder& operator = (const StreamDecoder& rhs) = delete;
+			StreamDecoder& operator = (StreamDecoder&& rhs) = delete;
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Destructor	                                                                                                *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//	destructor
+			//
+			//	Destroys a StreamDecoder object.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			~StreamDecoder() {
+
+				if (pIn != nullptr) free(pIn);
+				if (pOut != nullptr) free(pOut);
+
+				//  Return to caller
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  feed
+			//
+			//  Passes compressed content to the decoder.
+			//
+			//	PARAMETERS:
+			//
+			//		BYTE*					-			Const pointer to the compressed content
+			//		size_t					-			Length of the compressed content
+			//
+			//	RETURNS:
+			//
+			//		size_t					-			Number of bytes accepted
+			//
+			//  NOTES:
+			//
+			//	1.		Fewer bytes than offered are accepted when a decoded block is waiting to be drained, drain() the
+			//			content and feed the remainder.
+			//	2.		Nothing is accepted after the end of stream marker or once the stream has been found to be invalid.
+			//
+
+			size_t	feed(const BYTE* pData, size_t Len) {
+				size_t		Accepted = 0;																		//  Bytes accepted
+				size_t		Chunk = 0;																			//  Bytes copied
+
+				if (pData == nullptr) return 0;
+
+				while (!Failed && !Complete) {
+
+					//  Decode a complete block
+					if (Need > StreamRecordSize && InLen == Need) {
+						if (!decodeBlock()) break;
+						continue;
+					}
+					if (Accepted == Len) break;
+
+					//  Accumulate the stream header
+					if (HdrLen < StreamHeaderSize) {
+						Chunk = StreamHeaderSize - HdrLen;
+						if (Chunk > Len - Accepted) Chunk = Len - Accepted;
+						memcpy(Header + HdrLen, pData + Accepted, Chunk);
+						HdrLen += Chunk;
+						Accepted += Chunk;
+						if (HdrLen == StreamHeaderSize) readHeader();
+						continue;
+					}
+
+					//  Accumulate the block record
+					Chunk = Need - InLen;
+					if (Chunk > Len - Accepted) Chunk = Len - Accepted;
+					memcpy(pIn + InLen, pData + Accepted, Chunk);
+					InLen += Chunk;
+					Accepted += Chunk;
+					if (Need == StreamRecordSize && InLen == StreamRecordSize) readRecord();
+				}
+
+				return Accepted;
+			}
+
+			//  drain
+			//
+			//  Takes decompressed content from the decoder.
+			//
+			//	PARAMETERS:
+			//
+			//		BYTE*					-			Pointer to the buffer to receive the content
+			//		size_t					-			Size of the buffer
+			//
+			//	RETURNS:
+			//
+			//		size_t					-			Number of bytes returned, 0 when no content is available
+			//
+			//  NOTES:
+			//
+
+			size_t	drain(BYTE* pBuf, size_t Len) {
+				size_t		Given = 0;																			//  Bytes returned
+				size_t		Chunk = 0;																			//  Bytes copied
+
+				if (pBuf == nullptr) return 0;
+
+				while (Given < Len) {
+					if (OutPos == OutLen) {
+						if (Failed || Need == StreamRecordSize || InLen < Need || !decodeBlock()) break;
+						continue;
+					}
+					Chunk = OutLen - OutPos;
+					if (Chunk > Len - Given) Chunk = Len - Given;
+					memcpy(pBuf + Given, pOut + OutPos, Chunk);
+					OutPos += Chunk;
+					Given += Chunk;
+				}
+
+				return Given;
+			}
+
+			//  isComplete
+			//
+			//  Determines if the end of stream marker has been read and all of the content has been drained.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the stream is complete, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	isComplete() const { return Complete && OutPos == OutLen; }
+
+			//  hasFailed
+			//
+			//  Determines if the compressed stream has been found to be invalid or damaged.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the stream is invalid, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	hasFailed() const { return Failed; }
+
+		private:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Members                                                                                               *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			Chimera&		Codec;																		//  Owning CODEC
+			BYTE			Header[StreamHeaderSize];													//  Stream header
+			size_t			HdrLen;																		//  Length of the header read
+			SWITCHES		Options;																	//  Permitted options
+			USHORT			Window;																		//  Window size
+			size_t			BlockSize;																	//  Block size
+			BYTE*			pIn;																		//  Block record being accumulated
+			size_t			InLen;																		//  Length of the block record read
+			size_t			Need;																		//  Length of the block record
+			size_t			RLen;																		//  Content length of the block
+			BYTE*			pOut;																		//  Decompressed block
+			size_t			OutLen;																		//  Length of the decompressed block
+			size_t			OutPos;																		//  Next content byte to drain
+			bool			Complete;																	//  End of stream marker read
+			bool			Failed;																		//  Stream is invalid or damaged
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Functions                                                                                             *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  readHeader
+			//
+			//  This function will validate the stream header and allocate the block buffers.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+
+			void	readHeader() {
+
+				if (memcmp(Header, "CHS1", 4) != 0 || getFrameValue(Header + 10, 2) != 0) {
+					Codec.os << "ERROR: The input stream is not a valid Chimera stream." << std::endl;
+					Failed = true;
+					return;
+				}
+				Options = SWITCHES(getFrameValue(Header + 4, 4));
+				Window = USHORT(getFrameValue(Header + 8, 2));
+				BlockSize = size_t(getFrameValue(Header + 12, 4));
+				if (BlockSize < MinBlockSize || BlockSize > MaxBlockSize) {
+					Codec.os << "ERROR: The Chimera stream header specifies an invalid block size: " << BlockSize << "." << std::endl;
+					Failed = true;
+					return;
+				}
+
+				//  Allocate the block buffers
+				pIn = (BYTE*)malloc(StreamRecordSize + BlockSize);
+				pOut = (BYTE*)malloc(BlockSize);
+				if (pIn == nullptr || pOut == nullptr) {
+					Codec.os << "ERROR: The Chimera stream could not be decompressed, storage is exhausted." << std::endl;
+					Failed = true;
+				}
+
+				//  Return to caller
+				return;
+			}
+
+			//  readRecord
+			//
+			//  This function will validate a block record header and determine the length of the record.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		A record with zero lengths marks the end of the stream, a compressed length equal to the content length
+			//			marks a stored block.
+			//
+
+			void	readRecord() {
+				size_t		CLen = size_t(getFrameValue(pIn + 4, 4));									//  Compressed length
+
+				RLen = size_t(getFrameValue(pIn, 4));
+				InLen = 0;
+
+				//  End of stream
+				if (RLen == 0 && CLen == 0) {
+					Complete = true;
+					return;
+				}
+
+				if (RLen == 0 || CLen == 0 || RLen > BlockSize || CLen > RLen) {
+					Codec.os << "ERROR: The Chimera stream contains an invalid block record (" << RLen << "/" << CLen << ")." << std::endl;
+					Failed = true;
+					return;
+				}
+
+				//  The record header is retained ahead of the block
+				InLen = StreamRecordSize;
+				Need = StreamRecordSize + CLen;
+
+				//  Return to caller
+				return;
+			}
+
+			//  decodeBlock
+			//
+			//  This function will decompress the accumulated block into the output buffer.
+			//
+			//	PARAMETERS:
+			//
+			//	RETURNS:
+			//
+			//		bool					-			true if the block was decompressed, false if the output has not been drained
+			//
+			//  NOTES:
+			//
+
+			bool	decodeBlock() {
+				FrameBlock		Block = {};																//  Block descriptor
+
+				if (OutPos < OutLen) return false;
+
+				Block.pComp = pIn + StreamRecordSize;
+				Block.CLen = Need - StreamRecordSize;
+				Block.pRaw = pOut;
+				Block.RLen = RLen;
+				Codec.codeFrameBlock(Block, Options, Window, false, Codec.os);
+				if (!Block.Done) {
+					Codec.os << "ERROR: The Chimera stream contains a block that is invalid or damaged." << std::endl;
+					Failed = true;
+					return false;
+				}
+
+				OutLen = RLen;
+				OutPos = 0;
+				InLen = 0;
+				Need = StreamRecordSize;
+				return true;
+			}
+
+		};
+
 	};
 
 }
@@ -3,10 +3,10 @@
 //*																													*
 //*   File:       Cache.h																							*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.0.1	(Build: 02)																					*
+//*   Version:    1.4.1	(Build: 07)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2017 - 2024 Ian J. Tree.														*
+//*   Copyright 2017 - 2024 Ian J. Tree.																			*
 //*******************************************************************************************************************
 //*																													*
 //*	This header file contains the definition for the Cache class. The class is the base for all Cache types			*
@@ -17,7 +17,22 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.		This is the single threaded implementation. It is NOT thread safe.										*
+//*	1.		The cache lines are partitioned into shards by a hash of the record key. Each shard has its own lock,	*
+//*			budget, key pool and eviction order so that threads working on different shards do not contend.			*
+//*			A cache constructed with a single shard behaves exactly as the original single threaded cache.			*
+//*	2.		Records may be pinned with pinCachedRecord(), the returned CachedRef keeps the record alive and			*
+//*			un-evictable until the reference is released or destroyed.												*
+//*	3.		Statistics are accumulated in per-thread counter slots and aggregated on demand by getStats().			*
+//*	4.		With WRITE_BEHIND dirty records leaving the cache are queued for a background writer thread, repeated	*
+//*			writes to a key are coalesced and the queue is written in batches. Writers are held back when the		*
+//*			queued (dirty) bytes exceed the write-behind limit.														*
+//*	5.		The storage interface functions (getStoredRecord() etc.) may be called concurrently for different		*
+//*			shards, extending classes must be thread safe when the cache is shared between threads.					*
+//*	6.		With SLAB_RECORDS records allocated by allocateRecord() are carved from size-class slabs owned by the	*
+//*			cache and the budget is accounted by the slab block size of each record. Records are also evicted		*
+//*			while the memory committed by the arena (getFootprint()) exceeds the cache budget (plus the				*
+//*			write-behind limit). SLAB_HUGE_PAGES requests that the slabs are backed by huge pages, the arena		*
+//*			budget is then rounded up to whole slabs.																*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -25,6 +40,11 @@
 //*																													*
 //*	1.0.0 -		02/12/2017	-	Initial Release																		*
 //*	1.0.1 -		04/12/2024	-	Winter Cleanup																		*
+//*	1.1.0 -		19/10/2026	-	Sharded cache lines with per-shard locking and per-thread statistics				*
+//*	1.2.0 -		19/10/2026	-	Pinned record references (CachedRef)												*
+//*	1.3.0 -		19/10/2026	-	Asynchronous write-behind with coalescing and back-pressure							*
+//*	1.4.0 -		19/10/2026	-	Slab arena record storage (SLAB_RECORDS)											*
+//*	1.4.1 -		19/10/2026	-	Evict against the committed arena footprint											*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -36,8 +56,14 @@
 #include	"types.h"																		//  xymorg type definitions
 #include	"consts.h"																		//  xymorg constant definitions
 #include	"StringPool.h"																	//  String Pool
+#include	"SlabArena.h"																	//  Slab arena (record storage)
 #include	"Logging.h"																		//  Logging message class
 
+
+//  Additional Language Headers
+#include	<mutex>																			//  Shard locks
+#include	<condition_variable>															//  Write-behind signalling
+
 //
 //  All components are defined within the xymorg namespace
 //
@@ -63,6 +89,12 @@ namespace xymorg {
 		static const SWITCHES	OBSERVE_KEY_CASE = 0x00000010;										//  Keys are case sensitive
 		static const SWITCHES	CACHE_NOT_EXIST = 0x00000020;										//  Cache non-existent keys (Negative cacheing)
 		static const SWITCHES	WRITE_DEFERRED = 0x00000040;										//  Writes through the cache are deferred
+		static const SWITCHES	WRITE_BEHIND = 0x00000080;											//  Deferred writes are performed by a background thread
+		static const SWITCHES	SLAB_RECORDS = 0x00000100;											//  Records are stored in (and accounted by) the slab arena
+		static const SWITCHES	SLAB_HUGE_PAGES = 0x00000200;										//  Slab arena is backed by huge pages
+
+		static const size_t		MAX_SHARDS = 64;													//  Maximum number of cache shards
+		static const size_t		DEFAULT_WRITE_BEHIND_LIMIT = 4096;									//  Default write-behind queue limit (Kb)
 
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
@@ -89,13 +121,17 @@ namespace xymorg {
 			size_t		Inspects;																	//  Number of cache line inspections
 			size_t		Evictions;																	//  Number of cache evictions
 			size_t		Expires;																	//  Number of cache entries that expired
+			size_t		Coalesces;																	//  Number of write-behind writes coalesced
+			size_t		Batches;																	//  Number of write-behind batches written
 			size_t		MaxEnts;																	//  Maximum count of cache entries
 			size_t		MaxSize;																	//  Maximum size of the cache (Kb)
+			size_t		ArenaSize;																	//  Memory held by the slab arena (Kb)
 		} Stats;
 
 	private:
 
 		static const int NumLines = 256;															//  Default number of cache lines
+		static const int NumStatSlots = 32;															//  Number of per-thread statistics slots
 
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
@@ -111,11 +147,158 @@ namespace xymorg {
 			STRREF		RKey;																		//  Key of the record/object
 			size_t		RLen;																		//  Length of the record/object
 			BYTE*		RPtr;																		//  Pointer to the cached record/object
+			size_t		Pins;																		//  Count of outstanding pinned references
 			bool		DirtyBit;																	//  Cache line represents an updated record/object
 		} CacheLine;
 
+		//   Retired Record (a pinned record that has been replaced or purged from the cache)
+		typedef struct RetiredRecord {
+			BYTE*		RPtr;																		//  Pointer to the record/object
+			size_t		RLen;																		//  Length of the record/object
+			size_t		Pins;																		//  Count of outstanding pinned references
+		} RetiredRecord;
+
+		//   Pending Write (a dirty record queued for the write-behind thread)
+		typedef struct PendingWrite {
+			char*		Key;																		//  Key of the record/object (owned copy)
+			BYTE*		RPtr;																		//  Pointer to the record/object
+			size_t		RLen;																		//  Length of the record/object
+		} PendingWrite;
+
+		//   Cache Shard
+		typedef struct CacheShard {
+			std::mutex	Lock;																		//  Shard lock
+			CacheLine*	pCL;																		//  Cache lines
+			size_t		Budget;																		//  Budget size (Kb)
+			size_t		NCL;																		//  Number of cache lines (size of pool)
+			size_t		UCL;																		//  Number of cache lines used
+			size_t		Size;																		//  Shard size (bytes)
+			StringPool	Keys;																		//  String pool holding the keys
+			RetiredRecord*	pRR;																	//  Retired records awaiting release
+			size_t		NRR;																		//  Number of retired record slots
+			size_t		URR;																		//  Number of retired record slots used
+		} CacheShard;
+
+		//   Statistics Slot (counters for the threads that hash to the slot, aligned to avoid false sharing)
+		typedef struct alignas(64) StatSlot {
+			std::atomic<size_t>		Hits;															//  Number of cache hits
+			std::atomic<size_t>		Misses;															//  Number of cache misses
+			std::atomic<size_t>		Reads;															//  Number of cache reads
+			std::atomic<size_t>		Peeks;															//  Number of cache peeks
+			std::atomic<size_t>		Writes;															//  Number of cache writes
+			std::atomic<size_t>		DirtyWrites;													//  Number of Write-Throughs
+			std::atomic<size_t>		Purges;															//  Number of records purged from the cache
+			std::atomic<size_t>		NotFound;														//  Not found (in cache or store)
+			std::atomic<size_t>		Inspects;														//  Number of cache line inspections
+			std::atomic<size_t>		Evictions;														//  Number of cache evictions
+			std::atomic<size_t>		Expires;														//  Number of cache entries that expired
+			std::atomic<size_t>		Coalesces;														//  Number of write-behind writes coalesced
+			std::atomic<size_t>		Batches;														//  Number of write-behind batches written
+		} StatSlot;
+
+		typedef std::atomic<size_t> StatSlot::* StatCounter;										//  Selector for a counter in a slot
+
 	public:
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   CachedRef Class                                                                                               *
+		//*                                                                                                                 *
+		//*   Objects of this class hold a pinned reference to a record in the cache. While the reference is held the       *
+		//*   record will not be evicted, expired or destroyed, it is released when the reference is destroyed.             *
+		//*                                                                                                                 *
+		//*   PROPERTIES:                                                                                                   *
+		//*                                                                                                                 *
+		//*     NOT COPYABLE                                                                                                *
+		//*     MOVEABLE                                                                                                    *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class CachedRef {
+		public:
+
+			//  Default Constructor - constructs an empty (invalid) reference
+			CachedRef() : pOwner(nullptr), pShard(nullptr), pRec(nullptr), RLen(0), TTL(0) {}
+
+			//  Not copyable
+			CachedRef(const CachedRef& Src) = delete;
+			CachedRef& operator = (const CachedRef& rhs) = delete;
+
+			//  Move Constructor - the source reference is emptied
+			CachedRef(CachedRef&& Src) noexcept : pOwner(Src.pOwner), pShard(Src.pShard), pRec(Src.pRec), RLen(Src.RLen), TTL(Src.TTL) {
+				Src.pOwner = nullptr;
+				Src.pShard = nullptr;
+				Src.pRec = nullptr;
+				Src.RLen = 0;
+				Src.TTL = 0;
+				return;
+			}
+
+			//  Move Assignment - any currently held reference is released, the source reference is emptied
+			CachedRef& operator = (CachedRef&& rhs) noexcept {
+				if (this == &rhs) return *this;
+				release();
+				pOwner = rhs.pOwner;
+				pShard = rhs.pShard;
+				pRec = rhs.pRec;
+				RLen = rhs.RLen;
+				TTL = rhs.TTL;
+				rhs.pOwner = nullptr;
+				rhs.pShard = nullptr;
+				rhs.pRec = nullptr;
+				rhs.RLen = 0;
+				rhs.TTL = 0;
+				return *this;
+			}
+
+			//  Destructor - releases the pin
+			~CachedRef() {
+				release();
+				return;
+			}
+
+			//  Accessors
+			BYTE*		getRecord() const { return pRec; }
+			size_t		getLength() const { return RLen; }
+			size_t		getTTL() const { return TTL; }
+			bool		isValid() const { return pRec != nullptr; }
+			explicit operator bool() const { return pRec != nullptr; }
+
+			//  release
+			//
+			//  Releases the pin on the referenced record, the reference becomes empty.
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//
+
+			void		release() {
+				if (pOwner != nullptr && pRec != nullptr) pOwner->unpin(pShard, pRec);
+				pOwner = nullptr;
+				pShard = nullptr;
+				pRec = nullptr;
+				RLen = 0;
+				TTL = 0;
+				return;
+			}
+
+		private:
+
+			friend class Cache;
+
+			//  Constructor - only the cache constructs populated references
+			CachedRef(Cache* Owner, CacheShard* Shard, BYTE* Rec, size_t Len, size_t RecTTL) : pOwner(Owner), pShard(Shard), pRec(Rec), RLen(Len), TTL(RecTTL) {}
+
+			Cache*			pOwner;																	//  Owning cache
+			CacheShard*		pShard;																	//  Shard holding the record
+			BYTE*			pRec;																	//  Pinned record
+			size_t			RLen;																	//  Length of the record
+			size_t			TTL;																	//  TTL of the record when pinned
+		};
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Constructors			                                                                                        *
@@ -135,36 +318,116 @@ namespace xymorg {
 		//
 		//  NOTES:
 		//
-		//	1.	Extending classes MUST invoke this constructor
+		//	1.	Extending classes MUST invoke this constructor or the sharded variant
+		//	2.	The cache is constructed with a single shard
+		//
+
+		Cache(SWITCHES NewCfg, size_t NewBudget) : Cache(NewCfg, NewBudget, 1) {}
+
+		//  Constructor 
+		//
+		//  Constructs a new sharded Cache (base) with the given attributes
+		//
+		//  PARAMETERS:
+		//
+		//		SWITCHES			-		Cache configuration options
+		//		size_t				-		Budget size (Kb)
+		//		size_t				-		Number of shards
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	Extending classes MUST invoke this constructor or the single shard variant
+		//	2.	The budget is divided equally between the shards, each shard observes its own budget
+		//	3.	Eviction ordering (LRU/LFU) is maintained independently within each shard
 		//
 
-		Cache(SWITCHES NewCfg, size_t NewBudget) : Coherent(false)
+		Cache(SWITCHES NewCfg, size_t NewBudget, size_t NewShards) : Coherent(false)
 			, COpts(NewCfg)
-			, pCL(nullptr)
-			, Budget(NewBudget)
-			, NCL(0)
-			, UCL(0)
-			, Size(0)
-			, Keys()
-			, StatRec() {
-
-			//  Allocate the cache-line pool for the initial number of entries
-			pCL = (CacheLine*) malloc(NumLines * sizeof(CacheLine));
-			if (pCL == nullptr) return;
-			for (int iIndex = 0; iIndex < NumLines; iIndex++) {
-				pCL[iIndex].DirtyBit = false;
-				pCL[iIndex].Expiry = CLOCK::now();
-				pCL[iIndex].LastRef = CLOCK::now();
-				pCL[iIndex].RefCount = 0;
-				pCL[iIndex].RKey = NULLSTRREF;
-				pCL[iIndex].RLen = 0;
-				pCL[iIndex].RPtr = nullptr;
-			}
-			NCL = NumLines;
+			, pShards(nullptr)
+			, NShards(NewShards)
+			, Slots()
+			, CEnts(0)
+			, CSize(0)
+			, MaxEnts(0)
+			, MaxSize(0)
+			, StatLock()
+			, StatRec()
+			, pWB(nullptr)
+			, NWB(0)
+			, UWB(0)
+			, pWBF(nullptr)
+			, NWBF(0)
+			, UWBF(0)
+			, WBBytes(0)
+			, WBLimit(DEFAULT_WRITE_BEHIND_LIMIT)
+			, WBStop(false)
+			, WBLock()
+			, WBSignal()
+			, WBThread()
+			, Arena((NewCfg & SLAB_HUGE_PAGES) != 0)
+			, ArenaLimit(NewBudget * 1024) {
+
+			//  Safety
+			if (NShards == 0) NShards = 1;
+			if (NShards > MAX_SHARDS) NShards = MAX_SHARDS;
+			if (COpts & WRITE_BEHIND) COpts |= WRITE_DEFERRED;
+			if (COpts & SLAB_HUGE_PAGES) COpts |= SLAB_RECORDS;
+			if (COpts & SLAB_HUGE_PAGES) ArenaLimit = ((ArenaLimit / SlabArena::SlabSize) + 1) * SlabArena::SlabSize;
+
+			//  Allocate the shards
+			pShards = new CacheShard[NShards];
+			if (pShards == nullptr) return;
+
+			//  Allocate the cache-line pool for the initial number of entries in each shard
+			for (size_t SX = 0; SX < NShards; SX++) {
+				CacheShard& Shard = pShards[SX];
+
+				Shard.Budget = (NewBudget + (NShards - 1)) / NShards;
+				if (Shard.Budget == 0) Shard.Budget = 1;
+				Shard.NCL = 0;
+				Shard.UCL = 0;
+				Shard.Size = 0;
+				Shard.pRR = nullptr;
+				Shard.NRR = 0;
+				Shard.URR = 0;
+				Shard.pCL = (CacheLine*) malloc(NumLines * sizeof(CacheLine));
+				if (Shard.pCL == nullptr) return;
+				for (int iIndex = 0; iIndex < NumLines; iIndex++) {
+					Shard.pCL[iIndex].DirtyBit = false;
+					Shard.pCL[iIndex].Expiry = CLOCK::now();
+					Shard.pCL[iIndex].LastRef = CLOCK::now();
+					Shard.pCL[iIndex].RefCount = 0;
+					Shard.pCL[iIndex].RKey = NULLSTRREF;
+					Shard.pCL[iIndex].RLen = 0;
+					Shard.pCL[iIndex].RPtr = nullptr;
+					Shard.pCL[iIndex].Pins = 0;
+				}
+				Shard.NCL = NumLines;
+			}
 
 			//  Clear the statistics
+			for (int SX = 0; SX < NumStatSlots; SX++) {
+				Slots[SX].Hits = 0;
+				Slots[SX].Misses = 0;
+				Slots[SX].Reads = 0;
+				Slots[SX].Peeks = 0;
+				Slots[SX].Writes = 0;
+				Slots[SX].DirtyWrites = 0;
+				Slots[SX].Purges = 0;
+				Slots[SX].NotFound = 0;
+				Slots[SX].Inspects = 0;
+				Slots[SX].Evictions = 0;
+				Slots[SX].Expires = 0;
+				Slots[SX].Coalesces = 0;
+				Slots[SX].Batches = 0;
+			}
 			memset(&StatRec, 0, sizeof(Stats));
 
+			//  Start the write-behind thread
+			if (COpts & WRITE_BEHIND) WBThread = std::thread(&Cache::writeBehind, this);
+
 			//  Mark the cache as coherent
 			Coherent = true;
 
@@ -198,6 +461,13 @@ namespace xymorg {
 			//  Dismiss the cache content
 			dismiss();
 
+			//  Make sure that the write-behind thread has stopped
+			stopWriteBehind();
+
+			//  Release the shards
+			if (pShards != nullptr) delete[] pShards;
+			pShards = nullptr;
+
 			//  Return to caller
 			return;
 		}
@@ -219,7 +489,6 @@ namespace xymorg {
 		//
 		//  This is the primary function for the cache it returns the required record from the cache or initiates a read
 		//  from the store and caches and returns that entry.
-		//  This variant of the call is NOT THREAD SAFE.
 		//
 		//  PARAMETERS:
 		//
@@ -233,16 +502,15 @@ namespace xymorg {
 		//
 		//  NOTES:
 		// 
-		//		1.		The pointer to the cached record that is returned is ONLY valid until the next call to get or put a cached record.
+		//		1.		The pointer to the cached record that is returned is ONLY valid until the next call (from any thread)
+		//				to get or put a cached record in the same shard.
 		//				It is the resposiblity of the caller to guard against use-after-free bugs using the returned pointer.
+		//		2.		Use pinCachedRecord() to hold a record for longer without copying it.
 		//
 
 		BYTE* getCachedRecord(const char* Key, size_t& RecLen, size_t& TTL) {
+			CacheShard*			pShard = nullptr;															//  Shard holding the key
 			CacheLine*			pCEnt = nullptr;															//  Cache line for the entry
-			BYTE*				pNewRec = nullptr;															//  New record to be added to the cache
-			size_t				InsertAt = 0;																//  Cache line index for new insertions
-			TIMER				NowTime = CLOCK::now();														//  Current time
-			SECONDS				TTLSecs = {};																//  TTL in seconds
 
 			//  Safety
 			RecLen = 0;
@@ -252,104 +520,67 @@ namespace xymorg {
 			if (!Coherent) return nullptr;
 
 			//  Update Stats
-			StatRec.Reads++;
+			countStat(&StatSlot::Reads);
 
-			//  Expire any records that are due
-			if (COpts & OBSERVE_EXPIRY) expireRecords();
-
-			//  Search the cache to determine if the passed key is in the cache
-			pCEnt = findCacheLine(Key);
-			if (pCEnt != nullptr) {
-				//  Entry is already in the cache - perform cache management bookeeping and return the record
-				pCEnt->RefCount++;
-				pCEnt->LastRef = CLOCK::now();
-
-				//  Update the statistics
-				StatRec.Hits++;
-
-				//  Promote the entry in the cache
-				pCEnt = promote(pCEnt);
-
-				//  Compute the remaining TTL
-				NowTime = CLOCK::now();
-				TTLSecs = pCEnt->Expiry - NowTime;
-				TTL = size_t(TTLSecs.count());
-				RecLen = pCEnt->RLen;
-				pNewRec = pCEnt->RPtr;
-
-				//  Return the cached record
-				return pNewRec;
-			}
-
-			//  Record not currently in the cache - attempt retrieve  it from the store
-			StatRec.Misses++;
+			//  Lock the shard that holds the key
+			pShard = selectShard(Key);
+			std::lock_guard<std::mutex>		ShardGuard(pShard->Lock);
 
-			//  Attempt to read the desired key from the store
-			pNewRec = getStoredRecord(Key, RecLen, TTL);
-
-			if (pNewRec == nullptr) {
-				StatRec.NotFound++;
-
-				//  If NOT-EXIST records are NOT being cached then return to the caller with NULL
-				if (!(COpts & CACHE_NOT_EXIST)) {
-					return nullptr;
-				}
-			}
+			//  Locate (or load) the cache line for the record
+			pCEnt = acquireCacheLine(*pShard, Key, RecLen, TTL);
+			if (pCEnt == nullptr) return nullptr;
 
-			//  Safety - if the size of the new entry exceeds the budget then increase the budget
-			if (COpts & OBSERVE_BUDGET) {
-				if (((RecLen + 511) / 1024) > Budget) Budget += ((RecLen + 511) / 1024);
-			}
+			//  Return the cached record
+			return pCEnt->RPtr;
+		}
 
-			//  Evict records from the cache until there is sufficient space
-			if (COpts & OBSERVE_BUDGET) evictRecords(RecLen);
+		//  pinCachedRecord
+		//
+		//  This function returns a pinned reference to the required record from the cache or initiates a read from the
+		//  store and caches and returns a pinned reference to that entry.
+		//
+		//  PARAMETERS:
+		//
+		//		char*		-		Pointer to the key for the desired record (NULL terminated string)
+		//
+		//  RETURNS:
+		//
+		//		CachedRef	-		Pinned reference to the record, empty if the record is not available
+		//
+		//  NOTES:
+		// 
+		//		1.		The record will not be evicted, expired or destroyed while the reference is held, it may be consumed
+		//				in place without copying.
+		//		2.		A pinned record that is replaced by writeRecord() or purged remains valid until it is released.
+		//		3.		All references must be released before the cache is dismissed.
+		//
 
-			//  Make sure that the cache line pool has capacity
-			if (NCL == UCL) {
-				CacheLine* pNewPool = (CacheLine*)realloc(pCL, (NCL + NumLines) * sizeof(CacheLine));
-				if (pNewPool == nullptr) {
-					Coherent = false;
-					destroyCachedRecord(pNewRec, RecLen);
-					return nullptr;
-				}
-				pCL = pNewPool;
-				NCL += NumLines;
-			}
+		CachedRef pinCachedRecord(const char* Key) {
+			CacheShard*			pShard = nullptr;															//  Shard holding the key
+			CacheLine*			pCEnt = nullptr;															//  Cache line for the entry
+			size_t				RecLen = 0;																	//  Record length
+			size_t				TTL = 0;																	//  Record TTL
 
-			//
-			//  Determine the point at which the insertion will take place and clear that slot
-			//
-			if (COpts & EVICTION_STRATEGY_LRU) {
-				//  LRU - make room at the head of the cache line array
-				if (UCL > 0) memmove(&pCL[1], &pCL[0], UCL * sizeof(CacheLine));
-				InsertAt = 0;
-			}
-			else {
-				//  LFU - new cache lines are appended to the existing
-				InsertAt = UCL;
-			}
+			//  Safety
+			if (Key == nullptr) return CachedRef();
+			if (Key[0] == '\0') return CachedRef();
+			if (!Coherent) return CachedRef();
 
-			//  Insert the new record into the cache
-			pCL[InsertAt].DirtyBit = false;
-			if (TTL == 0) TTL = size_t(24 * 60 * 60);													//  Default 24 hrs
-			pCL[InsertAt].Expiry = CLOCK::now() + MILLISECONDS(TTL * 1000);
-			pCL[InsertAt].LastRef = CLOCK::now();
-			pCL[InsertAt].RefCount = 1;
-			pCL[InsertAt].RKey = Keys.addString(Key);
-			pCL[InsertAt].RLen = RecLen;
-			pCL[InsertAt].RPtr = pNewRec;
+			//  Update Stats
+			countStat(&StatSlot::Reads);
 
-			//  LFU - promote the entry
-			if (COpts & EVICTION_STRATEGY_LFU) promote(&pCL[InsertAt]);
+			//  Lock the shard that holds the key
+			pShard = selectShard(Key);
+			std::lock_guard<std::mutex>		ShardGuard(pShard->Lock);
 
-			//  Bookeeping
-			UCL++;
-			Size += RecLen;
-			if (UCL > StatRec.MaxEnts) StatRec.MaxEnts = UCL;
-			if (((Size + 511) / 1024) > StatRec.MaxSize) StatRec.MaxSize = ((Size + 511) / 1024);
+			//  Locate (or load) the cache line for the record
+			pCEnt = acquireCacheLine(*pShard, Key, RecLen, TTL);
+			if (pCEnt == nullptr) return CachedRef();
+			if (pCEnt->RPtr == nullptr) return CachedRef();
 
-			//  Return the entry
-			return pNewRec;
+			//  Pin the record and return the reference
+			pCEnt->Pins++;
+			return CachedRef(this, pShard, pCEnt->RPtr, RecLen, TTL);
 		}
 
 		//  peekCachedRecord
@@ -357,7 +588,6 @@ namespace xymorg {
 		//  This is the primary function for the cache it returns the required record from the cache or initiates a read
 		//  from the store and caches and returns that entry.
 		//  Peek does not update the cache by counting hits or recording last accessed times.
-		//  This variant of the call is NOT THREAD SAFE.
 		//
 		//  PARAMETERS:
 		//
@@ -373,6 +603,7 @@ namespace xymorg {
 		//
 
 		BYTE* peekCachedRecord(const char* Key, size_t& RecLen, size_t& TTL) {
+			CacheShard*			pShard = nullptr;															//  Shard holding the key
 			CacheLine*			pCEnt = nullptr;															//  Cache line for the entry
 			BYTE*				pNewRec = nullptr;															//  New record to be added to the cache
 			TIMER				NowTime = CLOCK::now();														//  Current time
@@ -386,17 +617,21 @@ namespace xymorg {
 			if (!Coherent) return nullptr;
 
 			//  Count number of peeks
-			StatRec.Peeks++;
+			countStat(&StatSlot::Peeks);
+
+			//  Lock the shard that holds the key
+			pShard = selectShard(Key);
+			std::lock_guard<std::mutex>		ShardGuard(pShard->Lock);
 
 			//  Expire any records that are due
-			if (COpts & OBSERVE_EXPIRY) expireRecords();
+			if (COpts & OBSERVE_EXPIRY) expireRecords(*pShard);
 
 			//  Search the cache to determine if the passed key is in the cache
-			pCEnt = findCacheLine(Key);
+			pCEnt = findCacheLine(*pShard, Key);
 			if (pCEnt != nullptr) {
 
 				//  Update the statistics
-				StatRec.Hits++;
+				countStat(&StatSlot::Hits);
 
 				//  Compute the remaining TTL
 				NowTime = CLOCK::now();
@@ -410,7 +645,7 @@ namespace xymorg {
 			}
 
 			//  Update the statistics
-			StatRec.Misses++;
+			countStat(&StatSlot::Misses);
 
 			//  No cache entry was available to return
 			return nullptr;
@@ -420,7 +655,6 @@ namespace xymorg {
 		//
 		//  This function will write a record through the cache. 
 		//  The passed buffer will be owned by the cache on completion.
-		//  This variant of the call is NOT THREAD SAFE.
 		//
 		//  PARAMETERS:
 		//
@@ -437,6 +671,7 @@ namespace xymorg {
 		//
 
 		bool		writeRecord(const char* Key, BYTE* Rec, size_t RecLen, size_t TTL) {
+			CacheShard*			pShard = nullptr;															//  Shard holding the key
 			CacheLine*			pCEnt = nullptr;															//  Cache line for the entry
 			size_t				InsertAt = 0;																//  Cache line index for new insertions
 
@@ -448,27 +683,43 @@ namespace xymorg {
 			if (!Coherent) return false;
 
 			//  Count number of writes
-			StatRec.Writes++;
+			countStat(&StatSlot::Writes);
+
+			//  Apply back-pressure while the write-behind queue is over the limit
+			if (COpts & WRITE_BEHIND) awaitWriteBehind(false);
+
+			//  Lock the shard that holds the key
+			pShard = selectShard(Key);
+			std::lock_guard<std::mutex>		ShardGuard(pShard->Lock);
 
 			//  Expire any records that are due
-			if (COpts & OBSERVE_EXPIRY) expireRecords();
+			if (COpts & OBSERVE_EXPIRY) expireRecords(*pShard);
 
-			pCEnt = findCacheLine(Key);
+			pCEnt = findCacheLine(*pShard, Key);
 			if (pCEnt != nullptr) {
 				//  Entry is already in the cache - replace the record
 				pCEnt->RefCount++;
 				pCEnt->LastRef = CLOCK::now();
 
 				//  Update the statistics
-				StatRec.Hits++;
+				countStat(&StatSlot::Hits);
 
 				//  Promote the entry in the cache
-				pCEnt = promote(pCEnt);
+				pCEnt = promote(*pShard, pCEnt);
 
-				//  Destroy the existing cached record
-				destroyCachedRecord(pCEnt->RPtr, pCEnt->RLen);
+				//  Destroy the existing cached record (or retire it if it is pinned)
+				if (pCEnt->Pins > 0) {
+					if (!retireRecord(*pShard, pCEnt->RPtr, pCEnt->RLen, pCEnt->Pins)) {
+						Coherent = false;
+						return false;
+					}
+					pCEnt->Pins = 0;
+				}
+				else destroyCachedRecord(pCEnt->RPtr, pCEnt->RLen);
 
 				//  Update the cache entry
+				pShard->Size = (pShard->Size - chargeFor(pCEnt->RLen)) + chargeFor(RecLen);
+				noteReplacement(pCEnt->RLen, RecLen);
 				pCEnt->RPtr = Rec;
 				pCEnt->RLen = RecLen;
 				pCEnt->Expiry = CLOCK::now() + MILLISECONDS(TTL * 1000);
@@ -487,26 +738,37 @@ namespace xymorg {
 			//
 			//  Record was not found in the cache - create a new cache line to hold the record
 			//
-			StatRec.Misses++;
+			countStat(&StatSlot::Misses);
+
+			//  Any queued write-behind of the key is superseded by the new record
+			if (COpts & WRITE_BEHIND) {
+				size_t		OldLen = 0;																//  Length of the superseded record
+				BYTE*		pOldRec = reclaimPendingWrite(Key, OldLen, false);						//  Superseded record
+
+				if (pOldRec != nullptr) {
+					destroyCachedRecord(pOldRec, OldLen);
+					countStat(&StatSlot::Coalesces);
+				}
+			}
 
 			//  Safety - if the size of the new entry exceeds the budget then increase the budget
 			if (COpts & OBSERVE_BUDGET) {
-				if (((RecLen + 511) / 1024) > Budget) Budget += ((RecLen + 511) / 1024);
+				if (((chargeFor(RecLen) + 511) / 1024) > pShard->Budget) pShard->Budget += ((chargeFor(RecLen) + 511) / 1024);
 			}
 
 			//  Evict records from the cache until there is sufficient space
-			if (COpts & OBSERVE_BUDGET) evictRecords(RecLen);
+			if (COpts & OBSERVE_BUDGET) evictRecords(*pShard, RecLen);
 
 			//  Make sure that the cache line pool has capacity
-			if (NCL == UCL) {
-				CacheLine* pNewPool = (CacheLine*) realloc(pCL, (NCL + NumLines) * sizeof(CacheLine));
+			if (pShard->NCL == pShard->UCL) {
+				CacheLine* pNewPool = (CacheLine*) realloc(pShard->pCL, (pShard->NCL + NumLines) * sizeof(CacheLine));
 				if (pNewPool == nullptr) {
 					Coherent = false;
 					destroyCachedRecord(Rec, RecLen);
 					return false;
 				}
-				pCL = pNewPool;
-				NCL += NumLines;
+				pShard->pCL = pNewPool;
+				pShard->NCL += NumLines;
 			}
 
 			//
@@ -514,43 +776,90 @@ namespace xymorg {
 			//
 			if (COpts & EVICTION_STRATEGY_LRU) {
 				//  LRU - make room at the head of the cache line array
-				if (UCL > 0) memmove(&pCL[1], &pCL[0], UCL * sizeof(CacheLine));
+				if (pShard->UCL > 0) memmove(&pShard->pCL[1], &pShard->pCL[0], pShard->UCL * sizeof(CacheLine));
 				InsertAt = 0;
 			}
 			else {
 				//  LFU - new cache lines are appended to the existing
-				InsertAt = UCL;
+				InsertAt = pShard->UCL;
 			}
 
 			//  Insert the new record into the cache
-			pCL[InsertAt].DirtyBit = true;
+			pShard->pCL[InsertAt].DirtyBit = true;
 			if (TTL == 0) TTL = size_t(24 * 60 * 60);													//  Default 24 hrs
-			pCL[InsertAt].Expiry = CLOCK::now() + MILLISECONDS(TTL * 1000);
-			pCL[InsertAt].LastRef = CLOCK::now();
-			pCL[InsertAt].RefCount = 1;
-			pCL[InsertAt].RKey = Keys.addString(Key);
-			pCL[InsertAt].RLen = RecLen;
-			pCL[InsertAt].RPtr = Rec;
+			pShard->pCL[InsertAt].Expiry = CLOCK::now() + MILLISECONDS(TTL * 1000);
+			pShard->pCL[InsertAt].LastRef = CLOCK::now();
+			pShard->pCL[InsertAt].RefCount = 1;
+			pShard->pCL[InsertAt].RKey = pShard->Keys.addString(Key);
+			pShard->pCL[InsertAt].RLen = RecLen;
+			pShard->pCL[InsertAt].RPtr = Rec;
+			pShard->pCL[InsertAt].Pins = 0;
+
+			//  Bookeeping
+			pShard->UCL++;
+			pShard->Size += chargeFor(RecLen);
+			noteInsertion(RecLen);
 
 			//  If the cache policy is not deferred write then write through the new record
 			if ((COpts & WRITE_DEFERRED) == 0) {
 				if (!putCachedRecord(Key, Rec, RecLen)) return false;
-				pCL[InsertAt].DirtyBit = false;
+				pShard->pCL[InsertAt].DirtyBit = false;
 			}
 
 			//  LFU - promote the entry
-			if (COpts & EVICTION_STRATEGY_LFU) promote(&pCL[InsertAt]);
-
-			//  Bookeeping
-			UCL++;
-			Size += RecLen;
-			if (UCL > StatRec.MaxEnts) StatRec.MaxEnts = UCL;
-			if (((Size + 511) / 1024) > StatRec.MaxSize) StatRec.MaxSize = ((Size + 511) / 1024);
+			if (COpts & EVICTION_STRATEGY_LFU) promote(*pShard, &pShard->pCL[InsertAt]);
 
 			//  Return showing success
 			return true;
 		}
 
+		//  allocateRecord
+		//
+		//  Allocates the storage for a record that is to be owned by the cache
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the record (bytes)
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the storage for the record, NULL if the allocation failed
+		//
+		//  NOTES:
+		//
+		//	1.	With SLAB_RECORDS the storage is taken from the cache slab arena, otherwise from the heap
+		//	2.	Extending classes should use this function in getStoredRecord() and callers of writeRecord() for
+		//		the records that they pass to the cache
+		//
+
+		BYTE*	allocateRecord(size_t RecLen) {
+			if (COpts & SLAB_RECORDS) return Arena.allocate(RecLen);
+			return (BYTE*) malloc(RecLen);
+		}
+
+		//  releaseRecord
+		//
+		//  Releases the storage for a record that was allocated by allocateRecord()
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*			-		Pointer to the record
+		//		size_t			-		Size of the record (bytes), as passed to allocateRecord()
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	Extending classes should use this function in destroyCachedRecord()
+		//
+
+		void	releaseRecord(BYTE* Rec, size_t RecLen) {
+			if (Rec == nullptr) return;
+			if (COpts & SLAB_RECORDS) Arena.release(Rec, RecLen);
+			else free(Rec);
+			return;
+		}
+
 		//  getStats
 		//
 		//  Returns a pointer to the cache statistics structure
@@ -562,9 +871,38 @@ namespace xymorg {
 		//		Stats*			-		Pointer to the statistics structure
 		//
 		//  NOTES:
+		//
+		//	1.	The per-thread counters are aggregated into the statistics structure on each call, the returned
+		//		structure is a snapshot that is refreshed by the next call to getStats().
 		//  
 
-		Stats*		getStats() { 	
+		Stats*		getStats() {
+			std::lock_guard<std::mutex>		StatGuard(StatLock);
+
+			//  Aggregate the counters from each of the statistics slots
+			memset(&StatRec, 0, sizeof(Stats));
+			for (int SX = 0; SX < NumStatSlots; SX++) {
+				StatRec.Hits += Slots[SX].Hits.load(std::memory_order_relaxed);
+				StatRec.Misses += Slots[SX].Misses.load(std::memory_order_relaxed);
+				StatRec.Reads += Slots[SX].Reads.load(std::memory_order_relaxed);
+				StatRec.Peeks += Slots[SX].Peeks.load(std::memory_order_relaxed);
+				StatRec.Writes += Slots[SX].Writes.load(std::memory_order_relaxed);
+				StatRec.DirtyWrites += Slots[SX].DirtyWrites.load(std::memory_order_relaxed);
+				StatRec.Purges += Slots[SX].Purges.load(std::memory_order_relaxed);
+				StatRec.NotFound += Slots[SX].NotFound.load(std::memory_order_relaxed);
+				StatRec.Inspects += Slots[SX].Inspects.load(std::memory_order_relaxed);
+				StatRec.Evictions += Slots[SX].Evictions.load(std::memory_order_relaxed);
+				StatRec.Expires += Slots[SX].Expires.load(std::memory_order_relaxed);
+				StatRec.Coalesces += Slots[SX].Coalesces.load(std::memory_order_relaxed);
+				StatRec.Batches += Slots[SX].Batches.load(std::memory_order_relaxed);
+			}
+
+			//  Capture the high water marks
+			StatRec.MaxEnts = MaxEnts.load();
+			StatRec.MaxSize = (MaxSize.load() + 511) / 1024;
+			StatRec.ArenaSize = (Arena.getFootprint() + 511) / 1024;
+
+			//  Return the aggregated statistics
 			return &StatRec; 
 		}
 
@@ -585,28 +923,39 @@ namespace xymorg {
 			time_t			TPTime = {};
 			tm				TPTM = {};
 			char			szPTime[64] = {};															//  Printable time
+			size_t			EntNo = 0;																	//  Entry number
+
+			//  Safety
+			if (pShards == nullptr) return;
 
 			//  Show the count and size of the cache
-			Log << new LOGMSG("TRACE: There are %i entries in the pool with total size: %i Kb.", UCL, ((Size + 511) / 1024));
-
-			//  Show each entry in the pool
-			for (size_t CCX = 0; CCX < UCL; CCX++) {
-				Log << "TRACE: Entry #" << (CCX + 1) << ": ";
-				Log << "ObjID: " << pCL[CCX].RKey;
-				Log << ", Refs: " << pCL[CCX].RefCount;
-				TPTime = CLOCK::to_time_t(pCL[CCX].LastRef);
-				localtime_safe(&TPTime, &TPTM);
-				strftime(szPTime, 64, "%F %T", &TPTM);
-				Log << ", Last Ref: " << szPTime;
-				Log << ", In-mem: " << (void*)pCL[CCX].RPtr;
-				Log << ", Size: " << pCL[CCX].RLen;
-				if (pCL[CCX].DirtyBit) Log << ", Dirty";
-				TPTime = CLOCK::to_time_t(pCL[CCX].Expiry);
-				localtime_safe(&TPTime, &TPTM);
-				strftime(szPTime, 64, "%F %T", &TPTM);
-				Log << ", Expires: " << szPTime;
-				Log << ", key: '" << Keys.getString(pCL[CCX].RKey) << "'";
-				Log << "." << std::endl;
+			Log << new LOGMSG("TRACE: There are %i entries in the pool with total size: %i Kb in %i shards.", CEnts.load(), ((CSize.load() + 511) / 1024), NShards);
+
+			//  Show each entry in each shard of the pool
+			for (size_t SX = 0; SX < NShards; SX++) {
+				CacheShard& Shard = pShards[SX];
+				std::lock_guard<std::mutex>		ShardGuard(Shard.Lock);
+
+				for (size_t CCX = 0; CCX < Shard.UCL; CCX++) {
+					EntNo++;
+					Log << "TRACE: Entry #" << EntNo << ": ";
+					if (NShards > 1) Log << "Shard: " << SX << ", ";
+					Log << "ObjID: " << Shard.pCL[CCX].RKey;
+					Log << ", Refs: " << Shard.pCL[CCX].RefCount;
+					TPTime = CLOCK::to_time_t(Shard.pCL[CCX].LastRef);
+					localtime_safe(&TPTime, &TPTM);
+					strftime(szPTime, 64, "%F %T", &TPTM);
+					Log << ", Last Ref: " << szPTime;
+					Log << ", In-mem: " << (void*)Shard.pCL[CCX].RPtr;
+					Log << ", Size: " << Shard.pCL[CCX].RLen;
+					if (Shard.pCL[CCX].DirtyBit) Log << ", Dirty";
+					TPTime = CLOCK::to_time_t(Shard.pCL[CCX].Expiry);
+					localtime_safe(&TPTime, &TPTM);
+					strftime(szPTime, 64, "%F %T", &TPTM);
+					Log << ", Expires: " << szPTime;
+					Log << ", key: '" << Shard.Keys.getString(Shard.pCL[CCX].RKey) << "'";
+					Log << "." << std::endl;
+				}
 			}
 
 			//  Return to caller
@@ -622,6 +971,9 @@ namespace xymorg {
 		//  RETURNS:
 		//
 		//  NOTES:
+		//
+		//	1.	The caller must ensure that no other thread is using the cache when it is dismissed
+		//	2.	Any records that are still pinned are destroyed, outstanding CachedRef objects become dangling
 		//  
 
 		void		dismiss() {
@@ -632,9 +984,23 @@ namespace xymorg {
 			//  First purge all entries from the pool (writing any dirty entries)
 			purge(true);
 
-			//  Now destroy the cache-line pool
-			if (pCL != NULL) free(pCL);
-			NCL = UCL = 0;
+			//  Stop the write-behind thread (the queue is drained first)
+			stopWriteBehind();
+
+			//  Now destroy the cache-line pool in each shard
+			for (size_t SX = 0; SX < NShards; SX++) {
+				std::lock_guard<std::mutex>		ShardGuard(pShards[SX].Lock);
+
+				if (pShards[SX].pCL != nullptr) free(pShards[SX].pCL);
+				pShards[SX].pCL = nullptr;
+				pShards[SX].NCL = pShards[SX].UCL = 0;
+
+				//  Destroy any retired records
+				for (size_t RRX = 0; RRX < pShards[SX].URR; RRX++) destroyCachedRecord(pShards[SX].pRR[RRX].RPtr, pShards[SX].pRR[RRX].RLen);
+				if (pShards[SX].pRR != nullptr) free(pShards[SX].pRR);
+				pShards[SX].pRR = nullptr;
+				pShards[SX].NRR = pShards[SX].URR = 0;
+			}
 
 			//  Flag the cache as incoherent
 			Coherent = false;
@@ -656,6 +1022,8 @@ namespace xymorg {
 		//  NOTES:
 		//
 		//	1.	To destroy a cache without writing dirty entries first call purge(false) then call dismiss()
+		//	2.	Each shard is locked in turn while it is purged
+		//	3.	With WRITE_BEHIND the dirty entries are queued and the function returns when the queue has been written
 		//  
 
 		void		purge(bool WriteDirty) {
@@ -663,38 +1031,106 @@ namespace xymorg {
 			//  Safety
 			if (!Coherent) return;
 
-			//  Process each entry in the pool in turn
-			for (size_t CEIX = 0; CEIX < UCL; CEIX++) {
+			//  Process each shard in turn
+			for (size_t SX = 0; SX < NShards; SX++) {
+				CacheShard& Shard = pShards[SX];
+				std::lock_guard<std::mutex>		ShardGuard(Shard.Lock);
 
-				//  If the entry is dirty then it will be written to the backing store (if enabled)
-				if (WriteDirty && pCL[CEIX].DirtyBit) {
-					if (!putCachedRecord(Keys.getString(pCL[CEIX].RKey), pCL[CEIX].RPtr, pCL[CEIX].RLen)) {
-						Coherent = false;
-						return;
+				//  Process each entry in the shard in turn
+				for (size_t CEIX = 0; CEIX < Shard.UCL; CEIX++) {
+					bool		Queued = false;													//  Entry was queued for write-behind
+
+					//  Unpinned dirty entries are handed to the write-behind thread (if enabled)
+					if (WriteDirty && Shard.pCL[CEIX].DirtyBit && (COpts & WRITE_BEHIND) && Shard.pCL[CEIX].Pins == 0) {
+						if (!queueWrite(Shard.Keys.getString(Shard.pCL[CEIX].RKey), Shard.pCL[CEIX].RPtr, Shard.pCL[CEIX].RLen)) {
+							Coherent = false;
+							return;
+						}
+						Queued = true;
+					}
+
+					//  If the entry is dirty then it will be written to the backing store (if enabled)
+					else if (WriteDirty && Shard.pCL[CEIX].DirtyBit) {
+						if (!putCachedRecord(Shard.Keys.getString(Shard.pCL[CEIX].RKey), Shard.pCL[CEIX].RPtr, Shard.pCL[CEIX].RLen)) {
+							Coherent = false;
+							return;
+						}
+						countStat(&StatSlot::DirtyWrites);
+					}
+
+					//  Purge the current entry (pinned records are retired until they are released, queued records are owned by the queue)
+					Shard.Keys.deleteString(Shard.pCL[CEIX].RKey);
+					if (Shard.pCL[CEIX].Pins > 0) {
+						if (!retireRecord(Shard, Shard.pCL[CEIX].RPtr, Shard.pCL[CEIX].RLen, Shard.pCL[CEIX].Pins)) {
+							Coherent = false;
+							return;
+						}
 					}
-					StatRec.DirtyWrites++;
+					else if (!Queued) destroyCachedRecord(Shard.pCL[CEIX].RPtr, Shard.pCL[CEIX].RLen);
+					noteRemoval(Shard.pCL[CEIX].RLen);
+					Shard.pCL[CEIX].DirtyBit = false;
+					Shard.pCL[CEIX].Expiry = CLOCK::now();
+					Shard.pCL[CEIX].LastRef = CLOCK::now();
+					Shard.pCL[CEIX].RefCount = 0;
+					Shard.pCL[CEIX].RKey = NULLSTRREF;
+					Shard.pCL[CEIX].RLen = 0;
+					Shard.pCL[CEIX].RPtr = nullptr;
+					Shard.pCL[CEIX].Pins = 0;
+					countStat(&StatSlot::Purges);
 				}
 
-				//  Purge the current entry
-				destroyCachedRecord(pCL[CEIX].RPtr, pCL[CEIX].RLen);
-				pCL[CEIX].DirtyBit = false;
-				pCL[CEIX].Expiry = CLOCK::now();
-				pCL[CEIX].LastRef = CLOCK::now();
-				pCL[CEIX].RefCount = 0;
-				pCL[CEIX].RKey = NULLSTRREF;
-				pCL[CEIX].RLen = 0;
-				pCL[CEIX].RPtr = nullptr;
-				StatRec.Purges++;
+				//  Clear the count and size of cached entries
+				Shard.UCL = 0;
+				Shard.Size = 0;
 			}
 
-			//  Clear the count and size of cached entries
-			UCL = 0;
-			Size = 0;
+			//  Wait for the write-behind queue to be written
+			if (WriteDirty && (COpts & WRITE_BEHIND)) flushWriteBehind();
 
 			//  Return to caller
 			return;
 		}
 
+		//  setWriteBehindLimit
+		//
+		//  Sets the limit on the size of the write-behind queue, writers are held back while the limit is exceeded
+		//
+		//  PARAMETERS:
+		//
+		//		size_t		-		Limit (Kb)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		setWriteBehindLimit(size_t NewLimit) {
+			std::lock_guard<std::mutex>		WBGuard(WBLock);
+
+			if (NewLimit == 0) NewLimit = DEFAULT_WRITE_BEHIND_LIMIT;
+			WBLimit = NewLimit;
+			WBSignal.notify_all();
+			return;
+		}
+
+		//  flushWriteBehind
+		//
+		//  Waits until all records queued for write-behind have been written to the backing store
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	Records that are dirty in the cache are not written, use purge(true) to write all dirty records
+		//  
+
+		void		flushWriteBehind() {
+			awaitWriteBehind(true);
+			return;
+		}
+
 	private:
 
 		//*******************************************************************************************************************
@@ -703,15 +1139,35 @@ namespace xymorg {
 		//*                                                                                                                 *
 		//*******************************************************************************************************************
 
-		bool			Coherent;															//  Cache is coherent
-		SWITCHES		COpts;																//  Cache control options
-		CacheLine*		pCL;																//  Cache lines
-		size_t			Budget;																//  Budget size (Kb)
-		size_t			NCL;																//  Number of cache lines (size of pool)
-		size_t			UCL;																//  Number of cache lines used
-		size_t			Size;																//  Cache size (Kb)
-		StringPool		Keys;																//  String pool holding the keys
-		Stats			StatRec;															//  Statistics record
+		std::atomic<bool>	Coherent;														//  Cache is coherent
+		SWITCHES			COpts;															//  Cache control options
+		CacheShard*			pShards;														//  Cache shards
+		size_t				NShards;														//  Number of cache shards
+		StatSlot			Slots[NumStatSlots];											//  Per-thread statistics slots
+		std::atomic<size_t>	CEnts;															//  Count of cache entries (all shards)
+		std::atomic<size_t>	CSize;															//  Size of the cache (all shards, bytes)
+		std::atomic<size_t>	MaxEnts;														//  Maximum count of cache entries
+		std::atomic<size_t>	MaxSize;														//  Maximum size of the cache (bytes)
+		std::mutex			StatLock;														//  Statistics aggregation lock
+		Stats				StatRec;														//  Statistics record
+
+		//  Write-Behind
+		PendingWrite*		pWB;															//  Queued writes
+		size_t				NWB;															//  Number of queued write slots
+		size_t				UWB;															//  Number of queued write slots used
+		PendingWrite*		pWBF;															//  Writes in flight (batch being written)
+		size_t				NWBF;															//  Number of in flight write slots
+		size_t				UWBF;															//  Number of in flight write slots used
+		size_t				WBBytes;														//  Bytes queued or in flight
+		std::atomic<size_t>	WBLimit;														//  Write-behind limit (Kb)
+		bool				WBStop;															//  Write-behind thread stop request
+		std::mutex			WBLock;															//  Write-behind queue lock
+		std::condition_variable	WBSignal;													//  Write-behind queue signal
+		std::thread			WBThread;														//  Write-behind thread
+
+		//  Record Storage
+		SlabArena			Arena;															//  Slab arena for records
+		size_t				ArenaLimit;														//  Limit for the arena footprint (bytes)
 
 
 		//*******************************************************************************************************************
@@ -720,9 +1176,9 @@ namespace xymorg {
 		//*                                                                                                                 *
 		//*******************************************************************************************************************
 
-		//  findCacheLine
+		//  selectShard
 		//
-		//  This function will return a pointer to the Cache Line for a given key.
+		//  This function will return a pointer to the shard that holds the passed key.
 		//
 		//  PARAMETERS:
 		//
@@ -730,45 +1186,334 @@ namespace xymorg {
 		//
 		//  RETURNS:
 		//
-		//		CacheLine*	-		Pointer to the cache-line matching the passed key, NULL if not matched
+		//		CacheShard*	-		Pointer to the shard for the key
 		//
 		//  NOTES:
 		//
-		//		The cache is maintained in MFU/MRU order so must be searched exhaustively
+		//	1.	The key is hashed (FNV-1a), keys are case folded unless the cache observes key case
 		//  
 
-		CacheLine* findCacheLine(const char* Key) {
+		CacheShard* selectShard(const char* Key) {
+			uint32_t		KeyHash = 2166136261U;													//  FNV-1a hash of the key
 
-			//  Safety
-			if (!Coherent) return nullptr;
-			if (Key == nullptr) return nullptr;
-			if (Key[0] == '\0') return nullptr;
-
-			//  Search for the key
-			for (size_t CEIX = 0; CEIX < UCL; CEIX++) {
-
-				//  Update statistics
-				StatRec.Inspects++;
+			//  Single shard - no hashing is necessary
+			if (NShards == 1) return pShards;
 
-				if (COpts & OBSERVE_KEY_CASE) {
-					if (strcmp(Key, Keys.getString(pCL[CEIX].RKey)) == 0) return &pCL[CEIX];
-				}
-				else {
-					if (_stricmp(Key, Keys.getString(pCL[CEIX].RKey)) == 0) return &pCL[CEIX];
-				}
+			for (const char* pKC = Key; *pKC != '\0'; pKC++) {
+				if (COpts & OBSERVE_KEY_CASE) KeyHash ^= BYTE(*pKC);
+				else KeyHash ^= BYTE(tolower(BYTE(*pKC)));
+				KeyHash *= 16777619U;
 			}
 
-			//  Return Not Found
-			return nullptr;
+			return &pShards[KeyHash % NShards];
 		}
 
-		//  promote
+		//  countStat
 		//
-		//  This function will promote the passed cache line in the pool according to policy.
+		//  This function will increment the selected statistics counter in the slot for the calling thread.
 		//
 		//  PARAMETERS:
 		//
-		//		CacheLine*	-		Pointer to the cache-line matching the passed key.
+		//		StatCounter		-		Selector for the counter to be incremented
+		//		size_t			-		Increment (default 1)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		countStat(StatCounter Counter, size_t Incr = 1) {
+			static thread_local const size_t	ThreadSlot = std::hash<std::thread::id>()(std::this_thread::get_id()) % NumStatSlots;
+
+			(Slots[ThreadSlot].*Counter).fetch_add(Incr, std::memory_order_relaxed);
+			return;
+		}
+
+		//  chargeFor
+		//
+		//  This function returns the number of bytes that a record is accounted for against the budget.
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the record (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Accounted size of the record (bytes)
+		//
+		//  NOTES:
+		//
+		//	1.	With SLAB_RECORDS records are accounted at the size of the slab block that holds them
+		//  
+
+		size_t		chargeFor(size_t RecLen) const {
+			if (COpts & SLAB_RECORDS) return SlabArena::chargeFor(RecLen);
+			return RecLen;
+		}
+
+		//  noteInsertion
+		//
+		//  This function will account for a new entry in the cache and maintain the high water marks.
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the new record (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		noteInsertion(size_t RecLen) {
+			RecLen = chargeFor(RecLen);
+			raiseHighWater(MaxEnts, CEnts.fetch_add(1) + 1);
+			raiseHighWater(MaxSize, CSize.fetch_add(RecLen) + RecLen);
+			return;
+		}
+
+		//  noteReplacement
+		//
+		//  This function will account for the replacement of a record in the cache and maintain the high water mark.
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the old record (bytes)
+		//		size_t			-		Size of the new record (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		noteReplacement(size_t OldLen, size_t NewLen) {
+			OldLen = chargeFor(OldLen);
+			NewLen = chargeFor(NewLen);
+			CSize.fetch_sub(OldLen);
+			raiseHighWater(MaxSize, CSize.fetch_add(NewLen) + NewLen);
+			return;
+		}
+
+		//  noteRemoval
+		//
+		//  This function will account for the removal of an entry from the cache.
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the removed record (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		noteRemoval(size_t RecLen) {
+			CEnts.fetch_sub(1);
+			CSize.fetch_sub(chargeFor(RecLen));
+			return;
+		}
+
+		//  raiseHighWater
+		//
+		//  This function will raise a high water mark to the passed value if it exceeds the current mark.
+		//
+		//  PARAMETERS:
+		//
+		//		std::atomic<size_t>&	-		Reference to the high water mark
+		//		size_t					-		Current value
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		raiseHighWater(std::atomic<size_t>& HiWater, size_t Value) {
+			size_t		Mark = HiWater.load(std::memory_order_relaxed);								//  Current mark
+
+			while (Value > Mark && !HiWater.compare_exchange_weak(Mark, Value, std::memory_order_relaxed)) {}
+			return;
+		}
+
+		//  findCacheLine
+		//
+		//  This function will return a pointer to the Cache Line for a given key.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard&	-		Reference to the (locked) shard holding the key
+		//		char*		-		Const pointer the Key of the record to be read/written
+		//
+		//  RETURNS:
+		//
+		//		CacheLine*	-		Pointer to the cache-line matching the passed key, NULL if not matched
+		//
+		//  NOTES:
+		//
+		//		The cache is maintained in MFU/MRU order so must be searched exhaustively
+		//  
+
+		CacheLine* findCacheLine(CacheShard& Shard, const char* Key) {
+			size_t		Inspects = 0;																//  Count of inspections
+			CacheLine*	pCEnt = nullptr;															//  Matched cache line
+
+			//  Safety
+			if (!Coherent) return nullptr;
+			if (Key == nullptr) return nullptr;
+			if (Key[0] == '\0') return nullptr;
+
+			//  Search for the key
+			for (size_t CEIX = 0; CEIX < Shard.UCL && pCEnt == nullptr; CEIX++) {
+
+				//  Update statistics
+				Inspects++;
+
+				if (COpts & OBSERVE_KEY_CASE) {
+					if (strcmp(Key, Shard.Keys.getString(Shard.pCL[CEIX].RKey)) == 0) pCEnt = &Shard.pCL[CEIX];
+				}
+				else {
+					if (_stricmp(Key, Shard.Keys.getString(Shard.pCL[CEIX].RKey)) == 0) pCEnt = &Shard.pCL[CEIX];
+				}
+			}
+
+			//  Return the matched cache line (if any)
+			if (Inspects > 0) countStat(&StatSlot::Inspects, Inspects);
+			return pCEnt;
+		}
+
+		//  acquireCacheLine
+		//
+		//  This function returns the cache line for the required record, if the record is not in the shard then it is read
+		//  from the store and added to the shard.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard&	-		Reference to the (locked) shard holding the key
+		//		char*		-		Pointer to the key for the desired record (NULL terminated string)
+		//		size_t&		-		Reference to the record variable to hold the returned record length	
+		//		size_t&		-		Reference to the record variable to hold the Time-To-Live (TTL) of the returned record
+		//
+		//  RETURNS:
+		//
+		//		CacheLine*	-		Pointer to the cache line holding the record, NULL if not available
+		//
+		//  NOTES:
+		//
+
+		CacheLine* acquireCacheLine(CacheShard& Shard, const char* Key, size_t& RecLen, size_t& TTL) {
+			CacheLine*			pCEnt = nullptr;															//  Cache line for the entry
+			BYTE*				pNewRec = nullptr;															//  New record to be added to the cache
+			bool				Reclaimed = false;															//  Record was reclaimed from write-behind
+			size_t				InsertAt = 0;																//  Cache line index for new insertions
+			TIMER				NowTime = CLOCK::now();														//  Current time
+			SECONDS				TTLSecs = {};																//  TTL in seconds
+
+			//  Expire any records that are due
+			if (COpts & OBSERVE_EXPIRY) expireRecords(Shard);
+
+			//  Search the cache to determine if the passed key is in the cache
+			pCEnt = findCacheLine(Shard, Key);
+			if (pCEnt != nullptr) {
+				//  Entry is already in the cache - perform cache management bookeeping and return the record
+				pCEnt->RefCount++;
+				pCEnt->LastRef = CLOCK::now();
+
+				//  Update the statistics
+				countStat(&StatSlot::Hits);
+
+				//  Promote the entry in the cache
+				pCEnt = promote(Shard, pCEnt);
+
+				//  Compute the remaining TTL
+				NowTime = CLOCK::now();
+				TTLSecs = pCEnt->Expiry - NowTime;
+				TTL = size_t(TTLSecs.count());
+				RecLen = pCEnt->RLen;
+
+				//  Return the cache line
+				return pCEnt;
+			}
+
+			//  Record not currently in the cache - attempt retrieve  it from the store
+			countStat(&StatSlot::Misses);
+
+			//  A record that is queued (or being written) for write-behind is reclaimed (still dirty), otherwise read the desired key from the store
+			if (COpts & WRITE_BEHIND) pNewRec = reclaimPendingWrite(Key, RecLen, true);
+			if (pNewRec != nullptr) Reclaimed = true;
+			else pNewRec = getStoredRecord(Key, RecLen, TTL);
+
+			if (pNewRec == nullptr) {
+				countStat(&StatSlot::NotFound);
+
+				//  If NOT-EXIST records are NOT being cached then return to the caller with NULL
+				if (!(COpts & CACHE_NOT_EXIST)) {
+					return nullptr;
+				}
+			}
+
+			//  Safety - if the size of the new entry exceeds the budget then increase the budget
+			if (COpts & OBSERVE_BUDGET) {
+				if (((chargeFor(RecLen) + 511) / 1024) > Shard.Budget) Shard.Budget += ((chargeFor(RecLen) + 511) / 1024);
+			}
+
+			//  Evict records from the cache until there is sufficient space
+			if (COpts & OBSERVE_BUDGET) evictRecords(Shard, RecLen);
+
+			//  Make sure that the cache line pool has capacity
+			if (Shard.NCL == Shard.UCL) {
+				CacheLine* pNewPool = (CacheLine*)realloc(Shard.pCL, (Shard.NCL + NumLines) * sizeof(CacheLine));
+				if (pNewPool == nullptr) {
+					Coherent = false;
+					destroyCachedRecord(pNewRec, RecLen);
+					return nullptr;
+				}
+				Shard.pCL = pNewPool;
+				Shard.NCL += NumLines;
+			}
+
+			//
+			//  Determine the point at which the insertion will take place and clear that slot
+			//
+			if (COpts & EVICTION_STRATEGY_LRU) {
+				//  LRU - make room at the head of the cache line array
+				if (Shard.UCL > 0) memmove(&Shard.pCL[1], &Shard.pCL[0], Shard.UCL * sizeof(CacheLine));
+				InsertAt = 0;
+			}
+			else {
+				//  LFU - new cache lines are appended to the existing
+				InsertAt = Shard.UCL;
+			}
+
+			//  Insert the new record into the cache
+			pCEnt = &Shard.pCL[InsertAt];
+			Shard.pCL[InsertAt].DirtyBit = Reclaimed;
+			if (TTL == 0) TTL = size_t(24 * 60 * 60);													//  Default 24 hrs
+			Shard.pCL[InsertAt].Expiry = CLOCK::now() + MILLISECONDS(TTL * 1000);
+			Shard.pCL[InsertAt].LastRef = CLOCK::now();
+			Shard.pCL[InsertAt].RefCount = 1;
+			Shard.pCL[InsertAt].RKey = Shard.Keys.addString(Key);
+			Shard.pCL[InsertAt].RLen = RecLen;
+			Shard.pCL[InsertAt].RPtr = pNewRec;
+			Shard.pCL[InsertAt].Pins = 0;
+
+			//  Bookeeping
+			Shard.UCL++;
+			Shard.Size += chargeFor(RecLen);
+			noteInsertion(RecLen);
+
+			//  LFU - promote the entry
+			if (COpts & EVICTION_STRATEGY_LFU) pCEnt = promote(Shard, pCEnt);
+
+			//  Return the cache line for the entry
+			return pCEnt;
+		}
+
+		//  promote
+		//
+		//  This function will promote the passed cache line in the pool according to policy.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard&	-		Reference to the (locked) shard holding the cache line
+		//		CacheLine*	-		Pointer to the cache-line matching the passed key.
 		//
 		//  RETURNS:
 		//
@@ -779,37 +1524,37 @@ namespace xymorg {
 		//		The cache is maintained in MFU/MRU order so must be searched exhaustively
 		//  
 
-		CacheLine*  promote(CacheLine* pCEnt) {
+		CacheLine*  promote(CacheShard& Shard, CacheLine* pCEnt) {
 			CacheLine		CurrEntry = {};													//  Current entry
 			CacheLine*		pTarget = nullptr;												//  Target cache entry
 			size_t			MoveSize = 0;													//  Size to move
 			
 			if (COpts & EVICTION_STRATEGY_LRU) {
 				//  Most Recently Used (MRU), the current entry is moved to the head of the pool
-				if (pCEnt == pCL) return pCEnt;
+				if (pCEnt == Shard.pCL) return pCEnt;
 
 				//  Save the current entry
 				memcpy(&CurrEntry, pCEnt, sizeof(CacheLine));
 
 				//  Shuffle all entries down by one
-				pTarget = pCL + 1;
+				pTarget = Shard.pCL + 1;
 
 				//  Compute the size to move
-				MoveSize = ((BYTE*)pCEnt) - ((BYTE*) pCL);
+				MoveSize = ((BYTE*)pCEnt) - ((BYTE*) Shard.pCL);
 
 				//  Shuffle the entries down by 1 cache line
-				memmove(pTarget, pCL, MoveSize);
+				memmove(pTarget, Shard.pCL, MoveSize);
 
 				//  Insert the entry at the first slot
-				memcpy(pCL, &CurrEntry, sizeof(CacheLine));
+				memcpy(Shard.pCL, &CurrEntry, sizeof(CacheLine));
 
 				//  Return to caller
-				return pCL;
+				return Shard.pCL;
 			}
 
 			//  Most Frequently Used  -  Promote the current entry one slot at a time until it is in the correct position
 
-			while (pCEnt > pCL) {
+			while (pCEnt > Shard.pCL) {
 				//  Point to the previous slot
 				pTarget = pCEnt - 1;
 
@@ -831,49 +1576,30 @@ namespace xymorg {
 
 		//  expireRecords
 		//
-		//  This function will expire any records that are currently due to exire.
+		//  This function will expire any records in the shard that are currently due to exire.
 		//
 		//  PARAMETERS:
 		//
+		//		CacheShard&	-		Reference to the (locked) shard
+		//
 		//  RETURNS:
 		//
 		//  NOTES:
+		//
+		//	1.	Pinned records are not expired until they have been released
 		//  
 
-		void		expireRecords() {
+		void		expireRecords(CacheShard& Shard) {
 			TIMER		BaseLine = CLOCK::now();													//  Baseline time
 			size_t		Inspect = 0;																//  Item being inspected
 
-			while (Inspect < UCL) {
+			while (Inspect < Shard.UCL) {
 
 				//  See if the current entry has expired
-				if (pCL[Inspect].Expiry <= BaseLine) {
-					//  Record has expired
-					//  If the entry is dirty then it will be written to the backing store (if enabled)
-					if (pCL[Inspect].DirtyBit) {
-						if (!putCachedRecord(Keys.getString(pCL[Inspect].RKey), pCL[Inspect].RPtr, pCL[Inspect].RLen)) {
-							Coherent = false;
-							return;
-						}
-						StatRec.DirtyWrites++;
-					}
-
-					//  Purge the entry from the cache
-					Keys.deleteString(pCL[Inspect].RKey);
-					destroyCachedRecord(pCL[Inspect].RPtr, pCL[Inspect].RLen);
-					Size = Size - pCL[Inspect].RLen;
-					pCL[Inspect].DirtyBit = false;
-					pCL[Inspect].Expiry = CLOCK::now();
-					pCL[Inspect].LastRef = CLOCK::now();
-					pCL[Inspect].RefCount = 0;
-					pCL[Inspect].RKey = NULLSTRREF;
-					pCL[Inspect].RLen = 0;
-					pCL[Inspect].RPtr = nullptr;
-
-					//  Shuffle up any following entries
-					if (Inspect < (UCL - 1)) memmove(&pCL[Inspect], &pCL[Inspect + 1], (UCL - (Inspect + 1)) * sizeof(CacheLine));
-					UCL--;
-					StatRec.Expires++;
+				if (Shard.pCL[Inspect].Expiry <= BaseLine && Shard.pCL[Inspect].Pins == 0) {
+					//  Record has expired - purge the entry from the cache
+					if (!dropCacheLine(Shard, Inspect)) return;
+					countStat(&StatSlot::Expires);
 				}
 				else Inspect++;
 			}
@@ -884,50 +1610,459 @@ namespace xymorg {
 
 		//  evictRecords
 		//
-		//  This function will evict sufficient records from the cache until there is room for the new one.
+		//  This function will evict sufficient records from the shard until there is room for the new one.
 		//
 		//  PARAMETERS:
 		//
+		//		CacheShard&		-		Reference to the (locked) shard
 		//		size_t			-		Size of the new record (Bytes)
 		//
 		//  RETURNS:
 		//
 		//  NOTES:
+		//
+		//	1.	Pinned records are never evicted, if only pinned records remain the shard may exceed its budget
+		//	2.	With SLAB_RECORDS eviction continues while the arena footprint exceeds the arena limit, records queued
+		//		for write-behind are allowed for up to the write-behind limit
+		//  
+
+		void		evictRecords(CacheShard& Shard, size_t ReqSize) {
+			size_t		Evictee = Shard.UCL;														//  Eviction candidate
+
+			//  Process until there is sufficient space in the shard (and the arena)
+			while ((Shard.Size + chargeFor(ReqSize)) > (Shard.Budget * 1024) || arenaOverLimit()) {
+
+				//  Cache entries are ALWAYS evicted from the tail of the Cache Line array, skipping pinned entries
+				while (Evictee > 0 && Shard.pCL[Evictee - 1].Pins > 0) Evictee--;
+				if (Evictee == 0) return;
+				Evictee--;
+
+				//  Evict the selected entry
+				if (!dropCacheLine(Shard, Evictee)) return;
+				countStat(&StatSlot::Evictions);
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  arenaOverLimit
+		//
+		//  This function will determine if the memory committed by the slab arena exceeds its limit.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the arena footprint is over the limit, otherwise false
+		//
+		//  NOTES:
 		//  
 
-		void		evictRecords(size_t ReqSize) {
-			size_t		Evictee = 0;															//  Eviction candidate
+		bool		arenaOverLimit() const {
+			size_t		Limit = ArenaLimit;															//  Footprint limit
+
+			if ((COpts & SLAB_RECORDS) == 0) return false;
+			if (COpts & WRITE_BEHIND) Limit += WBLimit * 1024;
+			return Arena.getFootprint() > Limit;
+		}
 
-			//  Process until there is sufficient space in the cache
-			while ((Size + ReqSize) > (Budget * 1024)) {
+		//  dropCacheLine
+		//
+		//  This function will remove an (unpinned) entry from the shard, writing it to the backing store if it is dirty.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard&		-		Reference to the (locked) shard
+		//		size_t			-		Index of the cache line to be removed
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the entry was removed, false if the write of a dirty entry failed
+		//
+		//  NOTES:
+		//
+		//	1.	A failed write makes the cache incoherent
+		//  
 
-				//  Cache entries are ALWAYS evicted from the tail of the Cache Line array
-				Evictee = UCL - 1;
+		bool		dropCacheLine(CacheShard& Shard, size_t Index) {
+			CacheLine&		Line = Shard.pCL[Index];											//  Cache line being removed
 
-				//  If the entry is dirty then it will be written to the backing store (if enabled)
-				if (pCL[Evictee].DirtyBit) {
-					if (!putCachedRecord(Keys.getString(pCL[Evictee].RKey), pCL[Evictee].RPtr, pCL[Evictee].RLen)) {
+			//  If the entry is dirty then it will be written to the backing store (if enabled) or queued for write-behind
+			if (Line.DirtyBit) {
+				if (COpts & WRITE_BEHIND) {
+					if (!queueWrite(Shard.Keys.getString(Line.RKey), Line.RPtr, Line.RLen)) {
 						Coherent = false;
-						return;
+						return false;
 					}
-					StatRec.DirtyWrites++;
 				}
+				else {
+					if (!putCachedRecord(Shard.Keys.getString(Line.RKey), Line.RPtr, Line.RLen)) {
+						Coherent = false;
+						return false;
+					}
+					countStat(&StatSlot::DirtyWrites);
+				}
+			}
 
-				//  Evict the selected entry
-				Keys.deleteString(pCL[Evictee].RKey);
-				destroyCachedRecord(pCL[Evictee].RPtr, pCL[Evictee].RLen);
-				Size = Size - pCL[Evictee].RLen;
-				pCL[Evictee].DirtyBit = false;
-				pCL[Evictee].Expiry = CLOCK::now();
-				pCL[Evictee].LastRef = CLOCK::now();
-				pCL[Evictee].RefCount = 0;
-				pCL[Evictee].RKey = NULLSTRREF;
-				pCL[Evictee].RLen = 0;
-				pCL[Evictee].RPtr = nullptr;
+			//  Purge the entry from the cache (a queued record is now owned by the write-behind queue)
+			Shard.Keys.deleteString(Line.RKey);
+			if (!Line.DirtyBit || (COpts & WRITE_BEHIND) == 0) destroyCachedRecord(Line.RPtr, Line.RLen);
+			Shard.Size = Shard.Size - chargeFor(Line.RLen);
+			noteRemoval(Line.RLen);
+			Line.DirtyBit = false;
+			Line.Expiry = CLOCK::now();
+			Line.LastRef = CLOCK::now();
+			Line.RefCount = 0;
+			Line.RKey = NULLSTRREF;
+			Line.RLen = 0;
+			Line.RPtr = nullptr;
+			Line.Pins = 0;
+
+			//  Shuffle up any following entries
+			if (Index < (Shard.UCL - 1)) memmove(&Shard.pCL[Index], &Shard.pCL[Index + 1], (Shard.UCL - (Index + 1)) * sizeof(CacheLine));
+			Shard.UCL--;
+
+			//  Return showing success
+			return true;
+		}
+
+		//  queueWrite
+		//
+		//  This function will queue a dirty record for the write-behind thread, the queue takes ownership of the record.
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the key of the record
+		//		BYTE*			-		Pointer to the record
+		//		size_t			-		Size of the record
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the record was queued, otherwise false
+		//
+		//  NOTES:
+		//
+		//	1.	If a write for the same key is already queued (and not yet in flight) the queued record is replaced
+		//  
+
+		bool		queueWrite(const char* Key, BYTE* Rec, size_t RecLen) {
+			std::lock_guard<std::mutex>		WBGuard(WBLock);
+			size_t							KeyLen = strlen(Key);									//  Length of the key
+
+			//  Coalesce with any queued write for the same key
+			for (size_t WBX = 0; WBX < UWB; WBX++) {
+				if (matchKey(pWB[WBX].Key, Key)) {
+					destroyCachedRecord(pWB[WBX].RPtr, pWB[WBX].RLen);
+					WBBytes = (WBBytes - pWB[WBX].RLen) + RecLen;
+					pWB[WBX].RPtr = Rec;
+					pWB[WBX].RLen = RecLen;
+					countStat(&StatSlot::Coalesces);
+					return true;
+				}
+			}
+
+			//  Make sure that the queue has capacity
+			if (NWB == UWB) {
+				PendingWrite* pNewWB = (PendingWrite*) realloc(pWB, (NWB + 16) * sizeof(PendingWrite));
+				if (pNewWB == nullptr) return false;
+				pWB = pNewWB;
+				NWB += 16;
+			}
+
+			//  Add the write to the queue
+			pWB[UWB].Key = (char*) malloc(KeyLen + 1);
+			if (pWB[UWB].Key == nullptr) return false;
+			memcpy(pWB[UWB].Key, Key, KeyLen + 1);
+			pWB[UWB].RPtr = Rec;
+			pWB[UWB].RLen = RecLen;
+			UWB++;
+			WBBytes += RecLen;
+
+			//  Wake the write-behind thread
+			WBSignal.notify_all();
+			return true;
+		}
+
+		//  reclaimPendingWrite
+		//
+		//  This function will remove a queued write for the passed key from the write-behind queue and return the record.
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the key of the record
+		//		size_t&			-		Reference to the variable to hold the length of the reclaimed record
+		//		bool			-		true if a copy of a record that is in flight should be returned
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the reclaimed record (now owned by the caller), NULL if none is queued
+		//
+		//  NOTES:
+		//
+		//	1.	The function never waits for the write-behind thread, it is called with the shard lock held.
+		//	2.	If the key is not queued but a write of it is in flight then (optionally) a copy of the in flight record
+		//		is returned, a read from the store could otherwise precede the write of the batch.
+		//  
 
-				UCL--;
+		BYTE*		reclaimPendingWrite(const char* Key, size_t& RecLen, bool CopyInFlight) {
+			std::unique_lock<std::mutex>	WBGuard(WBLock);
+			BYTE*							pRec = nullptr;											//  Reclaimed record
+
+			//  Search the queue for the key (the queue is newer than any batch in flight)
+			for (size_t WBX = 0; WBX < UWB; WBX++) {
+				if (matchKey(pWB[WBX].Key, Key)) {
+					pRec = pWB[WBX].RPtr;
+					RecLen = pWB[WBX].RLen;
+					WBBytes -= RecLen;
+					free(pWB[WBX].Key);
+
+					//  Close up the queue to preserve the order of writes
+					if (WBX < (UWB - 1)) memmove(&pWB[WBX], &pWB[WBX + 1], (UWB - (WBX + 1)) * sizeof(PendingWrite));
+					UWB--;
+					WBSignal.notify_all();
+					return pRec;
+				}
+			}
 
-				StatRec.Evictions++;
+			//  Copy the record from a batch in flight, the records of a batch are destroyed when the batch is retired
+			if (CopyInFlight) {
+				for (size_t WBX = UWBF; WBX > 0; WBX--) {
+					if (matchKey(pWBF[WBX - 1].Key, Key)) {
+						pRec = allocateRecord(pWBF[WBX - 1].RLen);
+						if (pRec == nullptr) return nullptr;
+						memcpy(pRec, pWBF[WBX - 1].RPtr, pWBF[WBX - 1].RLen);
+						RecLen = pWBF[WBX - 1].RLen;
+						return pRec;
+					}
+				}
+			}
+
+			//  Nothing queued for the key
+			return nullptr;
+		}
+
+		//  awaitWriteBehind
+		//
+		//  This function will wait until the write-behind queue is below the limit or (optionally) empty.
+		//
+		//  PARAMETERS:
+		//
+		//		bool			-		true to wait until the queue is empty, false to wait until it is within the limit
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		awaitWriteBehind(bool Drain) {
+			std::unique_lock<std::mutex>	WBGuard(WBLock);
+
+			//  No waiting is possible if the thread is not running
+			if (!WBThread.joinable()) return;
+
+			if (Drain) WBSignal.wait(WBGuard, [this] { return WBStop || (UWB == 0 && UWBF == 0); });
+			else WBSignal.wait(WBGuard, [this] { return WBStop || WBBytes <= (WBLimit * 1024); });
+			return;
+		}
+
+		//  stopWriteBehind
+		//
+		//  This function will stop the write-behind thread once the queue has been written.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		stopWriteBehind() {
+
+			//  Safety
+			if (!WBThread.joinable()) return;
+
+			//  Request the stop and wait for the thread to end
+			{
+				std::lock_guard<std::mutex>		WBGuard(WBLock);
+				WBStop = true;
+				WBSignal.notify_all();
+			}
+			WBThread.join();
+
+			//  Release the queues
+			if (pWB != nullptr) free(pWB);
+			pWB = nullptr;
+			NWB = UWB = 0;
+			if (pWBF != nullptr) free(pWBF);
+			pWBF = nullptr;
+			NWBF = UWBF = 0;
+
+			//  Return to caller
+			return;
+		}
+
+		//  writeBehind
+		//
+		//  This is the write-behind thread main function, it writes the queued records to the backing store in batches.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	The storage functions are called without any cache lock held so readers are never blocked on the writes
+		//	2.	On a stop request the queue is drained before the thread ends
+		//  
+
+		void		writeBehind() {
+			std::unique_lock<std::mutex>	WBGuard(WBLock);
+			PendingWrite*					pSwap = nullptr;										//  Queue swap
+			size_t							NSwap = 0;												//  Queue capacity swap
+
+			while (true) {
+
+				//  Wait for work
+				WBSignal.wait(WBGuard, [this] { return WBStop || UWB > 0; });
+				if (UWB == 0) break;
+
+				//  Take the queue as the next batch
+				pSwap = pWBF;
+				NSwap = NWBF;
+				pWBF = pWB;
+				NWBF = NWB;
+				UWBF = UWB;
+				pWB = pSwap;
+				NWB = NSwap;
+				UWB = 0;
+				WBGuard.unlock();
+
+				//  Write the batch
+				for (size_t WBX = 0; WBX < UWBF; WBX++) {
+					if (!putCachedRecord(pWBF[WBX].Key, pWBF[WBX].RPtr, pWBF[WBX].RLen)) Coherent = false;
+					else countStat(&StatSlot::DirtyWrites);
+				}
+				if (!syncCachedRecords()) Coherent = false;
+				countStat(&StatSlot::Batches);
+
+				//  Retire the batch and signal any waiters (readers may copy the records of the batch until it is retired)
+				WBGuard.lock();
+				for (size_t WBX = 0; WBX < UWBF; WBX++) {
+					destroyCachedRecord(pWBF[WBX].RPtr, pWBF[WBX].RLen);
+					WBBytes -= pWBF[WBX].RLen;
+					free(pWBF[WBX].Key);
+				}
+				UWBF = 0;
+				WBSignal.notify_all();
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  matchKey
+		//
+		//  This function will compare two keys observing the key case option.
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the first key
+		//		char*			-		Const pointer to the second key
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the keys match, otherwise false
+		//
+		//  NOTES:
+		//  
+
+		bool		matchKey(const char* Key1, const char* Key2) {
+			if (COpts & OBSERVE_KEY_CASE) return strcmp(Key1, Key2) == 0;
+			return _stricmp(Key1, Key2) == 0;
+		}
+
+		//  retireRecord
+		//
+		//  This function will retire a pinned record that is being replaced or purged, the record is destroyed when the
+		//  last pin is released.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard&		-		Reference to the (locked) shard
+		//		BYTE*			-		Pointer to the record
+		//		size_t			-		Size of the record
+		//		size_t			-		Count of outstanding pins
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the record was retired, otherwise false
+		//
+		//  NOTES:
+		//  
+
+		bool		retireRecord(CacheShard& Shard, BYTE* Rec, size_t RecLen, size_t Pins) {
+
+			//  Make sure that the retired record list has capacity
+			if (Shard.NRR == Shard.URR) {
+				RetiredRecord* pNewRR = (RetiredRecord*) realloc(Shard.pRR, (Shard.NRR + 16) * sizeof(RetiredRecord));
+				if (pNewRR == nullptr) return false;
+				Shard.pRR = pNewRR;
+				Shard.NRR += 16;
+			}
+
+			//  Add the record to the list
+			Shard.pRR[Shard.URR].RPtr = Rec;
+			Shard.pRR[Shard.URR].RLen = RecLen;
+			Shard.pRR[Shard.URR].Pins = Pins;
+			Shard.URR++;
+
+			//  Return showing success
+			return true;
+		}
+
+		//  unpin
+		//
+		//  This function will release a pin on a record, called when a CachedRef is released.
+		//
+		//  PARAMETERS:
+		//
+		//		CacheShard*		-		Pointer to the shard holding the record
+		//		BYTE*			-		Pointer to the pinned record
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	If the record has been retired and this is the last pin then the record is destroyed
+		//  
+
+		void		unpin(CacheShard* pShard, BYTE* Rec) {
+
+			//  Safety
+			if (pShard == nullptr || Rec == nullptr) return;
+
+			std::lock_guard<std::mutex>		ShardGuard(pShard->Lock);
+
+			//  Search for the record in the cache lines
+			for (size_t CEIX = 0; CEIX < pShard->UCL; CEIX++) {
+				if (pShard->pCL[CEIX].RPtr == Rec && pShard->pCL[CEIX].Pins > 0) {
+					pShard->pCL[CEIX].Pins--;
+					return;
+				}
+			}
+
+			//  Search for the record in the retired records
+			for (size_t RRX = 0; RRX < pShard->URR; RRX++) {
+				if (pShard->pRR[RRX].RPtr == Rec) {
+					pShard->pRR[RRX].Pins--;
+					if (pShard->pRR[RRX].Pins == 0) {
+						destroyCachedRecord(pShard->pRR[RRX].RPtr, pShard->pRR[RRX].RLen);
+						pShard->URR--;
+						if (RRX < pShard->URR) pShard->pRR[RRX] = pShard->pRR[pShard->URR];
+					}
+					return;
+				}
 			}
 
 			//  Return to caller
@@ -993,6 +2128,22 @@ namespace xymorg {
 
 		virtual void	destroyCachedRecord(BYTE* Rec, size_t RecLen) = 0;
 
+		//  syncCachedRecords
+		//
+		//  This function is called by the write-behind thread after each batch of records has been written to the backing
+		//  store, extending classes may override it to commit or flush the store once per batch.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool		-		true for a successful commit, false will cause the cache to become incoherent (unuseable)
+		//
+		//  NOTES:
+		//
+
+		virtual bool	syncCachedRecords() { return true; }
+
 
 	};
 
@@ -146,7 +146,7 @@
 #define		strregmatch(s,m)		std::regex_match(s,m)
 #define		strregsearch(s,m)		std::regex_search(s,m)
 #else
-#define		matching_expression(s)	s
+#define		matching_expression(s)	StringThing::Regex(s)
 #define		strregmatch(s,m)		StringThing::_regex_match(s,strlen(s),m)
 #define		strregsearch(s,m)		StringThing::_regex_search(s,strlen(s),m)
 #endif
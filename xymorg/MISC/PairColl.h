@@ -3,10 +3,10 @@
 //*																													*
 //*   File:       PairColl.h																						*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.0.0	(Build: 01)																					*
+//*   Version:    1.1.0	(Build: 03)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2017 - 2018 Ian J. Tree.														*
+//*   Copyright 2017 - 2026 Ian J. Tree.																				*
 //*******************************************************************************************************************
 //*																													*
 //*	This header file contains the definition for the PairColl class. The class provides storage and manipulation	*
@@ -17,13 +17,16 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		Names are matched case insensitively. Each pair caches the lengths of the name and value and the		*
+//*			case-folded hash of the name, collections larger than IndexThreshold pairs are searched through a		*
+//*			hash index.																								*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
 //*   History:																										*
 //*																													*
 //*	1.0.0 -		06/11/2018	-	Initial Release																		*
+//*	1.1.0 -		19/10/2026	-	Hash indexed name lookup and cached name/value lengths								*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -59,6 +62,10 @@ namespace xymorg {
 		typedef struct Pair {
 			STRREF			Name;															//  Variable Name
 			STRREF			Value;															//  Variable Value
+			size_t			NameLen;														//  Length of the name
+			size_t			ValueLen;														//  Length of the value
+			uint32_t		Hash;															//  Case-folded hash of the name
+			size_t			Next;															//  Next pair in the index chain (+1)
 		} Pair;
 
 		//*******************************************************************************************************************
@@ -70,6 +77,7 @@ namespace xymorg {
 	private:
 
 		static const int		PAIR_INIT_CAP = 100;											//  Initial capacity of the Gateway variables array
+		static const size_t		IndexThreshold = 8;												//  Number of pairs above which the index is used
 
 	public:
 
@@ -90,7 +98,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		PairColl() : SPool() {
+		PairColl() : SPool(), NBkt(0), pBkt(nullptr) {
 
 			//  Variable Pair Array
 			PVCap = PAIR_INIT_CAP;
@@ -118,7 +126,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		PairColl(const PairColl& Src) : SPool(Src.SPool) {
+		PairColl(const PairColl& Src) : SPool(Src.SPool), NBkt(0), pBkt(nullptr) {
 
 			PVCap = Src.PVCap;
 			PVCount = Src.PVCount;
@@ -133,6 +141,9 @@ namespace xymorg {
 			// Copy the array of Pairs
 			memcpy(pPairs, Src.pPairs, PVCap * sizeof(Pair));
 
+			//  Build the index
+			rebuildIndex();
+
 			//  Return to caller
 			return;
 		}
@@ -155,9 +166,13 @@ namespace xymorg {
 			PVCap = Src.PVCap;
 			PVCount = Src.PVCount;
 			pPairs = Src.pPairs;
+			NBkt = Src.NBkt;
+			pBkt = Src.pBkt;
 			Src.PVCap = 0;
 			Src.PVCount = 0;
 			Src.pPairs = nullptr;
+			Src.NBkt = 0;
+			Src.pBkt = nullptr;
 
 			SPool = std::move(Src.SPool);
 
@@ -223,6 +238,11 @@ namespace xymorg {
 			PVCap = 0;
 			PVCount = 0;
 
+			//  Free the index
+			if (pBkt != nullptr) free(pBkt);
+			pBkt = nullptr;
+			NBkt = 0;
+
 			//  Dismiss the string pool contents
 			SPool.dismiss();
 
@@ -248,28 +268,36 @@ namespace xymorg {
 
 		bool	addVariable(const char* pVName, const char* pValue) {
 			size_t		VX = 0;																//  Variable index
+			size_t		VNL = 0;															//  Variable name length
+			size_t		VVL = 0;															//  Variable value length
+			uint32_t	Hash = 0;															//  Name hash
 
 			//  Safety
 			if (pVName == nullptr) return false;
 			if (pVName[0] == '\0') return false;
+			VNL = strlen(pVName);
+			if (pValue != nullptr) VVL = strlen(pValue);
 
 			//  Determine if this is a replacement or addition
-			for (VX = 0; VX < PVCount; VX++) {
-				if (_stricmp(SPool.getString(pPairs[VX].Name), pVName) == 0) break;
-			}
+			Hash = hashName(pVName, VNL);
+			VX = locateVariable(pVName, VNL, Hash);
 
 			//  Add a new variable pair entry
 			if (VX == PVCount) {
 				if (!expandArray(PVCap, PVCount, pPairs)) return false;
-				pPairs[PVCount].Name = SPool.addString(pVName);
-				pPairs[PVCount].Value = SPool.addString(pValue);
+				pPairs[PVCount].Name = SPool.addString(pVName, VNL);
+				pPairs[PVCount].Value = SPool.addString(pValue, VVL);
+				pPairs[PVCount].NameLen = VNL;
+				pPairs[PVCount].ValueLen = VVL;
+				indexVariable(PVCount, Hash);
 				PVCount++;
 			}
 			else {
 				//  Replace the value of the named variable in the pool - if it has changed
-				if (strcmp(SPool.getString(pPairs[VX].Value), pValue) != 0) {
+				if (pPairs[VX].ValueLen != VVL || memcmp(SPool.getString(pPairs[VX].Value), pValue, VVL) != 0) {
 					if (pPairs[VX].Name != NULLSTRREF && pPairs[VX].Value != pPairs[VX].Name) SPool.deleteString(pPairs[VX].Value);
-					pPairs[VX].Value = SPool.addString(pValue);
+					pPairs[VX].Value = SPool.addString(pValue, VVL);
+					pPairs[VX].ValueLen = VVL;
 				}
 			}
 
@@ -297,6 +325,7 @@ namespace xymorg {
 
 		bool	addVariable(const char* pVName, size_t VNL, const char* pValue, size_t VVL) {
 			size_t		VX = 0;																//  Variable index
+			uint32_t	Hash = 0;															//  Name hash
 
 			//  Safety
 			if (pVName == nullptr) return false;
@@ -305,23 +334,24 @@ namespace xymorg {
 			if (pValue == nullptr) VVL = 0;
 
 			//  Determine if this is a replacement or addition
-			for (VX = 0; VX < PVCount; VX++) {
-				if (_strnicmp(SPool.getString(pPairs[VX].Name), pVName, VNL) == 0) {
-					if (VNL == SPool.getLength(pPairs[VX].Name)) break;
-				}
-			}
+			Hash = hashName(pVName, VNL);
+			VX = locateVariable(pVName, VNL, Hash);
 
 			//  Add a new variable pair entry
 			if (VX == PVCount) {
 				if (!expandArray(PVCap, PVCount, pPairs)) return false;
 				pPairs[PVCount].Name = SPool.addString(pVName, VNL);
 				pPairs[PVCount].Value = SPool.addString(pValue, VVL);
+				pPairs[PVCount].NameLen = VNL;
+				pPairs[PVCount].ValueLen = VVL;
+				indexVariable(PVCount, Hash);
 				PVCount++;
 			}
 			else {
 				//  Replace the value of the named variable in the pool
 				if (pPairs[VX].Name != NULLSTRREF && pPairs[VX].Value != pPairs[VX].Name) SPool.deleteString(pPairs[VX].Value);
 				pPairs[VX].Value = SPool.addString(pValue, VVL);
+				pPairs[VX].ValueLen = VVL;
 			}
 
 			//  Return success
@@ -351,9 +381,7 @@ namespace xymorg {
 			if (pVName[0] == '\0') return false;
 
 			//  Determine if the nameed variable exists in the pairs array
-			for (VX = 0; VX < PVCount; VX++) {
-				if (_stricmp(SPool.getString(pPairs[VX].Name), pVName) == 0) break;
-			}
+			VX = locateVariable(pVName, strlen(pVName));
 
 			//  If the variable name was NOT FOUND - just return
 			if (VX == PVCount) return false;
@@ -365,13 +393,11 @@ namespace xymorg {
 			if (pPairs[VX].Name != NULLSTRREF && pPairs[VX].Value != pPairs[VX].Name) SPool.deleteString(pPairs[VX].Value);
 
 			//  Shuffle up the remaining entries in the pairs array
-			for (VX++; VX < PVCount; VX++) {
-				pPairs[VX - 1].Name = pPairs[VX].Name;
-				pPairs[VX - 1].Value = pPairs[VX].Value;
-			}
+			if ((VX + 1) < PVCount) memmove(&pPairs[VX], &pPairs[VX + 1], (PVCount - (VX + 1)) * sizeof(Pair));
 
-			//  Reduce the count
+			//  Reduce the count and rebuild the index (positions have changed)
 			PVCount--;
+			rebuildIndex();
 
 			//  Return to caller
 			return true;
@@ -398,7 +424,7 @@ namespace xymorg {
 			if (pVName == nullptr) return 0;
 			if (pVName[0] == '\0') return 0;
 
-			return getValueLength(pVName, PVCount, pPairs);
+			return getValueLength(pVName);
 		}
 
 		//  getLength
@@ -418,7 +444,7 @@ namespace xymorg {
 
 		size_t		getLength(size_t VPX) {
 			if (VPX >= PVCount) return 0;
-			return SPool.getLength(pPairs[VPX].Value);
+			return pPairs[VPX].ValueLen;
 		}
 
 		//  getNameLength
@@ -438,7 +464,7 @@ namespace xymorg {
 
 		size_t		getNameLength(size_t VPX) {
 			if (VPX >= PVCount) return 0;
-			return SPool.getLength(pPairs[VPX].Name);
+			return pPairs[VPX].NameLen;
 		}
 
 		//  getName
@@ -481,9 +507,8 @@ namespace xymorg {
 			//  Safety
 			if (pVName == nullptr) return nullptr;
 			if (pVName[0] == '\0') return nullptr;
-			if (getLength(pVName) == 0) return SPool.getString(NULLSTRREF);
 
-			return getValueString(pVName, PVCount, pPairs);
+			return getValueString(pVName);
 		}
 
 		//  getValue
@@ -616,6 +641,7 @@ namespace xymorg {
 
 		PairColl&	operator = (const PairColl& rhs) {
 
+			if (this == &rhs) return *this;
 			if (pPairs != nullptr) free(pPairs);
 			PVCap = rhs.PVCap;
 			PVCount = rhs.PVCount;
@@ -624,6 +650,7 @@ namespace xymorg {
 				SPool.dismiss();
 				PVCap = 0;
 				PVCount = 0;
+				rebuildIndex();
 				return *this;
 			}
 
@@ -633,6 +660,9 @@ namespace xymorg {
 			//  Copy the string pool
 			SPool = rhs.SPool;
 
+			//  Build the index
+			rebuildIndex();
+
 			//  Return to caller
 			return *this;
 		}
@@ -654,6 +684,7 @@ namespace xymorg {
 
 		PairColl&	operator = (PairColl&& rhs) noexcept {
 
+			if (this == &rhs) return *this;
 			if (pPairs != nullptr) free(pPairs);
 			PVCap = rhs.PVCap;
 			PVCount = rhs.PVCount;
@@ -663,6 +694,13 @@ namespace xymorg {
 			rhs.PVCount = 0;
 			rhs.pPairs = nullptr;
 
+			//  Take over the index
+			if (pBkt != nullptr) free(pBkt);
+			NBkt = rhs.NBkt;
+			pBkt = rhs.pBkt;
+			rhs.NBkt = 0;
+			rhs.pBkt = nullptr;
+
 			//  Move the string pool
 			SPool = std::move(rhs.SPool);
 
@@ -685,6 +723,10 @@ namespace xymorg {
 		size_t				PVCount;														//  Count of gateway variables
 		Pair*				pPairs;															//  Pointer to the Gateway pairs array
 
+		//  Name index
+		size_t				NBkt;															//  Number of index buckets (0 if not indexed)
+		size_t*				pBkt;															//  Index buckets (pair index + 1)
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions																								*
@@ -726,13 +768,11 @@ namespace xymorg {
 
 		//  getValueLength
 		//
-		//  This function will return the length of the value of the named variable in the passed pool
+		//  This function will return the length of the value of the named variable
 		//
 		//  PARAMETERS:
 		//
 		//		char*			-		Const pointer to the variable to be queried
-		//		size_t&			-		Reference to the current count
-		//		Pait*&			-		Reference to the array pointer
 		//
 		//  RETURNS:
 		//
@@ -741,19 +781,16 @@ namespace xymorg {
 		//  NOTES:
 		//  
 
-		size_t		getValueLength(const char* pVName, size_t& Count, Pair*& pArray) {
+		size_t		getValueLength(const char* pVName) {
 
 			//  Safety 
 			if (pVName == nullptr) return 0;
 			if (pVName[0] == '\0') return 0;
-			if (Count == 0) return 0;
+			if (PVCount == 0) return 0;
 			
 			//  Search the pool for an entry that matches the passed name (case insensitive)
-			for (size_t PAX = 0; PAX < Count; PAX++) {
-				if (_stricmp(pVName, SPool.getString(pArray[PAX].Name)) == 0) {
-					return SPool.getLength(pArray[PAX].Value);
-				}
-			}
+			size_t		PAX = locateVariable(pVName, strlen(pVName));
+			if (PAX < PVCount) return pPairs[PAX].ValueLen;
 
 			//  Not found - return 0
 			return 0;
@@ -766,8 +803,6 @@ namespace xymorg {
 		//  PARAMETERS:
 		//
 		//		char*			-		Const pointer to the variable to be queried
-		//		size_t&			-		Reference to the current count
-		//		Pait*&			-		Reference to the array pointer
 		//
 		//  RETURNS:
 		//
@@ -776,24 +811,197 @@ namespace xymorg {
 		//  NOTES:
 		//  
 
-		const char*		getValueString(const char* pVName, size_t& Count, Pair*& pArray) {
+		const char*		getValueString(const char* pVName) {
 
 			//  Safety 
 			if (pVName == nullptr) return nullptr;
 			if (pVName[0] == '\0') return nullptr;
-			if (Count == 0) return nullptr;
+			if (PVCount == 0) return nullptr;
 
 			//  Search the pool for an entry that matches the passed name (case insensitive)
-			for (size_t PAX = 0; PAX < Count; PAX++) {
-				if (_stricmp(pVName, SPool.getString(pArray[PAX].Name)) == 0) {
-					return SPool.getString(pArray[PAX].Value);
-				}
-			}
+			size_t		PAX = locateVariable(pVName, strlen(pVName));
+			if (PAX < PVCount) return SPool.getString(pPairs[PAX].Value);
 
 			//  Not found - return an empty string
 			return SPool.getString(NULLSTRREF);
 		}
 
+		//  hashName
+		//
+		//  This function computes the (FNV-1a) case-folded hash of a variable name
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the variable name
+		//		size_t			-		Length of the variable name
+		//
+		//  RETURNS:
+		//
+		//		uint32_t		-		Hash of the name
+		//
+		//  NOTES:
+		//  
+
+		static uint32_t		hashName(const char* pVName, size_t VNL) {
+			uint32_t	Hash = 2166136261U;													//  Hash value
+
+			for (size_t CX = 0; CX < VNL; CX++) {
+				Hash ^= uint32_t(tolower(BYTE(pVName[CX])));
+				Hash *= 16777619U;
+			}
+
+			return Hash;
+		}
+
+		//  locateVariable
+		//
+		//  This function will locate the named variable in the pairs array
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the variable name
+		//		size_t			-		Length of the variable name
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the variable, PVCount if not found
+		//
+		//  NOTES:
+		//  
+
+		size_t		locateVariable(const char* pVName, size_t VNL) { return locateVariable(pVName, VNL, hashName(pVName, VNL)); }
+
+		//  locateVariable
+		//
+		//  This function will locate the named variable in the pairs array
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Const pointer to the variable name
+		//		size_t			-		Length of the variable name
+		//		uint32_t		-		Case-folded hash of the name
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the variable, PVCount if not found
+		//
+		//  NOTES:
+		//
+		//		1.	Small collections are scanned, the hash and length are compared before the name is
+		//  
+
+		size_t		locateVariable(const char* pVName, size_t VNL, uint32_t Hash) {
+
+			//  Search the index
+			if (NBkt > 0) {
+				size_t		Link = pBkt[Hash & (NBkt - 1)];
+				while (Link != 0) {
+					Pair&		Cand = pPairs[Link - 1];
+					if (Cand.Hash == Hash && Cand.NameLen == VNL && _memicmp(SPool.getString(Cand.Name), pVName, VNL) == 0) return Link - 1;
+					Link = Cand.Next;
+				}
+				return PVCount;
+			}
+
+			//  Scan the pairs
+			for (size_t VX = 0; VX < PVCount; VX++) {
+				if (pPairs[VX].Hash == Hash && pPairs[VX].NameLen == VNL && _memicmp(SPool.getString(pPairs[VX].Name), pVName, VNL) == 0) return VX;
+			}
+
+			//  Not found
+			return PVCount;
+		}
+
+		//  indexVariable
+		//
+		//  This function will add a new pair to the index
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Index of the pair
+		//		uint32_t		-		Case-folded hash of the name
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The index is built when the collection grows past IndexThreshold and doubled when it is half full
+		//  
+
+		void	indexVariable(size_t VX, uint32_t Hash) {
+
+			pPairs[VX].Hash = Hash;
+			pPairs[VX].Next = 0;
+
+			//  Build or expand the index if needed
+			if ((VX + 1) > IndexThreshold && ((VX + 1) * 2) > NBkt) {
+				rebuildIndex(VX + 1);
+				return;
+			}
+
+			//  Link into the index
+			if (NBkt > 0) {
+				pPairs[VX].Next = pBkt[Hash & (NBkt - 1)];
+				pBkt[Hash & (NBkt - 1)] = VX + 1;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  rebuildIndex
+		//
+		//  This function will rebuild the index for the pairs currently in the array
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Number of pairs to index (defaults to PVCount)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	If the index cannot be allocated the pairs are scanned
+		//  
+
+		void	rebuildIndex(size_t Count = SIZE_MAX) {
+			size_t		NewBkt = 32;														//  New number of buckets
+
+			if (Count == SIZE_MAX) Count = PVCount;
+
+			//  Small collections are not indexed
+			if (Count <= IndexThreshold) {
+				if (pBkt != nullptr) free(pBkt);
+				pBkt = nullptr;
+				NBkt = 0;
+				return;
+			}
+
+			//  Size the index to a power of two at least twice the pair count
+			while (NewBkt < (Count * 2)) NewBkt = NewBkt * 2;
+			if (NewBkt != NBkt) {
+				size_t* pNewBkt = (size_t*) realloc(pBkt, NewBkt * sizeof(size_t));
+				if (pNewBkt == nullptr) {
+					if (pBkt != nullptr) free(pBkt);
+					pBkt = nullptr;
+					NBkt = 0;
+					return;
+				}
+				pBkt = pNewBkt;
+				NBkt = NewBkt;
+			}
+			memset(pBkt, 0, NBkt * sizeof(size_t));
+
+			//  Link each pair into the index
+			for (size_t VX = 0; VX < Count; VX++) {
+				pPairs[VX].Next = pBkt[pPairs[VX].Hash & (NBkt - 1)];
+				pBkt[pPairs[VX].Hash & (NBkt - 1)] = VX + 1;
+			}
+
+			//  Return to caller
+			return;
+		}
+
 	};
 
 }
@@ -0,0 +1,1194 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       ConcurrentStringPool.h																			*
+//*   Suite:      xymorg Integration																				*
+//*   Version:    1.0.1	(Build: 02)																					*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the ConcurrentStringPool class. The class provides storage and		*
+//* reference for collections of strings that are shared between threads.											*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		The interface is the same as the StringPool class, all functions (except dismiss()) may be called			*
+//*		concurrently from any thread.																				*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.		Strings are stored in append-only segments that are never moved or released until the pool is			*
+//*			dismissed, a pointer returned by getString() remains valid for the lifetime of the pool (even after		*
+//*			the string has been deleted or replaced).																*
+//*	2.		getString() and getLength() are lock-free, each string is published with its length as a single			*
+//*			stored record.																							*
+//*	3.		Strings are partitioned into stripes by a case-folded hash, each stripe has its own lock, index and		*
+//*			storage segments. Additions, deletions and searches only lock the stripe for the string.				*
+//*	4.		The space occupied by deleted strings is not reused, references are reused.								*
+//*	5.		A reference must not be deleted or replaced by one thread while another thread is replacing it.			*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		19/10/2026	-	Initial Release																		*
+//*	1.0.1 -		19/10/2026	-	String and length are published together as a single stored record					*
+//*																													*
+//*******************************************************************************************************************/
+
+//
+//  Include core xymorg headers
+//
+
+#include	"../LPBHdrs.h"																	//  Language and Platform base headers
+#include	"../types.h"																	//  xymorg type definitions
+#include	"../consts.h"																	//  xymorg constant definitions
+
+//  Additional Language Headers
+#include	<atomic>																		//  Atomic references
+#include	<mutex>																			//  Stripe locks
+
+//
+//  All components are defined within the xymorg namespace
+//
+namespace xymorg {
+
+	//
+	//  ConcurrentStringPool Class Definition
+	//
+
+	class ConcurrentStringPool {
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Constants		                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+	private:
+
+		static const size_t	NumStripes = 64;														//  Number of stripes
+		static const size_t	RefChunkSize = 4096;													//  Number of references in a chunk
+		static const size_t	MaxRefChunks = 16384;													//  Maximum number of reference chunks
+		static const size_t	SegmentSize = 16384;													//  Default storage segment size (bytes)
+		static const size_t	MinBuckets = 16;														//  Minimum number of index buckets in a stripe
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Structures	                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Stored String (the null terminated string follows the record in the same segment)
+		typedef struct StoredString {
+			size_t						Len;														//  Length of the string
+		} StoredString;
+
+		//  String Reference Entry
+		typedef struct RefEntry {
+			std::atomic<const StoredString*>	Str;												//  Pointer to the stored string (NULL if unused)
+			std::atomic<size_t>			Hash;														//  Case-folded hash of the string
+			STRREF						Next;														//  Next reference in the stripe index chain
+		} RefEntry;
+
+		//  Stripe
+		typedef struct alignas(64) Stripe {
+			std::mutex	Lock;																		//  Stripe lock
+			STRREF*		pBkt;																		//  Index buckets
+			size_t		NBkt;																		//  Number of index buckets
+			size_t		Count;																		//  Number of strings in the stripe
+			STRREF*		pFree;																		//  Freed references
+			size_t		NFree;																		//  Number of freed reference slots
+			size_t		UFree;																		//  Number of freed reference slots used
+			char**		pSeg;																		//  Storage segments
+			size_t		NSeg;																		//  Number of segment slots
+			size_t		USeg;																		//  Number of segment slots used
+			size_t		SegUsed;																	//  Bytes used in the current segment
+			size_t		SegCap;																		//  Capacity of the current segment
+		} Stripe;
+
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Constructors			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Default Constructor
+		//
+		//  Constructs a new (empty) ConcurrentStringPool
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		ConcurrentStringPool() : pChunks(nullptr), NextRef(1), Strings(0), EmptyString(0) {
+
+			//  Allocate the reference chunk directory
+			pChunks = new std::atomic<RefEntry*>[MaxRefChunks];
+			for (size_t CX = 0; CX < MaxRefChunks; CX++) pChunks[CX] = nullptr;
+
+			//  Initialise the stripes
+			for (size_t SX = 0; SX < NumStripes; SX++) {
+				Stripes[SX].pBkt = nullptr;
+				Stripes[SX].NBkt = 0;
+				Stripes[SX].Count = 0;
+				Stripes[SX].pFree = nullptr;
+				Stripes[SX].NFree = 0;
+				Stripes[SX].UFree = 0;
+				Stripes[SX].pSeg = nullptr;
+				Stripes[SX].NSeg = 0;
+				Stripes[SX].USeg = 0;
+				Stripes[SX].SegUsed = 0;
+				Stripes[SX].SegCap = 0;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  Pools are not copyable nor moveable
+		ConcurrentStringPool(const ConcurrentStringPool& Src) = delete;
+		ConcurrentStringPool(ConcurrentStringPool&& Src) = delete;
+		ConcurrentStringPool& operator = (const ConcurrentStringPool& rhs) = delete;
+		ConcurrentStringPool& operator = (ConcurrentStringPool&& rhs) = delete;
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Destructor			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Destructor
+		//
+		//  Destroys the ConcurrentStringPool object releasing any underlying storage.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		~ConcurrentStringPool() {
+
+			//  Release all storage
+			dismiss();
+			if (pChunks != nullptr) delete[] pChunks;
+			pChunks = nullptr;
+
+			//  Return to caller
+			return;
+		}
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  dismiss
+		//
+		//  Releases acquired storage making the pool empty
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	This function is NOT thread safe, no other thread may be using the pool
+		//
+
+		void	dismiss() {
+
+			//  Release the reference chunks
+			if (pChunks != nullptr) {
+				for (size_t CX = 0; CX < MaxRefChunks; CX++) {
+					RefEntry* pChunk = pChunks[CX].exchange(nullptr);
+					if (pChunk != nullptr) delete[] pChunk;
+				}
+			}
+			NextRef = 1;
+			Strings = 0;
+
+			//  Release the stripe storage
+			for (size_t SX = 0; SX < NumStripes; SX++) {
+				Stripe& Str = Stripes[SX];
+
+				for (size_t SGX = 0; SGX < Str.USeg; SGX++) free(Str.pSeg[SGX]);
+				if (Str.pSeg != nullptr) free(Str.pSeg);
+				if (Str.pBkt != nullptr) free(Str.pBkt);
+				if (Str.pFree != nullptr) free(Str.pFree);
+				Str.pBkt = nullptr;
+				Str.NBkt = 0;
+				Str.Count = 0;
+				Str.pFree = nullptr;
+				Str.NFree = 0;
+				Str.UFree = 0;
+				Str.pSeg = nullptr;
+				Str.NSeg = 0;
+				Str.USeg = 0;
+				Str.SegUsed = 0;
+				Str.SegCap = 0;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  addString
+		//
+		//  Adds the passed null-terminated string to the pool as the next available entry
+		//
+		//  PARAMETERS:
+		//
+		//		char *			-		Pointer to the string to be added
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be added
+		//
+		//  NOTES:
+		//
+
+		STRREF		addString(const char* pNewString) {
+			if (pNewString == nullptr) return addString(nullptr, 0);
+			return addString(pNewString, strlen(pNewString));
+		}
+
+		//  addString
+		//
+		//  Adds the passed unterminated string to the pool as the next available entry
+		//
+		//  PARAMETERS:
+		//
+		//		char *			-		Pointer to the string to be added
+		//		size_t			-		String size (bytes)
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be added
+		//
+		//  NOTES:
+		//
+
+		STRREF		addString(const char* pNewString, size_t NewStrLen) {
+			size_t		Hash = 0;															//  Case-folded hash
+
+			//  Safety Checks
+			if (pNewString == nullptr) NewStrLen = 0;
+
+			Hash = hashString(pNewString, NewStrLen);
+			Stripe&		Str = Stripes[Hash % NumStripes];
+			std::lock_guard<std::mutex>		StripeGuard(Str.Lock);
+
+			return insertString(Str, NULLSTRREF, pNewString, NewStrLen, Hash);
+		}
+
+		//  getString
+		//
+		//  Dereferences a string reference returning the pointer to the string in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string,
+		//
+		//  RETURNS:
+		//
+		//		char*			-		Const Pointer to the null terminated string in the pool
+		//
+		//  NOTES:
+		//
+		//		1.	NULLSTRREF (or a deleted string) returns a pointer to the dummy empty string
+		//		2.	This function is lock-free
+		//
+
+		const char* getString(STRREF Ref) {
+			RefEntry*				pEntry = locateEntry(Ref);								//  Reference entry
+			const StoredString*		pStored = nullptr;										//  Stored string
+
+			if (pEntry == nullptr) return &EmptyString;
+			pStored = pEntry->Str.load(std::memory_order_acquire);
+			if (pStored == nullptr) return &EmptyString;
+			return (const char*)(pStored + 1);
+		}
+
+		//  copyString
+		//
+		//  Returns a copy (and therefore mutable) of a string from the pool
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string,
+		//
+		//  RETURNS:
+		//
+		//		char*			-		Pointer to the null terminated string in a new buffer
+		//
+		//  NOTES:
+		//
+		//		1.	NULLSTRREF returns a pointer to a buffer containing an empty string
+		//
+
+		char* copyString(STRREF Ref) {
+			const char*		pString = getString(Ref);										//  Pooled string
+			size_t			StrLen = strlen(pString);										//  Length of string
+			char*			pCopy = nullptr;												//  String buffer
+
+			//  Allocate new buffer
+			pCopy = (char*)malloc(StrLen + 1);
+			if (pCopy == nullptr) return nullptr;
+
+			memcpy(pCopy, pString, StrLen);
+			pCopy[StrLen] = '\0';
+			return pCopy;
+		}
+
+		//  getLength
+		//
+		//  Returns the length of a referenced string.
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string,
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Length of the referenced string
+		//
+		//  NOTES:
+		//
+		//		1.	This function is lock-free
+		//		2.	The length is taken from the same stored string record as getString() returns, a concurrent
+		//			replacement yields either the old or the new length, never a mix of the two
+		//
+
+		size_t		getLength(STRREF Ref) {
+			RefEntry*				pEntry = locateEntry(Ref);								//  Reference entry
+			const StoredString*		pStored = nullptr;										//  Stored string
+
+			if (pEntry == nullptr) return 0;
+			pStored = pEntry->Str.load(std::memory_order_acquire);
+			if (pStored == nullptr) return 0;
+			return pStored->Len;
+		}
+
+		//  deleteString
+		//
+		//  Removes the referenced string from the pool and frees the reference for reuse.
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string to be deleted.
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The storage of the string is retained, pointers to it remain valid
+		//
+
+		void		deleteString(STRREF Ref) {
+			RefEntry*		pEntry = locateEntry(Ref);										//  Reference entry
+
+			//  Any invalid reference returns with no further action
+			if (pEntry == nullptr) return;
+			if (pEntry->Str.load(std::memory_order_acquire) == nullptr) return;
+
+			Stripe&		Str = Stripes[pEntry->Hash.load(std::memory_order_relaxed) % NumStripes];
+			std::lock_guard<std::mutex>		StripeGuard(Str.Lock);
+
+			//  Recheck under the lock
+			if (pEntry->Str.load(std::memory_order_acquire) == nullptr) return;
+
+			//  Remove the string from the stripe and make the reference available for reuse
+			unlinkString(Str, Ref);
+			pushFreeRef(Str, Ref);
+
+			//  Return to caller
+			return;
+		}
+
+		//  replaceString
+		//
+		//  Replaces the content of the referenced string with the passed string value
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string to be replaced.
+		//		char*			-		Pointer to the null-terminated string containing the replacement value
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the new string could not be added
+		//
+		//  NOTES:
+		//
+		//		1.	The reference will NOT change unless the addition fails
+		//
+
+		STRREF		replaceString(STRREF Ref, const char* pNewString) {
+			if (pNewString == nullptr) return replaceString(Ref, nullptr, 0);
+			return replaceString(Ref, pNewString, strlen(pNewString));
+		}
+
+		//  replaceString
+		//
+		//  Replaces the content of the referenced string with the passed string value
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string to be replaced.
+		//		char*			-		Pointer to the string containing the replacement value
+		//		size_t			-		Length of the replacement string value
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the new string could not be added
+		//
+		//  NOTES:
+		//
+		//		1.	The reference will NOT change unless the addition fails
+		//		2.	Readers see either the old or the new value of the string, never a partial value
+		//
+
+		STRREF		replaceString(STRREF Ref, const char* pNewString, size_t NewStrLen) {
+			RefEntry*		pEntry = locateEntry(Ref);										//  Reference entry
+			size_t			Hash = 0;														//  Case-folded hash of the new string
+
+			//  Safety Checks
+			if (pNewString == nullptr) NewStrLen = 0;
+			if (pEntry == nullptr) return addString(pNewString, NewStrLen);
+			Hash = hashString(pNewString, NewStrLen);
+
+			//  Lock the stripes holding the old and new strings (in stripe order)
+			size_t		OldSX = pEntry->Hash.load(std::memory_order_relaxed) % NumStripes;
+			size_t		NewSX = Hash % NumStripes;
+			std::unique_lock<std::mutex>	FirstGuard(Stripes[(OldSX < NewSX) ? OldSX : NewSX].Lock);
+			std::unique_lock<std::mutex>	SecondGuard;
+			if (OldSX != NewSX) SecondGuard = std::unique_lock<std::mutex>(Stripes[(OldSX < NewSX) ? NewSX : OldSX].Lock);
+
+			//  Move the reference from the old stripe to the new stripe, an unused reference is claimed from the free stack
+			if (pEntry->Str.load(std::memory_order_acquire) != nullptr) unlinkIndex(Stripes[OldSX], Ref);
+			else claimFreeRef(Stripes[OldSX], Ref);
+			return insertString(Stripes[NewSX], Ref, pNewString, NewStrLen, Hash);
+		}
+
+		//  getStringCount
+		//
+		//  Returns the count of strings in the pool
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Count of strings in the pool
+		//
+		//  NOTES:
+		//
+
+		size_t		getStringCount() { return Strings.load(); }
+
+		//  searchString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the null-terminated string containing the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be found
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case sensitive
+		//
+
+		STRREF		searchString(const char* String) { return searchString(String, strlen(String), false); }
+
+		//  searchString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be located
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be found
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case sensitive
+		//
+
+		STRREF		searchString(const char* String, size_t StringLen) { return searchString(String, StringLen, false); }
+
+		//  searchStringi
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the null-terminated string containing the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be found
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case IN-sensitive
+		//
+
+		STRREF		searchStringi(const char* String) { return searchString(String, strlen(String), true); }
+
+		//  searchStringi
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be located
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be found
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case IN-sensitive
+		//
+
+		STRREF		searchStringi(const char* String, size_t StringLen) { return searchString(String, StringLen, true); }
+
+		//  searchString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be located
+		//		size_t			-		Length of the string
+		//		bool			-		if the matching is case insensitive
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be found
+		//
+		//  NOTES:
+		//
+
+		STRREF		searchString(const char* String, size_t StringLen, bool CaseInsensitive) {
+			size_t		Hash = 0;															//  Case-folded hash
+
+			//  Safety
+			if (String == nullptr) return NULLSTRREF;
+			if (StringLen == 0) return NULLSTRREF;
+			if (String[0] == '\0') return NULLSTRREF;
+
+			Hash = hashString(String, StringLen);
+			Stripe&		Str = Stripes[Hash % NumStripes];
+			std::lock_guard<std::mutex>		StripeGuard(Str.Lock);
+
+			return findString(Str, String, StringLen, Hash, CaseInsensitive);
+		}
+
+		//  addUniqueString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool. If not the string is added and the
+		//  reference returned
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the null-terminated string containing the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the existing or new string
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case sensitive
+		//
+
+		STRREF		addUniqueString(const char* String) { return addUniqueString(String, strlen(String), false); }
+
+		//  addUniqueString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool. If not the string is added and the
+		//  reference returned
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be added
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the existing or new string
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case sensitive
+		//
+
+		STRREF		addUniqueString(const char* String, size_t StringLen) { return addUniqueString(String, StringLen, false); }
+
+		//  addUniqueStringi
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool. If not the string is added and the
+		//  reference returned
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the null-terminated string containing the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the existing or new string
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case IN-sensitive
+		//
+
+		STRREF		addUniqueStringi(const char* String) { return addUniqueString(String, strlen(String), true); }
+
+		//  addUniqueStringi
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool. If not the string is added and the
+		//  reference returned
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be added
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the existing or new string
+		//
+		//  NOTES:
+		//
+		//		1.	This function is case IN-sensitive
+		//
+
+		STRREF		addUniqueStringi(const char* String, size_t StringLen) { return addUniqueString(String, StringLen, true); }
+
+		//  addUniqueString
+		//
+		//  Returns the reference (STRREF) to the passed string if exists in the pool. If not the string is added and the
+		//  reference returned
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string to be added
+		//		size_t			-		Length of the string
+		//		bool			-		true if the matching is case insensitive
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the existing or new string
+		//
+		//  NOTES:
+		//
+		//		1.	The search and the addition are atomic, concurrent callers adding the same string receive the
+		//			same reference
+		//
+
+		STRREF		addUniqueString(const char* String, size_t StringLen, bool CaseInsensitive) {
+			size_t		Hash = 0;															//  Case-folded hash
+			STRREF		Ref = NULLSTRREF;													//  String reference
+
+			//  Safety
+			if (String == nullptr) return NULLSTRREF;
+			if (StringLen == 0) return NULLSTRREF;
+
+			Hash = hashString(String, StringLen);
+			Stripe&		Str = Stripes[Hash % NumStripes];
+			std::lock_guard<std::mutex>		StripeGuard(Str.Lock);
+
+			Ref = findString(Str, String, StringLen, Hash, CaseInsensitive);
+			if (Ref == NULLSTRREF) Ref = insertString(Str, NULLSTRREF, String, StringLen, Hash);
+			return Ref;
+		}
+
+	private:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Members																								*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		std::atomic<RefEntry*>*		pChunks;												//  Reference chunk directory
+		std::atomic<size_t>			NextRef;												//  Next unissued reference
+		std::atomic<size_t>			Strings;												//  Number of strings in the pool
+		Stripe						Stripes[NumStripes];									//  Stripes
+		char						EmptyString;											//  Empty String
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Functions																								*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  hashString
+		//
+		//  Computes the (FNV-1a) case-folded hash of a string
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The hash of the string
+		//
+		//  NOTES:
+		//
+		//		1.	The hash is case-folded so that case sensitive and insensitive searches locate the same stripe
+		//
+
+		static size_t	hashString(const char* String, size_t StringLen) {
+			uint32_t	Hash = 2166136261U;													//  Hash value
+
+			for (size_t CX = 0; CX < StringLen; CX++) {
+				Hash ^= uint32_t(tolower(BYTE(String[CX])));
+				Hash *= 16777619U;
+			}
+
+			return size_t(Hash);
+		}
+
+		//  locateEntry
+		//
+		//  Locates the reference entry for a reference
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string
+		//
+		//  RETURNS:
+		//
+		//		RefEntry*		-		Pointer to the entry, NULL if the reference has not been issued
+		//
+		//  NOTES:
+		//
+		//		1.	This function is lock-free
+		//
+
+		RefEntry*	locateEntry(STRREF Ref) {
+			RefEntry*		pChunk = nullptr;												//  Reference chunk
+
+			if (Ref == NULLSTRREF) return nullptr;
+			if ((size_t(Ref) - 1) / RefChunkSize >= MaxRefChunks) return nullptr;
+			pChunk = pChunks[(size_t(Ref) - 1) / RefChunkSize].load(std::memory_order_acquire);
+			if (pChunk == nullptr) return nullptr;
+			return &pChunk[(size_t(Ref) - 1) % RefChunkSize];
+		}
+
+		//  issueRef
+		//
+		//  Issues a reference for a new string, reusing a freed reference from the stripe if there is one
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		The reference, NULLSTRREF if no reference is available
+		//
+		//  NOTES:
+		//
+
+		STRREF	issueRef(Stripe& Str) {
+			size_t			Ref = 0;														//  New reference
+			size_t			CX = 0;															//  Chunk index
+
+			//  Reuse a freed reference
+			if (Str.UFree > 0) return Str.pFree[--Str.UFree];
+
+			//  Issue a new reference
+			Ref = NextRef.fetch_add(1);
+			CX = (Ref - 1) / RefChunkSize;
+			if (CX >= MaxRefChunks || Ref > size_t(STRREF(-1))) return NULLSTRREF;
+
+			//  Make sure that the chunk holding the reference exists
+			if (pChunks[CX].load(std::memory_order_acquire) == nullptr) {
+				RefEntry*	pNewChunk = new (std::nothrow) RefEntry[RefChunkSize];
+				RefEntry*	pExpected = nullptr;
+
+				if (pNewChunk == nullptr) return NULLSTRREF;
+				for (size_t EX = 0; EX < RefChunkSize; EX++) {
+					pNewChunk[EX].Str.store(nullptr, std::memory_order_relaxed);
+					pNewChunk[EX].Hash.store(0, std::memory_order_relaxed);
+					pNewChunk[EX].Next = NULLSTRREF;
+				}
+				if (!pChunks[CX].compare_exchange_strong(pExpected, pNewChunk, std::memory_order_acq_rel)) delete[] pNewChunk;
+			}
+
+			return STRREF(Ref);
+		}
+
+		//  pushFreeRef
+		//
+		//  Makes a reference available for reuse by the stripe
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		STRREF			-		The reference
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	If the free reference stack cannot be expanded the reference is not reused
+		//
+
+		void	pushFreeRef(Stripe& Str, STRREF Ref) {
+
+			if (Str.UFree == Str.NFree) {
+				size_t		NewCap = (Str.NFree == 0) ? 64 : Str.NFree * 2;
+				STRREF*		pNewFree = (STRREF*)realloc(Str.pFree, NewCap * sizeof(STRREF));
+				if (pNewFree == nullptr) return;
+				Str.pFree = pNewFree;
+				Str.NFree = NewCap;
+			}
+			Str.pFree[Str.UFree++] = Ref;
+
+			//  Return to caller
+			return;
+		}
+
+		//  claimFreeRef
+		//
+		//  Removes a specific reference from the free reference stack of a stripe
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe that freed the reference
+		//		STRREF			-		The reference being reused
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	claimFreeRef(Stripe& Str, STRREF Ref) {
+
+			for (size_t FX = Str.UFree; FX > 0; FX--) {
+				if (Str.pFree[FX - 1] == Ref) {
+					if (FX < Str.UFree) memmove(Str.pFree + (FX - 1), Str.pFree + FX, (Str.UFree - FX) * sizeof(STRREF));
+					Str.UFree--;
+					break;
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  storeString
+		//
+		//  Stores a copy of a string in the storage segments of a stripe
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		char*			-		Pointer to the string
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		StoredString*	-		Pointer to the stored string record, NULL if no storage was available
+		//
+		//  NOTES:
+		//
+		//		1.	Strings larger than a quarter of a segment are stored in a segment of their own
+		//		2.	Records are aligned in the segment, the length and the null terminated string are written
+		//			before the record is published and are never changed afterwards
+		//
+
+		const StoredString*	storeString(Stripe& Str, const char* String, size_t StringLen) {
+			char*			pStored = nullptr;												//  Stored record
+			size_t			RecLen = recordSize(StringLen);									//  Size of the record
+
+			//  Allocate a new segment if the current segment cannot hold the record
+			if (Str.USeg == 0 || RecLen > (Str.SegCap - Str.SegUsed)) {
+				size_t		NewSegSize = SegmentSize;
+				bool		Dedicated = RecLen > (SegmentSize / 4);
+
+				if (Dedicated) NewSegSize = RecLen;
+				if (Str.USeg == Str.NSeg) {
+					size_t		NewCap = (Str.NSeg == 0) ? 16 : Str.NSeg * 2;
+					char**		pNewSeg = (char**)realloc(Str.pSeg, NewCap * sizeof(char*));
+					if (pNewSeg == nullptr) return nullptr;
+					Str.pSeg = pNewSeg;
+					Str.NSeg = NewCap;
+				}
+				pStored = (char*)malloc(NewSegSize);
+				if (pStored == nullptr) return nullptr;
+
+				//  A dedicated segment is kept behind the current segment
+				if (Dedicated && Str.USeg > 0) {
+					Str.pSeg[Str.USeg] = Str.pSeg[Str.USeg - 1];
+					Str.pSeg[Str.USeg - 1] = pStored;
+					Str.USeg++;
+				}
+				else {
+					Str.pSeg[Str.USeg++] = pStored;
+					Str.SegUsed = Dedicated ? NewSegSize : 0;
+					Str.SegCap = NewSegSize;
+				}
+				if (!Dedicated) pStored = nullptr;
+			}
+
+			//  Carve the record from the current segment
+			if (pStored == nullptr) {
+				pStored = Str.pSeg[Str.USeg - 1] + Str.SegUsed;
+				Str.SegUsed += RecLen;
+			}
+
+			((StoredString*)pStored)->Len = StringLen;
+			if (StringLen > 0) memcpy(pStored + sizeof(StoredString), String, StringLen);
+			pStored[sizeof(StoredString) + StringLen] = '\0';
+			return (const StoredString*)pStored;
+		}
+
+		//  recordSize
+		//
+		//  Computes the segment space occupied by the record of a string
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Length of the string
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Size of the record (rounded up to keep the following record aligned)
+		//
+		//  NOTES:
+		//
+
+		static size_t	recordSize(size_t StringLen) {
+			return (sizeof(StoredString) + StringLen + 1 + (alignof(StoredString) - 1)) & ~(alignof(StoredString) - 1);
+		}
+
+		//  insertString
+		//
+		//  Stores a string and links it into the stripe index
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		STRREF			-		Reference to use, NULLSTRREF to issue a new reference
+		//		char*			-		Pointer to the string
+		//		size_t			-		Length of the string
+		//		size_t			-		Case-folded hash of the string
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the string, NULLSTRREF if the string could not be added
+		//
+		//  NOTES:
+		//
+
+		STRREF	insertString(Stripe& Str, STRREF Ref, const char* String, size_t StringLen, size_t Hash) {
+			const StoredString*		pStored = nullptr;										//  Stored string
+			RefEntry*				pEntry = nullptr;										//  Reference entry
+			bool					WasLive = false;										//  Reference held a string
+
+			//  Make sure that the index has capacity
+			if (!checkIndex(Str)) return NULLSTRREF;
+
+			//  Store the string
+			pStored = storeString(Str, String, StringLen);
+			if (pStored == nullptr) return NULLSTRREF;
+
+			//  Acquire the reference
+			if (Ref == NULLSTRREF) Ref = issueRef(Str);
+			pEntry = locateEntry(Ref);
+			if (pEntry == nullptr) return NULLSTRREF;
+			WasLive = pEntry->Str.load(std::memory_order_acquire) != nullptr;
+
+			//  Publish the string, the length is published with the string in the stored record
+			pEntry->Hash.store(Hash, std::memory_order_relaxed);
+			pEntry->Str.store(pStored, std::memory_order_release);
+			if (!WasLive) Strings.fetch_add(1);
+
+			//  Link the reference into the index
+			pEntry->Next = Str.pBkt[(Hash / NumStripes) & (Str.NBkt - 1)];
+			Str.pBkt[(Hash / NumStripes) & (Str.NBkt - 1)] = Ref;
+			Str.Count++;
+
+			return Ref;
+		}
+
+		//  unlinkIndex
+		//
+		//  Removes a reference from the index of a stripe
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		STRREF			-		Reference to be removed
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	unlinkIndex(Stripe& Str, STRREF Ref) {
+			RefEntry*		pEntry = locateEntry(Ref);										//  Reference entry
+			STRREF*			pLink = nullptr;												//  Link to the reference
+
+			if (pEntry == nullptr || Str.NBkt == 0) return;
+			pLink = &Str.pBkt[(pEntry->Hash.load(std::memory_order_relaxed) / NumStripes) & (Str.NBkt - 1)];
+			while (*pLink != NULLSTRREF) {
+				if (*pLink == Ref) {
+					*pLink = pEntry->Next;
+					Str.Count--;
+					return;
+				}
+				pLink = &locateEntry(*pLink)->Next;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  unlinkString
+		//
+		//  Removes a string from the index of a stripe and marks the reference as unused
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		STRREF			-		Reference to be removed
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	unlinkString(Stripe& Str, STRREF Ref) {
+			unlinkIndex(Str, Ref);
+			locateEntry(Ref)->Str.store(nullptr, std::memory_order_release);
+			Strings.fetch_sub(1);
+			return;
+		}
+
+		//  findString
+		//
+		//  Searches the index of a stripe for a string
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//		char*			-		Pointer to the string
+		//		size_t			-		Length of the string
+		//		size_t			-		Case-folded hash of the string
+		//		bool			-		true if the matching is case insensitive
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		Reference to the (lowest) matching string, NULLSTRREF if not found
+		//
+		//  NOTES:
+		//
+
+		STRREF	findString(Stripe& Str, const char* String, size_t StringLen, size_t Hash, bool CaseInsensitive) {
+			STRREF			Found = NULLSTRREF;												//  Matching reference
+			STRREF			Ref = NULLSTRREF;												//  Chain reference
+
+			if (Str.NBkt == 0) return NULLSTRREF;
+			Ref = Str.pBkt[(Hash / NumStripes) & (Str.NBkt - 1)];
+			while (Ref != NULLSTRREF) {
+				RefEntry*				pEntry = locateEntry(Ref);
+				const StoredString*		pStored = pEntry->Str.load(std::memory_order_relaxed);
+
+				if (pEntry->Hash.load(std::memory_order_relaxed) == Hash && pStored->Len == StringLen && (Found == NULLSTRREF || Ref < Found)) {
+					const char* pString = (const char*)(pStored + 1);
+					if (CaseInsensitive) {
+						if (_memicmp(pString, String, StringLen) == 0) Found = Ref;
+					}
+					else {
+						if (memcmp(pString, String, StringLen) == 0) Found = Ref;
+					}
+				}
+				Ref = pEntry->Next;
+			}
+
+			return Found;
+		}
+
+		//  checkIndex
+		//
+		//  Makes sure that the index of a stripe has capacity for an additional string
+		//
+		//  PARAMETERS:
+		//
+		//		Stripe&			-		Reference to the (locked) stripe
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the index has capacity, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The index is doubled (and rebuilt) when the stripe holds more strings than buckets
+		//
+
+		bool	checkIndex(Stripe& Str) {
+			size_t			NewBkt = 0;														//  New number of buckets
+			STRREF*			pNewBkt = nullptr;												//  New buckets
+
+			if (Str.NBkt > 0 && (Str.Count + 1) <= Str.NBkt) return true;
+
+			//  Allocate the new buckets
+			NewBkt = (Str.NBkt == 0) ? MinBuckets : Str.NBkt * 2;
+			pNewBkt = (STRREF*)malloc(NewBkt * sizeof(STRREF));
+			if (pNewBkt == nullptr) return Str.NBkt > 0;
+			memset(pNewBkt, 0, NewBkt * sizeof(STRREF));
+
+			//  Move each chain into the new buckets
+			for (size_t BX = 0; BX < Str.NBkt; BX++) {
+				STRREF		Ref = Str.pBkt[BX];
+				while (Ref != NULLSTRREF) {
+					RefEntry*	pEntry = locateEntry(Ref);
+					STRREF		NextRef = pEntry->Next;
+
+					pEntry->Next = pNewBkt[(pEntry->Hash.load(std::memory_order_relaxed) / NumStripes) & (NewBkt - 1)];
+					pNewBkt[(pEntry->Hash.load(std::memory_order_relaxed) / NumStripes) & (NewBkt - 1)] = Ref;
+					Ref = NextRef;
+				}
+			}
+
+			//  Replace the buckets
+			if (Str.pBkt != nullptr) free(Str.pBkt);
+			Str.pBkt = pNewBkt;
+			Str.NBkt = NewBkt;
+
+			//  Return showing success
+			return true;
+		}
+	};
+
+}
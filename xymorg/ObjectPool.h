@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       ObjectPool.h																						*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.0.0	(Build: 01)																					*
+//*   Version:    1.2.0	(Build: 03)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2023 Ian J. Tree																				*
@@ -17,13 +17,19 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		The pool grows geometrically (by default doubling), see setGrowthPolicy(). Capacity can be reserved		*
+//*			up front with reserve(). References freed by deleteObject() are reused before new ones are issued.		*
+//*	2.		deleteObject() does not move other objects, the (cleared) space is recorded in size ordered free		*
+//*			extent bins and reused (best fit) by later additions. The pool is compacted in a single pass when the	*
+//*			free space passes the compaction threshold (see setCompactionThreshold()).								*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
 //*   History:																										*
 //*																													*
 //*	1.0.0 -		02/12/2017	-	Initial Release																		*
+//*	1.1.0 -		19/10/2026	-	Geometric growth policy, reserve() and free reference reuse							*
+//*	1.2.0 -		19/10/2026	-	Non-compacting delete with best fit reuse and threshold compaction					*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -57,6 +63,11 @@ namespace xymorg {
 		static const int DefaultNumObjects = 100;													//  Default number of objects
 		static const int DefaultPoolSize = 4096;													//  Default string pool size
 		static const OBJREF EmptySlot = 0xFFFFFFFF;													//  Empty slot value in the SRT
+		static const size_t DefaultGrowthPct = 100;													//  Default growth (percent of capacity)
+		static const size_t	DefaultCompactPct = 25;													//  Default compaction threshold (percent of used space)
+		static const size_t	ExactFreeBins = 64;														//  Number of exact size free extent bins
+		static const size_t	NumFreeBins = 128;														//  Number of free extent bins
+		static const size_t	NoExtent = SIZE_MAX;													//  Null free extent index
 
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
@@ -69,6 +80,12 @@ namespace xymorg {
 			size_t		OLen;																		//  Length of the object
 		} SORef;
 
+		typedef struct FreeExtent {
+			size_t		Off;																		//  Offset of the extent in the pool
+			size_t		Len;																		//  Length of the extent
+			size_t		Next;																		//  Next extent in the bin (or unused)
+		} FreeExtent;
+
 	public:
 
 		//*******************************************************************************************************************
@@ -88,7 +105,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		ObjectPool() : ORT(nullptr), OP(nullptr) {
+		ObjectPool() : ORT(nullptr), OP(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumObjects), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct) {
 
 			//  Initialise the pool for the default capacity
 			if (!initialisePool(DefaultNumObjects, DefaultPoolSize)) {
@@ -114,7 +131,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		ObjectPool(size_t RNS, size_t RSPS) : ORT(nullptr), OP(nullptr) {
+		ObjectPool(size_t RNS, size_t RSPS) : ORT(nullptr), OP(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumObjects), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct) {
 
 			//  Safety checks on capacities
 			if (RNS == 0) RNS = DefaultNumObjects;
@@ -143,7 +160,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		ObjectPool(ObjectPool& Src) : ORT(nullptr), OP(nullptr) {
+		ObjectPool(ObjectPool& Src) : ORT(nullptr), OP(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumObjects), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct) {
 
 			//  Initialise the pool using the capacity from the source
 			if (!initialisePool(Src.ORTCap, Src.OPCap)) {
@@ -171,6 +188,27 @@ namespace xymorg {
 			OPCap = Src.OPCap;
 			OPUsed = Src.OPUsed;
 
+			//  Copy the free references and the growth policy from the source
+			if (FRS != nullptr) memcpy(FRS, Src.FRS, Src.FRSEnts * sizeof(OBJREF));
+			FRSEnts = Src.FRSEnts;
+			GrowthPct = Src.GrowthPct;
+			RefIncrement = Src.RefIncrement;
+			PoolIncrement = Src.PoolIncrement;
+			CompactPct = Src.CompactPct;
+
+			//  Copy the free extents from the source
+			LiveBytes = Src.LiveBytes;
+			if (Src.FEXEnts > 0) {
+				FEX = (FreeExtent*)malloc(Src.FEXEnts * sizeof(FreeExtent));
+				if (FEX != nullptr) {
+					memcpy(FEX, Src.FEX, Src.FEXEnts * sizeof(FreeExtent));
+					FEXCap = FEXEnts = Src.FEXEnts;
+					FEXFree = Src.FEXFree;
+					memcpy(FEB, Src.FEB, sizeof(FEB));
+					memcpy(FEBMap, Src.FEBMap, sizeof(FEBMap));
+				}
+			}
+
 			//  Return to caller
 			return;
 		}
@@ -188,7 +226,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		ObjectPool(ObjectPool&& Src) noexcept : ORT(nullptr), OP(nullptr) {
+		ObjectPool(ObjectPool&& Src) noexcept : ORT(nullptr), OP(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumObjects), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct) {
 
 			//  Unbutton the source pool
 			Src.unbuttonPool();
@@ -203,6 +241,22 @@ namespace xymorg {
 			OPCap = Src.OPCap;
 			OPUsed = Src.OPUsed;
 
+			FRS = Src.FRS;
+			FRSEnts = Src.FRSEnts;
+
+			GrowthPct = Src.GrowthPct;
+			RefIncrement = Src.RefIncrement;
+			PoolIncrement = Src.PoolIncrement;
+
+			FEX = Src.FEX;
+			FEXCap = Src.FEXCap;
+			FEXEnts = Src.FEXEnts;
+			FEXFree = Src.FEXFree;
+			memcpy(FEB, Src.FEB, sizeof(FEB));
+			memcpy(FEBMap, Src.FEBMap, sizeof(FEBMap));
+			LiveBytes = Src.LiveBytes;
+			CompactPct = Src.CompactPct;
+
 			//  button this pool
 			buttonPool();
 
@@ -216,6 +270,14 @@ namespace xymorg {
 			Src.OPCap = 0;
 			Src.OPUsed = 0;
 
+			Src.FRS = nullptr;
+			Src.FRSEnts = 0;
+
+			Src.FEX = nullptr;
+			Src.FEXCap = 0;
+			Src.resetExtents();
+			Src.LiveBytes = 0;
+
 			//  Return to caller
 			return;
 		}
@@ -293,7 +355,7 @@ namespace xymorg {
 				//
 				//  Set the offset of the new object in the reference table
 				//
-				ORT[NewRef - 1].OOff = OPUsed;
+				ORT[NewRef - 1].OOff = allocateSpace(NewObjLen);
 				ORT[NewRef - 1].OLen = NewObjLen;
 
 				//
@@ -301,8 +363,7 @@ namespace xymorg {
 				//
 				if (pNewObject != nullptr && NewObjLen > 0) {
 					unbuttonPool();
-					memcpy(OP + OPUsed, pNewObject, NewObjLen);
-					OPUsed += NewObjLen;
+					memcpy(OP + ORT[NewRef - 1].OOff, pNewObject, NewObjLen);
 					buttonPool();
 				}
 
@@ -417,37 +478,22 @@ namespace xymorg {
 
 			//  Any invalid reference returns with no further action
 			if (Ref == NULLOBJREF) return;
-			if (Ref > ORTHiWater + 1) return;
+			if (Ref > ORTHiWater) return;
 			if (ORT[Ref - 1].OOff == EmptySlot) return;
 
-			//
-			//  Compute the length to be excised from the pool
-			//
-			size_t		SnipLen = ORT[Ref - 1].OLen;
-
-			//  Remove the Object from the pool
-			unbuttonPool();
-			if (((OPUsed - ORT[Ref - 1].OOff) - SnipLen) > 0) memmove(OP + ORT[Ref - 1].OOff, OP + ORT[Ref - 1].OOff + SnipLen, (OPUsed - ORT[Ref - 1].OOff) - SnipLen);
-
-			//  Clear the residual space at the end of the pool
-			memset((OP + OPUsed) - SnipLen, 0, SnipLen);
-			buttonPool();
-
-			//  Update the pool information
-			OPUsed = OPUsed - SnipLen;
-
-			//
-			//  Update all object references in the table that lie above the current reference offset
-			//
-			for (size_t ORX = 0; ORX < ORTHiWater; ORX++) {
-				if (ORT[ORX].OOff != EmptySlot && ORT[ORX].OOff > ORT[Ref - 1].OOff) ORT[ORX].OOff = ORT[ORX].OOff - SnipLen;
-			}
+			//  Release (and clear) the space occupied by the object
+			releaseSpace(ORT[Ref - 1].OOff, ORT[Ref - 1].OLen);
 
 			//  Remove the object reference from the table
 			ORT[Ref - 1].OOff = EmptySlot;
 			ORT[Ref - 1].OLen = EmptySlot;
 			ORTEnts--;
-			if (Ref == (ORTHiWater + 1)) ORTHiWater--;
+
+			//  Make the reference available for reuse
+			FRS[FRSEnts++] = Ref;
+
+			//  Compact the pool if the free space has passed the threshold
+			if (isFragmented()) compactPool();
 
 			//  Return to caller
 			return;
@@ -494,10 +540,13 @@ namespace xymorg {
 			//  Check (and adjust if necessary) the capacity of the pool
 			if (!checkCapacity(NewObjLen)) return NULLOBJREF;
 
+			//  Reclaim the freed reference
+			claimFreeObjectRef(Ref);
+
 			//
 			//  Set the offset of the new object in the reference table
 			//
-			ORT[Ref - 1].OOff = OPUsed;
+			ORT[Ref - 1].OOff = allocateSpace(NewObjLen);
 			ORT[Ref - 1].OLen = NewObjLen;
 			ORTEnts++;
 
@@ -506,15 +555,108 @@ namespace xymorg {
 			//
 			if (pNewObject != nullptr && NewObjLen > 0) {
 				unbuttonPool();
-				memcpy(OP + OPUsed, pNewObject, NewObjLen);
+				memcpy(OP + ORT[Ref - 1].OOff, pNewObject, NewObjLen);
 				buttonPool();
-				OPUsed += NewObjLen;
 			}
 
 			//  Return the reference
 			return Ref;
 		}
 
+		//  reserve
+		//
+		//  Ensures that the pool has (at least) the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Capacity of the pool (number of objects)
+		//		size_t			-		Capacity of the pool (object storage space)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool has the requested capacity, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The capacity of the pool is never reduced
+		//
+
+		bool		reserve(size_t RNS, size_t RSPS) {
+
+			//  An uninitialised pool is initialised with the requested capacity
+			if (ORTCap == 0 || OPCap == 0) {
+				if (RNS < RefIncrement) RNS = RefIncrement;
+				if (RSPS < PoolIncrement) RSPS = PoolIncrement;
+				return initialisePool(RNS, RSPS);
+			}
+
+			//  Expand the reference table and the pool
+			if (!resizeTables(RNS)) return false;
+			return resizePool(RSPS);
+		}
+
+		//  setGrowthPolicy
+		//
+		//  Sets the policy used to grow the pool when it runs out of capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Growth as a percentage of the current capacity (0 for fixed increments)
+		//		size_t			-		Minimum growth of the reference table (number of objects)
+		//		size_t			-		Minimum growth of the pool (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The default policy doubles the capacity (100%) with minimum increments of 100 objects and 4 Kb
+		//
+
+		void		setGrowthPolicy(size_t NewGrowthPct, size_t NewRefIncrement, size_t NewPoolIncrement) {
+			GrowthPct = NewGrowthPct;
+			RefIncrement = (NewRefIncrement == 0) ? 1 : NewRefIncrement;
+			PoolIncrement = (NewPoolIncrement == 0) ? 1 : NewPoolIncrement;
+			return;
+		}
+
+		//  compact
+		//
+		//  Compacts the pool, removing all of the free space between objects
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool is compact, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool		compact() {
+			if (LiveBytes == OPUsed) return true;
+			return compactPool();
+		}
+
+		//  setCompactionThreshold
+		//
+		//  Sets the proportion of free space inside the pool at which the pool is compacted
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Compaction threshold (percent of the used space)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The default threshold is 25%, the pool is never compacted for less than the minimum growth increment
+		//
+
+		void		setCompactionThreshold(size_t NewCompactPct) {
+			CompactPct = NewCompactPct;
+			return;
+		}
+
 		//  dismiss
 		//
 		//  Empties the string pool and releases the underlying storage
@@ -563,6 +705,25 @@ namespace xymorg {
 		//*                                                                                                                 *
 		//*******************************************************************************************************************
 
+		//  Free Reference Stack
+		OBJREF*			FRS;																//  References freed for reuse
+		size_t			FRSEnts;															//  Number of freed references
+
+		//  Growth Policy
+		size_t			GrowthPct;															//  Growth (percent of current capacity)
+		size_t			RefIncrement;														//  Minimum reference table growth (objects)
+		size_t			PoolIncrement;														//  Minimum pool growth (bytes)
+
+		//  Free Extents
+		FreeExtent*		FEX;																//  Free extent table
+		size_t			FEXCap;																//  Free extent table capacity
+		size_t			FEXEnts;															//  Number of free extent table entries used
+		size_t			FEXFree;															//  First unused free extent table entry
+		size_t			FEB[NumFreeBins];													//  Free extent bins (size order)
+		uint64_t		FEBMap[NumFreeBins / 64];											//  Map of non-empty free extent bins
+		size_t			LiveBytes;															//  Bytes occupied by objects
+		size_t			CompactPct;															//  Compaction threshold (percent of used space)
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions																								*
@@ -592,6 +753,14 @@ namespace xymorg {
 			OP = nullptr;
 			OPCap = 0;
 			OPUsed = 0;
+			if (FRS != nullptr) free(FRS);
+			FRS = nullptr;
+			FRSEnts = 0;
+			if (FEX != nullptr) free(FEX);
+			FEX = nullptr;
+			FEXCap = 0;
+			resetExtents();
+			LiveBytes = 0;
 
 			//  Return to caller
 			return;
@@ -629,6 +798,13 @@ namespace xymorg {
 			ORTEnts = 0;
 			memset(ORT, 0xFF, RNS * sizeof(SORef));
 
+			//
+			//  Allocate the free reference stack
+			//
+
+			FRS = (OBJREF*)malloc(RNS * sizeof(OBJREF));
+			if (FRS == nullptr) return false;
+
 			//
 			//  Allocate and initialise the Object Pool (OP)
 			//
@@ -657,6 +833,8 @@ namespace xymorg {
 		//
 		//  NOTES:
 		//
+		//		1.	Capacity is grown according to the growth policy, see setGrowthPolicy()
+		//
 
 		bool	checkCapacity(size_t NewObjLen) {
 
@@ -665,8 +843,8 @@ namespace xymorg {
 			//
 
 			if (ORTCap == 0 || OPCap == 0) {
-				if (NewObjLen < 4096) NewObjLen = 4096;
-				return initialisePool(100, 2 * NewObjLen);
+				if (NewObjLen < PoolIncrement) NewObjLen = PoolIncrement;
+				return initialisePool(RefIncrement, 2 * NewObjLen);
 			}
 
 			//
@@ -674,66 +852,515 @@ namespace xymorg {
 			//
 
 			if (ORTEnts == ORTCap) {
-				//  Expand the ORT Pool
-				SORef* NewORT = (SORef*)realloc(ORT, (ORTCap + 100) * sizeof(SORef));
-				if (NewORT == nullptr) {
-					free(ORT);
-					ORT = nullptr;
-					return false;
-				}
-				else ORT = NewORT;
-				memset(ORT + ORTCap, 0xFF, 100 * sizeof(SORef));
-				ORTCap += 100;
+				if (!resizeTables(growCapacity(ORTCap, ORTCap + 1, RefIncrement))) return false;
 			}
 
 			//
 			//  3. The Object Pool must have the capacity for the object
 			//
 
-			while (NewObjLen >= (OPCap - OPUsed)) {
-				//  Expand the Object Pool (OP)
-				BYTE* NewOP = (BYTE*)realloc(OP, OPCap + 4096);
-				if (NewOP == nullptr) {
-					free(OP);
-					OP = nullptr;
-					free(ORT);
-					ORT = nullptr;
-					return false;
+			if (NewObjLen >= (OPCap - OPUsed)) {
+				if (isFragmented()) compactPool();
+				if (NewObjLen >= (OPCap - OPUsed)) {
+					if (!resizePool(growCapacity(OPCap, OPUsed + NewObjLen + 1, PoolIncrement))) return false;
 				}
-				else OP = NewOP;
-				memset(OP + OPCap, 0, 4096);
-				OPCap += 4096;
 			}
 
 			//  Return to caller
 			return true;
 		}
 
+		//  growCapacity 
+		//
+		//  Computes the new capacity for a table or pool according to the growth policy
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Current capacity
+		//		size_t			-		Minimum capacity required
+		//		size_t			-		Minimum increment
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The new capacity
+		//
+		//  NOTES:
+		//
+
+		size_t	growCapacity(size_t Cap, size_t Required, size_t MinIncrement) {
+			size_t		NewCap = Cap + ((Cap * GrowthPct) / 100);								//  New capacity
+
+			if (NewCap < (Cap + MinIncrement)) NewCap = Cap + MinIncrement;
+			if (NewCap < Required) NewCap = Required;
+			return NewCap;
+		}
+
+		//  resizeTables 
+		//
+		//  Expands the Object Reference Table (and the free reference stack) to the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		New capacity (number of objects)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the tables were expanded, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	On failure the pool is left unchanged at the previous capacity
+		//
+
+		bool	resizeTables(size_t NewCap) {
+
+			//  Safety
+			if (NewCap <= ORTCap) return true;
+
+			//  Expand the ORT
+			SORef* NewORT = (SORef*)realloc(ORT, NewCap * sizeof(SORef));
+			if (NewORT == nullptr) return false;
+			ORT = NewORT;
+			memset(ORT + ORTCap, 0xFF, (NewCap - ORTCap) * sizeof(SORef));
+
+			//  Expand the free reference stack to match
+			OBJREF* NewFRS = (OBJREF*)realloc(FRS, NewCap * sizeof(OBJREF));
+			if (NewFRS == nullptr) return false;
+			FRS = NewFRS;
+
+			//  Update the capacity
+			ORTCap = NewCap;
+
+			//  Return showing success
+			return true;
+		}
+
+		//  resizePool 
+		//
+		//  Expands the Object Pool (OP) to the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		New capacity (bytes)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool was expanded, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	On failure the pool is left unchanged at the previous capacity
+		//		2.	The expansion is not cleared, only the used portion of the pool is significant
+		//
+
+		bool	resizePool(size_t NewCap) {
+
+			//  Safety
+			if (NewCap <= OPCap) return true;
+
+			BYTE* NewOP = (BYTE*)realloc(OP, NewCap);
+			if (NewOP == nullptr) return false;
+			OP = NewOP;
+			OPCap = NewCap;
+
+			//  Return showing success
+			return true;
+		}
+
 		//  locateFreeObjectRef 
 		//
-		//  Locates the first available object reference to use
+		//  Locates the next available object reference to use
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		OBJREF			-		The available object reference for a new object
+		//
+		//  NOTES:
+		//
+		//		1.	References freed by deleteObject() are reused (most recent first) before new references are issued
+		//
+
+		OBJREF	locateFreeObjectRef() {
+
+			//  Reuse a freed reference if one is available
+			if (FRSEnts > 0) return FRS[--FRSEnts];
+
+			//  Otherwise return the next at the hi water mark
+			if (ORTHiWater < ORTCap) return OBJREF(ORTHiWater + 1);
+
+			//  SNO - no available slot was located
+			return NULLOBJREF;
+		}
+
+		//  claimFreeObjectRef 
+		//
+		//  Removes a specific reference from the free reference stack
+		//
+		//  PARAMETERS:
+		//
+		//		OBJREF			-		The reference being reused
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	A reference that has just been freed is at the top of the stack
+		//
+
+		void	claimFreeObjectRef(OBJREF Ref) {
+
+			for (size_t FRX = FRSEnts; FRX > 0; FRX--) {
+				if (FRS[FRX - 1] == Ref) {
+					if (FRX < FRSEnts) memmove(FRS + (FRX - 1), FRS + FRX, (FRSEnts - FRX) * sizeof(OBJREF));
+					FRSEnts--;
+					return;
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  allocateSpace 
+		//
+		//  Allocates space in the pool, reusing the best fitting free extent if there is one
 		//
 		//  PARAMETERS:
 		//
+		//		size_t			-		Size of the space required (bytes)
+		//
 		//  RETURNS:
 		//
-		//		STRREF			-		The first available string reference for a new string
+		//		size_t			-		Offset of the allocated space in the pool
 		//
 		//  NOTES:
 		//
+		//		1.	checkCapacity() MUST have been called for the space required
+		//
+
+		size_t	allocateSpace(size_t Len) {
+			size_t		Off = OPUsed;														//  Offset of the space
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Safety
+			if (Len == 0) return Off;
+			LiveBytes += Len;
 
-		STRREF	locateFreeObjectRef() {
+			//  Reuse a free extent if one is available
+			FX = takeExtent(Len);
+			if (FX != NoExtent) {
+				Off = FEX[FX].Off;
+				if (FEX[FX].Len > Len) {
+					//  Return the residue of the extent as a (smaller) free extent
+					FEX[FX].Off += Len;
+					FEX[FX].Len -= Len;
+					binExtent(FX);
+				}
+				else dropExtent(FX);
+				return Off;
+			}
 
-			//  If there are no unused references in the table then return the next at the hi water mark
-			if (ORTEnts == ORTHiWater) return ORTHiWater + 1;
+			//  Allocate from the unused space at the end of the pool
+			OPUsed += Len;
+			return Off;
+		}
+
+		//  releaseSpace 
+		//
+		//  Releases space in the pool for reuse
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Offset of the space in the pool
+		//		size_t			-		Size of the space (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	Adjacent free extents are not coalesced, the space is recovered when the pool is compacted
+		//
+
+		void	releaseSpace(size_t Off, size_t Len) {
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Safety
+			if (Len == 0) return;
+			LiveBytes -= Len;
+
+			//  Clear the content of the released space
+			unbuttonPool();
+			memset(OP + Off, 0, Len);
+			buttonPool();
+
+			//  Space at the end of the pool is returned to the unused space
+			if (Off + Len == OPUsed) {
+				OPUsed = Off;
+				return;
+			}
+
+			//  Acquire an extent (space that cannot be recorded is recovered by compaction)
+			if (FEXFree != NoExtent) {
+				FX = FEXFree;
+				FEXFree = FEX[FX].Next;
+			}
+			else {
+				if (FEXEnts == FEXCap) {
+					size_t		NewCap = (FEXCap == 0) ? 64 : FEXCap * 2;
+					FreeExtent* NewFEX = (FreeExtent*)realloc(FEX, NewCap * sizeof(FreeExtent));
+					if (NewFEX == nullptr) return;
+					FEX = NewFEX;
+					FEXCap = NewCap;
+				}
+				FX = FEXEnts++;
+			}
+
+			//  Record the free extent in the bin for its size
+			FEX[FX].Off = Off;
+			FEX[FX].Len = Len;
+			binExtent(FX);
+
+			//  Return to caller
+			return;
+		}
+
+		//  binOf 
+		//
+		//  Returns the free extent bin for an extent size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the extent (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The bin index
+		//
+		//  NOTES:
+		//
+		//		1.	Bins 0 - 63 hold extents of exactly 1 - 64 bytes, the remaining bins each hold a power of 2 range
+		//
+
+		static size_t	binOf(size_t Len) {
+			size_t		Bin = ExactFreeBins;												//  Bin index
+			size_t		Limit = ExactFreeBins * 2;											//  Upper limit of the bin
+
+			if (Len <= ExactFreeBins) return Len - 1;
+			while (Len > Limit && Bin < (NumFreeBins - 1)) {
+				Bin++;
+				Limit = Limit * 2;
+			}
+			return Bin;
+		}
+
+		//  binExtent 
+		//
+		//  Adds a free extent to the bin for its size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Index of the free extent
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	binExtent(size_t FX) {
+			size_t		Bin = binOf(FEX[FX].Len);											//  Bin index
+
+			FEX[FX].Next = FEB[Bin];
+			FEB[Bin] = FX;
+			FEBMap[Bin / 64] |= (uint64_t(1) << (Bin % 64));
+			return;
+		}
+
+		//  dropExtent 
+		//
+		//  Returns a (no longer binned) free extent to the unused extents
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Index of the free extent
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
 
-			//  Search the Object Reference Table for the first unused entry
+		void	dropExtent(size_t FX) {
+			FEX[FX].Next = FEXFree;
+			FEXFree = FX;
+			return;
+		}
+
+		//  takeExtent 
+		//
+		//  Removes and returns the best fitting free extent for the requested space
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the space required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the free extent, NoExtent if there is no extent large enough
+		//
+		//  NOTES:
+		//
+		//		1.	The smallest fitting extent in the bin for the size is taken, failing that the smallest extent
+		//			in the next larger non-empty bin.
+		//
+
+		size_t	takeExtent(size_t Len) {
+			size_t		Bin = binOf(Len);													//  Bin index
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Search the bin for the size for the best fit (exact bins always fit)
+			FX = takeFromBin(Bin, Len);
+			if (FX != NoExtent) return FX;
+
+			//  Take from the next larger non-empty bin
+			for (Bin = Bin + 1; Bin < NumFreeBins; Bin++) {
+				uint64_t	Map = FEBMap[Bin / 64] >> (Bin % 64);								//  Bins that hold extents
+				if (Map == 0) {
+					Bin = ((Bin / 64) * 64) + 63;
+					continue;
+				}
+				while ((Map & 1) == 0) {
+					Map = Map >> 1;
+					Bin++;
+				}
+				return takeFromBin(Bin, Len);
+			}
+
+			//  No extent is large enough
+			return NoExtent;
+		}
+
+		//  takeFromBin 
+		//
+		//  Removes and returns the smallest extent in a bin that will hold the requested space
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Bin index
+		//		size_t			-		Size of the space required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the free extent, NoExtent if there is no extent large enough
+		//
+		//  NOTES:
+		//
+
+		size_t	takeFromBin(size_t Bin, size_t Len) {
+			size_t*		pLink = &FEB[Bin];													//  Link to the current extent
+			size_t*		pBest = nullptr;													//  Link to the best extent
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Locate the smallest extent that fits
+			while (*pLink != NoExtent) {
+				if (FEX[*pLink].Len >= Len && (pBest == nullptr || FEX[*pLink].Len < FEX[*pBest].Len)) {
+					pBest = pLink;
+					if (FEX[*pLink].Len == Len) break;
+				}
+				pLink = &FEX[*pLink].Next;
+			}
+			if (pBest == nullptr) return NoExtent;
+
+			//  Unlink the extent from the bin
+			FX = *pBest;
+			*pBest = FEX[FX].Next;
+			if (FEB[Bin] == NoExtent) FEBMap[Bin / 64] &= ~(uint64_t(1) << (Bin % 64));
+			return FX;
+		}
+
+		//  resetExtents 
+		//
+		//  Discards all free extents
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	resetExtents() {
+			for (size_t Bin = 0; Bin < NumFreeBins; Bin++) FEB[Bin] = NoExtent;
+			FEBMap[0] = FEBMap[1] = 0;
+			FEXEnts = 0;
+			FEXFree = NoExtent;
+			return;
+		}
+
+		//  isFragmented 
+		//
+		//  Determines if the free space inside the pool has passed the compaction threshold
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool should be compacted, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	isFragmented() {
+			size_t		Waste = OPUsed - LiveBytes;											//  Space not holding objects
+
+			if (Waste < PoolIncrement) return false;
+			return (Waste * 100) > (OPUsed * CompactPct);
+		}
+
+		//  compactPool 
+		//
+		//  Compacts the content of the pool in a single pass, discarding all free extents
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool was compacted, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	compactPool() {
+			BYTE*		NewOP = nullptr;													//  Compacted pool
+			size_t		NewUsed = 0;														//  Used space in the compacted pool
+
+			//  Allocate the compacted pool
+			NewOP = (BYTE*)malloc(OPCap);
+			if (NewOP == nullptr) return false;
+
+			//  Copy each object into the compacted pool
+			unbuttonPool();
 			for (size_t ORX = 0; ORX < ORTHiWater; ORX++) {
-				if (ORT[ORX].OOff == EmptySlot) return ORX + 1;
+				if (ORT[ORX].OOff != EmptySlot) {
+					if (ORT[ORX].OLen > 0) memcpy(NewOP + NewUsed, OP + ORT[ORX].OOff, ORT[ORX].OLen);
+					ORT[ORX].OOff = NewUsed;
+					NewUsed += ORT[ORX].OLen;
+				}
 			}
 
-			//  SNO - no available slot was located
-			return NULLSTRREF;
+			//  Replace the pool
+			memset(OP, 0, OPCap);
+			free(OP);
+			OP = NewOP;
+			OPUsed = NewUsed;
+			LiveBytes = NewUsed;
+			buttonPool();
+
+			//  Discard the free extents
+			resetExtents();
+
+			//  Return showing success
+			return true;
 		}
 
 		//  buttonPool
@@ -115,6 +115,29 @@ namespace xymorg {
 			//  Return to caller
 			return;
 		}
+
+		//  Constructor 
+		//
+		//  Constructs a new sharded Synchronous Read Only Cache (base) with the given attributes
+		//
+		//  PARAMETERS:
+		//
+		//		SWITCHES			-		Cache configuration options
+		//		size_t				-		Budget size (Kb)
+		//		size_t				-		Number of shards
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	Extending classes MUST invoke one of these constructors
+		//
+
+		ROCache(SWITCHES NewCfg, size_t NewBudget, size_t NewShards) : Cache(NewCfg, NewBudget, NewShards) {
+
+			//  Return to caller
+			return;
+		}
 #endif
 
 		//*******************************************************************************************************************
@@ -0,0 +1,656 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       SlabArena.h																						*
+//*   Suite:      xymorg Integration																				*
+//*   Version:    1.1.0	(Build: 02)																					*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the SlabArena class. The class provides size-class slab			*
+//* allocation for collections of short lived blocks (e.g. cached records) so that churn does not fragment the		*
+//* heap and the memory used by the collection is predictable.														*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		Blocks are obtained with allocate(Size) and MUST be returned with release(Block, Size) passing the same		*
+//*		size that was used to allocate the block.																	*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.		Block sizes are rounded up to a power of two size class between MinBlockSize and MaxBlockSize.			*
+//*			Each size class carves its blocks from slabs on demand (bump pointer) and keeps released blocks on a	*
+//*			free list per slab, so only the pages of a slab that have been carved are committed.					*
+//*	2.		Blocks larger than MaxBlockSize are allocated directly from the heap.									*
+//*	3.		A slab is returned to the platform as soon as its last block is released, the only slab of a size		*
+//*			class is kept (with its pages discarded) where the platform supports MADV_DONTNEED.						*
+//*	4.		The footprint (getFootprint()) is the memory committed by carved slab pages plus large blocks, with		*
+//*			huge pages a slab is committed whole when it is first carved.											*
+//*	5.		The arena may (optionally) be backed by huge pages, on platforms that do not support huge pages the		*
+//*			option is ignored.																						*
+//*	6.		Each size class has its own lock, the arena may be shared between threads.								*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		19/10/2026	-	Initial Release																		*
+//*	1.1.0 -		19/10/2026	-	Lazy carving, empty slab release and committed footprint accounting					*
+//*																													*
+//*******************************************************************************************************************/
+
+//
+//  Include core xymorg headers
+//
+
+#include	"LPBHdrs.h"																		//  Language and Platform base headers
+#include	"types.h"																		//  xymorg type definitions
+#include	"consts.h"																		//  xymorg constant definitions
+
+//  Additional Language Headers
+#include	<mutex>																			//  Size class locks
+#include	<atomic>																		//  Large block accounting
+
+//  Platform Headers
+#if  (!defined(_WIN32) && !defined(_WIN64))
+#include	<sys/mman.h>																	//  Memory mapping (huge pages)
+#endif
+
+//
+//  All components are defined within the xymorg namespace
+//
+namespace xymorg {
+
+	//
+	//  SlabArena Class Definition
+	//
+
+	class SlabArena {
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Constants		                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		static const size_t		MinBlockSize = 64;													//  Smallest size class (bytes)
+		static const size_t		MaxBlockSize = 65536;												//  Largest size class (bytes)
+		static const size_t		SlabSize = 2 * 1024 * 1024;											//  Slab size (bytes, one huge page)
+
+	private:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Constants		                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		static const int		MinClassShift = 6;													//  Shift for the smallest size class
+		static const int		NumClasses = 11;													//  Number of size classes (64 bytes to 64 Kb)
+		static const size_t		PageSize = 4096;													//  Commit granularity of a (normal) slab
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Structures	                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Free block (overlays the content of a released block)
+		typedef struct FreeBlock {
+			FreeBlock*	pNext;																		//  Next free block
+		} FreeBlock;
+
+		//  Slab
+		typedef struct Slab {
+			BYTE*		pBase;																		//  Slab memory
+			FreeBlock*	pFree;																		//  Released blocks in the slab
+			size_t		Carved;																		//  Bytes carved from the slab (bump pointer)
+			size_t		Committed;																	//  Bytes of the slab counted in the footprint
+			size_t		InUse;																		//  Number of blocks in use
+		} Slab;
+
+		//  Size class
+		typedef struct SizeClass {
+			std::mutex	Lock;																		//  Size class lock
+			Slab*		pSlabs;																		//  Slabs owned by the size class (address order)
+			size_t		NSlabs;																		//  Number of slab slots
+			size_t		USlabs;																		//  Number of slab slots used
+			size_t		Avail;																		//  All slabs below this index are full
+			size_t		InUse;																		//  Number of blocks in use
+		} SizeClass;
+
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Constructors			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Constructor
+		//
+		//  Constructs a new (empty) SlabArena
+		//
+		//  PARAMETERS:
+		//
+		//		bool			-		true if the slabs should be backed by huge pages
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		explicit SlabArena(bool UseHugePages) : HugePages(UseHugePages), SlabBytes(0), LargeBytes(0), LargeInUse(0) {
+
+			//  Initialise the size classes
+			for (int SCX = 0; SCX < NumClasses; SCX++) {
+				Classes[SCX].pSlabs = nullptr;
+				Classes[SCX].NSlabs = 0;
+				Classes[SCX].USlabs = 0;
+				Classes[SCX].Avail = 0;
+				Classes[SCX].InUse = 0;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  Arenas are not copyable nor moveable
+		SlabArena(const SlabArena& Src) = delete;
+		SlabArena(SlabArena&& Src) = delete;
+		SlabArena& operator = (const SlabArena& rhs) = delete;
+		SlabArena& operator = (SlabArena&& rhs) = delete;
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Destructor			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Destructor
+		//
+		//  Destroys the SlabArena releasing all slabs
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		~SlabArena() {
+
+			//  Release all slabs
+			dismiss();
+
+			//  Return to caller
+			return;
+		}
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  allocate
+		//
+		//  Allocates a block of (at least) the requested size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the block required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the allocated block, NULL if the allocation failed
+		//
+		//  NOTES:
+		//
+
+		BYTE*	allocate(size_t Size) {
+			int				SCX = classOf(Size);													//  Size class index
+			size_t			BlockSize = 0;															//  Block size for the class
+			size_t			SLX = 0;																//  Slab index
+			BYTE*			pBlock = nullptr;														//  Allocated block
+
+			//  Large blocks are allocated directly from the heap
+			if (SCX < 0) {
+				BYTE* pLarge = (BYTE*) malloc(Size);
+				if (pLarge == nullptr) return nullptr;
+				LargeBytes.fetch_add(Size);
+				LargeInUse.fetch_add(1);
+				return pLarge;
+			}
+
+			SizeClass&		SC = Classes[SCX];
+			std::lock_guard<std::mutex>		SCGuard(SC.Lock);
+			BlockSize = MinBlockSize << SCX;
+
+			//  Find the lowest slab with a free block or uncarved space, adding a new slab if all are full
+			for (SLX = SC.Avail; SLX < SC.USlabs; SLX++) {
+				if (SC.pSlabs[SLX].pFree != nullptr || (SC.pSlabs[SLX].Carved + BlockSize) <= SlabSize) break;
+			}
+			if (SLX == SC.USlabs) {
+				SLX = addSlab(SC);
+				if (SLX == SC.USlabs) return nullptr;
+			}
+			SC.Avail = SLX;
+			Slab&			S = SC.pSlabs[SLX];
+
+			//  Re-use a released block, otherwise carve the next block from the slab
+			if (S.pFree != nullptr) {
+				pBlock = (BYTE*) S.pFree;
+				S.pFree = S.pFree->pNext;
+			}
+			else {
+				pBlock = S.pBase + S.Carved;
+				S.Carved += BlockSize;
+				commitTo(S, S.Carved);
+			}
+			S.InUse++;
+			SC.InUse++;
+
+			//  Return the block
+			return pBlock;
+		}
+
+		//  release
+		//
+		//  Releases a block back to the arena
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*			-		Pointer to the block being released
+		//		size_t			-		Size that the block was allocated with (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	release(BYTE* Block, size_t Size) {
+			int				SCX = classOf(Size);													//  Size class index
+			size_t			SLX = 0;																//  Slab index
+
+			//  Safety
+			if (Block == nullptr) return;
+
+			//  Large blocks are returned directly to the heap
+			if (SCX < 0) {
+				free(Block);
+				LargeBytes.fetch_sub(Size);
+				LargeInUse.fetch_sub(1);
+				return;
+			}
+
+			SizeClass&		SC = Classes[SCX];
+			std::lock_guard<std::mutex>		SCGuard(SC.Lock);
+
+			//  Locate the slab that holds the block
+			SLX = findSlab(SC, Block);
+			if (SLX == SC.USlabs) return;
+			Slab&			S = SC.pSlabs[SLX];
+
+			//  Push the block onto the free list of the slab
+			((FreeBlock*) Block)->pNext = S.pFree;
+			S.pFree = (FreeBlock*) Block;
+			S.InUse--;
+			SC.InUse--;
+			if (SLX < SC.Avail) SC.Avail = SLX;
+
+			//  Return the slab to the platform once it is empty
+			if (S.InUse == 0) emptySlab(SC, SLX);
+
+			//  Return to caller
+			return;
+		}
+
+		//  chargeFor
+		//
+		//  Returns the number of bytes that an allocation of the passed size actually consumes in the arena
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the block (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Size of the block rounded to its size class (bytes)
+		//
+		//  NOTES:
+		//
+
+		static size_t	chargeFor(size_t Size) {
+			int				SCX = classOf(Size);													//  Size class index
+
+			if (Size == 0 || SCX < 0) return Size;
+			return MinBlockSize << SCX;
+		}
+
+		//  getFootprint
+		//
+		//  Returns the total memory committed by the arena (carved slab pages plus large blocks)
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Bytes committed by the arena
+		//
+		//  NOTES:
+		//
+		//	1.	The footprint is maintained as blocks are carved and slabs are emptied, no locks are taken
+		//
+
+		size_t	getFootprint() const {
+			return SlabBytes.load(std::memory_order_relaxed) + LargeBytes.load(std::memory_order_relaxed);
+		}
+
+		//  getInUse
+		//
+		//  Returns the memory in use by allocated blocks (rounded to their size classes)
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Bytes in use
+		//
+		//  NOTES:
+		//
+
+		size_t	getInUse() {
+			size_t			InUse = LargeBytes.load();												//  Accumulated usage
+
+			for (int SCX = 0; SCX < NumClasses; SCX++) {
+				std::lock_guard<std::mutex>		SCGuard(Classes[SCX].Lock);
+				InUse += Classes[SCX].InUse * (MinBlockSize << SCX);
+			}
+			return InUse;
+		}
+
+		//  dismiss
+		//
+		//  Releases all slabs held by the arena
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	All blocks allocated from slabs become invalid, large blocks are NOT released
+		//
+
+		void	dismiss() {
+
+			for (int SCX = 0; SCX < NumClasses; SCX++) {
+				SizeClass&		SC = Classes[SCX];
+				std::lock_guard<std::mutex>		SCGuard(SC.Lock);
+
+				for (size_t SLX = 0; SLX < SC.USlabs; SLX++) {
+					SlabBytes.fetch_sub(SC.pSlabs[SLX].Committed);
+					releaseSlab(SC.pSlabs[SLX].pBase);
+				}
+				if (SC.pSlabs != nullptr) free(SC.pSlabs);
+				SC.pSlabs = nullptr;
+				SC.NSlabs = SC.USlabs = SC.Avail = 0;
+				SC.InUse = 0;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+	private:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Members																								*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		bool					HugePages;															//  Back slabs with huge pages
+		SizeClass				Classes[NumClasses];												//  Size classes
+		std::atomic<size_t>		SlabBytes;															//  Bytes committed by slabs
+		std::atomic<size_t>		LargeBytes;															//  Bytes in large (heap) blocks
+		std::atomic<size_t>		LargeInUse;															//  Number of large (heap) blocks
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Functions																								*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  classOf
+		//
+		//  Returns the size class index for a block size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the block (bytes)
+		//
+		//  RETURNS:
+		//
+		//		int				-		Size class index, -1 if the block is too large for the slabs
+		//
+		//  NOTES:
+		//
+
+		static int	classOf(size_t Size) {
+			int				SCX = 0;																//  Size class index
+
+			if (Size > MaxBlockSize) return -1;
+			while ((MinBlockSize << SCX) < Size) SCX++;
+			return SCX;
+		}
+
+		//  addSlab
+		//
+		//  Adds a new (uncarved) slab to a size class
+		//
+		//  PARAMETERS:
+		//
+		//		SizeClass&		-		Reference to the (locked) size class
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the new slab, the number of slabs (USlabs) if no slab could be added
+		//
+		//  NOTES:
+		//
+		//	1.	The slab table is kept in address order so that the slab holding a block can be found by a binary search
+		//
+
+		size_t	addSlab(SizeClass& SC) {
+			BYTE*			pSlab = nullptr;														//  New slab
+			size_t			SLX = 0;																//  Insertion index
+
+			//  Make sure that the slab table has capacity
+			if (SC.NSlabs == SC.USlabs) {
+				Slab* pNewSlabs = (Slab*) realloc(SC.pSlabs, (SC.NSlabs + 16) * sizeof(Slab));
+				if (pNewSlabs == nullptr) return SC.USlabs;
+				SC.pSlabs = pNewSlabs;
+				SC.NSlabs += 16;
+			}
+
+			//  Acquire the slab memory
+			pSlab = acquireSlab();
+			if (pSlab == nullptr) return SC.USlabs;
+
+			//  Insert the slab in address order
+			while (SLX < SC.USlabs && SC.pSlabs[SLX].pBase < pSlab) SLX++;
+			if (SLX < SC.USlabs) memmove(&SC.pSlabs[SLX + 1], &SC.pSlabs[SLX], (SC.USlabs - SLX) * sizeof(Slab));
+			SC.pSlabs[SLX].pBase = pSlab;
+			SC.pSlabs[SLX].pFree = nullptr;
+			SC.pSlabs[SLX].Carved = 0;
+			SC.pSlabs[SLX].Committed = 0;
+			SC.pSlabs[SLX].InUse = 0;
+			SC.USlabs++;
+
+			//  Return the index of the new slab
+			return SLX;
+		}
+
+		//  findSlab
+		//
+		//  Returns the index of the slab that holds the passed block
+		//
+		//  PARAMETERS:
+		//
+		//		SizeClass&		-		Reference to the (locked) size class
+		//		BYTE*			-		Pointer to the block
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the slab, the number of slabs (USlabs) if the block is not in a slab
+		//
+		//  NOTES:
+		//
+
+		size_t	findSlab(SizeClass& SC, BYTE* Block) {
+			size_t			Low = 0;																//  Lower bound
+			size_t			High = SC.USlabs;														//  Upper bound (exclusive)
+			size_t			Mid = 0;																//  Probe
+
+			while (Low < High) {
+				Mid = (Low + High) / 2;
+				if (Block < SC.pSlabs[Mid].pBase) High = Mid;
+				else if (Block >= SC.pSlabs[Mid].pBase + SlabSize) Low = Mid + 1;
+				else return Mid;
+			}
+			return SC.USlabs;
+		}
+
+		//  commitTo
+		//
+		//  Accounts for the pages of a slab that are committed once it has been carved to the passed extent
+		//
+		//  PARAMETERS:
+		//
+		//		Slab&			-		Reference to the slab
+		//		size_t			-		Bytes carved from the slab
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	A slab backed by huge pages is committed whole
+		//
+
+		void	commitTo(Slab& S, size_t Carved) {
+			size_t			Committed = HugePages ? SlabSize : ((Carved + (PageSize - 1)) / PageSize) * PageSize;	//  Committed bytes
+
+			if (Committed > S.Committed) {
+				SlabBytes.fetch_add(Committed - S.Committed);
+				S.Committed = Committed;
+			}
+			return;
+		}
+
+		//  emptySlab
+		//
+		//  Returns the memory of a slab that has no blocks in use to the platform
+		//
+		//  PARAMETERS:
+		//
+		//		SizeClass&		-		Reference to the (locked) size class
+		//		size_t			-		Index of the (empty) slab
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	The only slab of a (normal page) size class is kept with its pages discarded (MADV_DONTNEED) so that
+		//		a class that repeatedly empties does not map and unmap a slab each time.
+		//
+
+		void	emptySlab(SizeClass& SC, size_t SLX) {
+			Slab&			S = SC.pSlabs[SLX];														//  Empty slab
+
+			SlabBytes.fetch_sub(S.Committed);
+
+#if  (!defined(_WIN32) && !defined(_WIN64) && defined(MADV_DONTNEED))
+			if (SC.USlabs == 1 && !HugePages) {
+				madvise(S.pBase, S.Committed, MADV_DONTNEED);
+				S.pFree = nullptr;
+				S.Carved = 0;
+				S.Committed = 0;
+				return;
+			}
+#endif
+
+			//  Release the slab and remove it from the table
+			releaseSlab(S.pBase);
+			if (SLX < (SC.USlabs - 1)) memmove(&SC.pSlabs[SLX], &SC.pSlabs[SLX + 1], (SC.USlabs - (SLX + 1)) * sizeof(Slab));
+			SC.USlabs--;
+			if (SC.Avail > SLX) SC.Avail--;
+
+			//  Return to caller
+			return;
+		}
+
+		//  acquireSlab
+		//
+		//  Acquires the memory for a new slab from the platform
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the slab memory, NULL if not available
+		//
+		//  NOTES:
+		//
+		//	1.	Huge pages are requested explicitly (MAP_HUGETLB) if the platform supports them, if none are available
+		//		then transparent huge pages are requested for a normal mapping.
+		//
+
+		BYTE*	acquireSlab() {
+#if  (defined(_WIN32) || defined(_WIN64))
+			return (BYTE*) malloc(SlabSize);
+#else
+			void*			pSlab = MAP_FAILED;														//  Mapped slab
+
+#ifdef MAP_HUGETLB
+			if (HugePages) pSlab = mmap(nullptr, SlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+			if (pSlab == MAP_FAILED) {
+				pSlab = mmap(nullptr, SlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (pSlab == MAP_FAILED) return nullptr;
+#ifdef MADV_HUGEPAGE
+				if (HugePages) madvise(pSlab, SlabSize, MADV_HUGEPAGE);
+#endif
+			}
+			return (BYTE*) pSlab;
+#endif
+		}
+
+		//  releaseSlab
+		//
+		//  Returns the memory for a slab to the platform
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*			-		Pointer to the slab memory
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	releaseSlab(BYTE* pSlab) {
+#if  (defined(_WIN32) || defined(_WIN64))
+			free(pSlab);
+#else
+			munmap(pSlab, SlabSize);
+#endif
+			return;
+		}
+	};
+
+}
@@ -3,7 +3,7 @@
 //*																													*
 //*   File:       StringPool.h																						*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.1.0	(Build: 02)																					*
+//*   Version:    1.4.0	(Build: 05)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
 //*   Copyright 2017 - 2023 Ian J. Tree																				*
@@ -17,7 +17,16 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		The length of each string is held in the String Length Table, getLength() does not scan the string.		*
+//*	2.		Strings are indexed by two chained hash indexes (exact and case-folded) that are maintained by			*
+//*			addString(), deleteString() and replaceString(). searchString() and addUniqueString() (and the			*
+//*			case insensitive variants) are resolved from the indexes without scanning the pool.						*
+//*	3.		The pool grows geometrically (by default doubling), see setGrowthPolicy(). Capacity can be reserved		*
+//*			up front with reserve(). References freed by deleteString() are reused before new ones are issued.		*
+//*	4.		deleteString() does not move other strings, the space is recorded in size ordered free extent bins		*
+//*			and reused (best fit) by later additions. The pool is compacted in a single pass when the free space	*
+//*			passes the compaction threshold (see setCompactionThreshold()), compaction (like growth) invalidates	*
+//*			pointers returned by getString().																		*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -26,6 +35,9 @@
 //*	1.0.0 -		02/12/2017	-	Initial Release																		*
 //*	1.1.0 -		30/10/2022	-	added searchString() and variants													*
 //*							-	addes addUniqueString() and variants												*
+//*	1.2.0 -		19/10/2026	-	Hash indexed searches and stored string lengths										*
+//*	1.3.0 -		19/10/2026	-	Geometric growth policy, reserve() and free reference reuse							*
+//*	1.4.0 -		19/10/2026	-	Non-compacting delete with best fit reuse and threshold compaction					*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -59,6 +71,24 @@ namespace xymorg {
 		static const int	DefaultNumStrings = 100;												//  Default number of strings
 		static const int	DefaultPoolSize = 4096;													//  Default string pool size
 		static const STRREF EmptySlot = 0xFFFFFFFF;													//  Empty slot value in the SRT
+		static const size_t	MinIndexBuckets = 64;													//  Minimum number of hash index buckets
+		static const size_t	DefaultGrowthPct = 100;													//  Default growth (percent of capacity)
+		static const size_t	DefaultCompactPct = 25;													//  Default compaction threshold (percent of used space)
+		static const size_t	ExactFreeBins = 64;														//  Number of exact size free extent bins
+		static const size_t	NumFreeBins = 128;														//  Number of free extent bins
+		static const size_t	NoExtent = SIZE_MAX;													//  Null free extent index
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Structures	                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		typedef struct FreeExtent {
+			size_t		Off;																		//  Offset of the extent in the pool
+			size_t		Len;																		//  Length of the extent
+			size_t		Next;																		//  Next extent in the bin (or unused)
+		} FreeExtent;
 
 	public:
 
@@ -79,7 +109,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		StringPool() : SRT(nullptr), SP(nullptr), EmptyString(0) {
+		StringPool() : SRT(nullptr), SLT(nullptr), SP(nullptr), HIXCap(0), HIX(nullptr), HIXNext(nullptr), CIX(nullptr), CIXNext(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumStrings), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct), EmptyString(0) {
 
 			//  Initialise the pool for the default capacity
 			if (!initialisePool(DefaultNumStrings, DefaultPoolSize)) {
@@ -105,7 +135,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		StringPool(size_t RNS, size_t RSPS) : SRT(nullptr), SP(nullptr), EmptyString(0) {
+		StringPool(size_t RNS, size_t RSPS) : SRT(nullptr), SLT(nullptr), SP(nullptr), HIXCap(0), HIX(nullptr), HIXNext(nullptr), CIX(nullptr), CIXNext(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumStrings), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct), EmptyString(0) {
 
 			//  Safety checks on capacities
 			if (RNS == 0) RNS = DefaultNumStrings;
@@ -134,7 +164,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		StringPool(const StringPool& Src) : SRT(nullptr), SP(nullptr), EmptyString(0) {
+		StringPool(const StringPool& Src) : SRT(nullptr), SLT(nullptr), SP(nullptr), HIXCap(0), HIX(nullptr), HIXNext(nullptr), CIX(nullptr), CIXNext(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumStrings), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct), EmptyString(0) {
 
 			//  Initialise the pool using the capacity from the source
 			if (!initialisePool(Src.SRTCap, Src.SPCap)) {
@@ -142,9 +172,11 @@ namespace xymorg {
 				return;
 			}
 
-			//  Copy the content of the SRT & SP from the source
+			//  Copy the content of the SRT, SLT & SP from the source
 			if (SRT != nullptr) memcpy(SRT, Src.SRT, Src.SRTCap * sizeof(size_t));
-			if (SP != nullptr) memcpy(SP, Src.SP, Src.SPCap);
+			if (SLT != nullptr) memcpy(SLT, Src.SLT, Src.SRTCap * sizeof(size_t));
+			if (FRS != nullptr) memcpy(FRS, Src.FRS, Src.FRSEnts * sizeof(STRREF));
+			if (SP != nullptr) memcpy(SP, Src.SP, Src.SPUsed);
 
 			//  Copy the pool information from the source
 			SRTCap = Src.SRTCap;
@@ -152,6 +184,27 @@ namespace xymorg {
 			SRTHiWater = Src.SRTHiWater;
 			SPCap = Src.SPCap;
 			SPUsed = Src.SPUsed;
+			FRSEnts = Src.FRSEnts;
+			GrowthPct = Src.GrowthPct;
+			RefIncrement = Src.RefIncrement;
+			PoolIncrement = Src.PoolIncrement;
+			CompactPct = Src.CompactPct;
+
+			//  Copy the free extents from the source
+			LiveBytes = Src.LiveBytes;
+			if (Src.FEXEnts > 0) {
+				FEX = (FreeExtent*)malloc(Src.FEXEnts * sizeof(FreeExtent));
+				if (FEX != nullptr) {
+					memcpy(FEX, Src.FEX, Src.FEXEnts * sizeof(FreeExtent));
+					FEXCap = FEXEnts = Src.FEXEnts;
+					FEXFree = Src.FEXFree;
+					memcpy(FEB, Src.FEB, sizeof(FEB));
+					memcpy(FEBMap, Src.FEBMap, sizeof(FEBMap));
+				}
+			}
+
+			//  Index the copied strings
+			reindexPool();
 
 			//  Return to caller
 			return;
@@ -170,10 +223,11 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		StringPool(StringPool&& Src) noexcept : SRT(nullptr), SP(nullptr), EmptyString(0) {
+		StringPool(StringPool&& Src) noexcept : SRT(nullptr), SLT(nullptr), SP(nullptr), HIXCap(0), HIX(nullptr), HIXNext(nullptr), CIX(nullptr), CIXNext(nullptr), FRS(nullptr), FRSEnts(0), GrowthPct(DefaultGrowthPct), RefIncrement(DefaultNumStrings), PoolIncrement(DefaultPoolSize), FEX(nullptr), FEXCap(0), FEXEnts(0), FEXFree(NoExtent), FEB(), FEBMap(), LiveBytes(0), CompactPct(DefaultCompactPct), EmptyString(0) {
 
 			//  Acquire the underlying pool storage from the source
 			SRT = Src.SRT;
+			SLT = Src.SLT;
 			SRTCap = Src.SRTCap;
 			SRTEnts = Src.SRTEnts;
 			SRTHiWater = Src.SRTHiWater;
@@ -182,8 +236,31 @@ namespace xymorg {
 			SPCap = Src.SPCap;
 			SPUsed = Src.SPUsed;
 
+			HIXCap = Src.HIXCap;
+			HIX = Src.HIX;
+			HIXNext = Src.HIXNext;
+			CIX = Src.CIX;
+			CIXNext = Src.CIXNext;
+
+			FRS = Src.FRS;
+			FRSEnts = Src.FRSEnts;
+
+			GrowthPct = Src.GrowthPct;
+			RefIncrement = Src.RefIncrement;
+			PoolIncrement = Src.PoolIncrement;
+
+			FEX = Src.FEX;
+			FEXCap = Src.FEXCap;
+			FEXEnts = Src.FEXEnts;
+			FEXFree = Src.FEXFree;
+			memcpy(FEB, Src.FEB, sizeof(FEB));
+			memcpy(FEBMap, Src.FEBMap, sizeof(FEBMap));
+			LiveBytes = Src.LiveBytes;
+			CompactPct = Src.CompactPct;
+
 			//  Disconnect the underlying storage from the source
 			Src.SRT = nullptr;
+			Src.SLT = nullptr;
 			Src.SRTCap = 0;
 			Src.SRTEnts = 0;
 			Src.SRTHiWater = 0;
@@ -192,6 +269,20 @@ namespace xymorg {
 			Src.SPCap = 0;
 			Src.SPUsed = 0;
 
+			Src.HIXCap = 0;
+			Src.HIX = nullptr;
+			Src.HIXNext = nullptr;
+			Src.CIX = nullptr;
+			Src.CIXNext = nullptr;
+
+			Src.FRS = nullptr;
+			Src.FRSEnts = 0;
+
+			Src.FEX = nullptr;
+			Src.FEXCap = 0;
+			Src.resetExtents();
+			Src.LiveBytes = 0;
+
 			//  Return to caller
 			return;
 		}
@@ -248,6 +339,69 @@ namespace xymorg {
 
 		void	dismiss() { return clearPool(); }
 
+		//  reserve
+		//
+		//  Ensures that the pool has (at least) the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Capacity of the pool (number of strings)
+		//		size_t			-		Capacity of the pool (string storage space)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool has the requested capacity, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The capacity of the pool is never reduced
+		//
+
+		bool	reserve(size_t RNS, size_t RSPS) {
+
+			//  An uninitialised pool is initialised with the requested capacity
+			if (SRTCap == 0 || SPCap == 0) {
+				if (RNS < RefIncrement) RNS = RefIncrement;
+				if (RSPS < PoolIncrement) RSPS = PoolIncrement;
+				return initialisePool(RNS, RSPS);
+			}
+
+			//  Expand the reference tables and the index
+			if (!resizeTables(RNS)) return false;
+			if (RNS > HIXCap) {
+				size_t		NewBuckets = HIXCap;
+				while (NewBuckets < RNS) NewBuckets = NewBuckets * 2;
+				if (!resizeIndex(NewBuckets)) return false;
+			}
+
+			//  Expand the pool
+			return resizePool(RSPS);
+		}
+
+		//  setGrowthPolicy
+		//
+		//  Sets the policy used to grow the pool when it runs out of capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Growth as a percentage of the current capacity (0 for fixed increments)
+		//		size_t			-		Minimum growth of the reference table (number of strings)
+		//		size_t			-		Minimum growth of the pool (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The default policy doubles the capacity (100%) with minimum increments of 100 strings and 4 Kb
+		//
+
+		void	setGrowthPolicy(size_t NewGrowthPct, size_t NewRefIncrement, size_t NewPoolIncrement) {
+			GrowthPct = NewGrowthPct;
+			RefIncrement = (NewRefIncrement == 0) ? 1 : NewRefIncrement;
+			PoolIncrement = (NewPoolIncrement == 0) ? 1 : NewPoolIncrement;
+			return;
+		}
+
 		//  addString
 		//
 		//  Adds the passed null-terminated string to the pool as the next available entry
@@ -303,24 +457,27 @@ namespace xymorg {
 				//
 				//  Set the offset of the new string in the reference table
 				//
-				SRT[NewRef - 1] = SPUsed;
+				SRT[NewRef - 1] = allocateSpace(NewStrLen + 1);
+				SLT[NewRef - 1] = NewStrLen;
 
 				//
 				//  If we have a non-null string then add it to the pool
 				//
-				if (pNewString != nullptr && NewStrLen > 0) memcpy(SP + SPUsed, pNewString, NewStrLen);
+				if (pNewString != nullptr && NewStrLen > 0) memcpy(SP + SRT[NewRef - 1], pNewString, NewStrLen);
 
 				//
 				//  Add a string terminator
 				//
-				SP[SPUsed + NewStrLen] = '\0';
+				SP[SRT[NewRef - 1] + NewStrLen] = '\0';
 
 				//
 				//  Update the pool information
 				//
 				SRTEnts++;
 				if (NewRef > SRTHiWater) SRTHiWater++;
-				SPUsed += (NewStrLen + 1);
+
+				//  Add the string to the indexes
+				indexString(NewRef);
 			}
 
 			//  Return the reference
@@ -399,10 +556,17 @@ namespace xymorg {
 		//
 		//  NOTES:
 		//
+		//		1.	The length is taken from the String Length Table
 		//
 
 		size_t		getLength(STRREF Ref) {
-			return strlen(getString(Ref));
+
+			//  Any invalid reference has a zero length
+			if (Ref == NULLSTRREF) return 0;
+			if (Ref > SRTHiWater) return 0;
+			if (SRT[Ref - 1] == EmptySlot) return 0;
+
+			return SLT[Ref - 1];
 		}
 
 		//  deleteString
@@ -417,39 +581,31 @@ namespace xymorg {
 		//
 		//  NOTES:
 		//
+		//		1.	Other strings are not moved unless the deletion causes the pool to be compacted
+		//
 
 		void		deleteString(STRREF Ref) {
 
 			//  Any invalid reference returns with no further action
 			if (Ref == NULLSTRREF) return;
-			if (Ref > SRTHiWater + 1) return;
+			if (Ref > SRTHiWater) return;
 			if (SRT[Ref - 1] == EmptySlot) return;
 
-			//
-			//  Compute the length to be excised from the pool
-			//
-			size_t		SnipLen = strlen(getString(Ref)) + 1;
-
-			//  Remove the string from the pool
-			if (((SPUsed - SRT[Ref - 1]) - SnipLen) > 0) memmove(SP + SRT[Ref - 1], SP + SRT[Ref - 1] + SnipLen, (SPUsed - SRT[Ref - 1]) - SnipLen);
-
-			//  Clear the residual space at the end of the pool
-			memset((SP + SPUsed) - SnipLen, 0, SnipLen);
+			//  Remove the string from the indexes
+			unindexString(Ref);
 
-			//  Update the pool information
-			SPUsed = SPUsed - SnipLen;
-
-			//
-			//  Update all string references in the table that lie above the current reference offset
-			//
-			for (size_t SRX = 0; SRX < SRTHiWater; SRX++) {
-				if (SRT[SRX] != EmptySlot && SRT[SRX] > SRT[Ref - 1]) SRT[SRX] = SRT[SRX] - SnipLen;
-			}
+			//  Release the space occupied by the string (and terminator)
+			releaseSpace(SRT[Ref - 1], SLT[Ref - 1] + 1);
 
 			//  Remove the string reference from the table
 			SRT[Ref - 1] = EmptySlot;
 			SRTEnts--;
-			if (Ref == (SRTHiWater + 1)) SRTHiWater--;
+
+			//  Make the reference available for reuse
+			FRS[FRSEnts++] = Ref;
+
+			//  Compact the pool if the free space has passed the threshold
+			if (isFragmented()) compactPool();
 
 			//  Return to caller
 			return;
@@ -508,8 +664,9 @@ namespace xymorg {
 			//  Check (and adjust if necessary) the capacity of the pool
 			if (!checkCapacity(NewStrLen)) return NULLSTRREF;
 
-			//  Locate the String Reference to be used
+			//  Locate the String Reference to be used, or reclaim the freed reference
 			if (Ref == NULLSTRREF) Ref = locateFreeStringRef();
+			else claimFreeStringRef(Ref);
 
 			//  If we acquired a valid reference then populate it with the new string
 			if (Ref != NULLSTRREF) {
@@ -517,24 +674,27 @@ namespace xymorg {
 				//
 				//  Set the offset of the new string in the reference table
 				//
-				SRT[Ref - 1] = SPUsed;
+				SRT[Ref - 1] = allocateSpace(NewStrLen + 1);
+				SLT[Ref - 1] = NewStrLen;
 
 				//
 				//  If we have a non-null string then add it to the pool
 				//
-				if (pNewString != nullptr && NewStrLen > 0) memcpy(SP + SPUsed, pNewString, NewStrLen);
+				if (pNewString != nullptr && NewStrLen > 0) memcpy(SP + SRT[Ref - 1], pNewString, NewStrLen);
 
 				//
 				//  Add a string terminator
 				//
-				SP[SPUsed + NewStrLen] = '\0';
+				SP[SRT[Ref - 1] + NewStrLen] = '\0';
 
 				//
 				//  Update the pool information
 				//
 				SRTEnts++;
 				if (Ref > SRTHiWater) SRTHiWater++;
-				SPUsed += (NewStrLen + 1);
+
+				//  Add the string to the indexes
+				indexString(Ref);
 			}
 
 			//  Return the reference
@@ -675,24 +835,27 @@ namespace xymorg {
 			if (StringLen == 0) return NULLSTRREF;
 			if (String[0] == '\0') return NULLSTRREF;
 
-			//  Search the string pool for the passed string
-			for (size_t SX = 0; SX < SRTHiWater; SX++) {
-				if (SRT[SX] != EmptySlot) {
+			if (HIXCap == 0) return NULLSTRREF;
+
+			STRREF		Found = NULLSTRREF;													//  Matching string reference
+			size_t		Bucket = hashString(String, StringLen, CaseInsensitive) & (HIXCap - 1);		//  Index bucket
+			STRREF		Ref = CaseInsensitive ? CIX[Bucket] : HIX[Bucket];						//  Chain reference
+
+			//  Search the chain for the lowest reference that matches the passed string
+			while (Ref != NULLSTRREF) {
+				if (SLT[Ref - 1] == StringLen && (Found == NULLSTRREF || Ref < Found)) {
 					if (CaseInsensitive) {
-						if (_memicmp(SP + SRT[SX], String, StringLen) == 0) {
-							if (strlen(SP + SRT[SX]) == StringLen) return STRREF(SX + 1);
-						}
+						if (_memicmp(SP + SRT[Ref - 1], String, StringLen) == 0) Found = Ref;
 					}
 					else {
-						if (memcmp(SP + SRT[SX], String, StringLen) == 0) {
-							if (strlen(SP + SRT[SX]) == StringLen) return STRREF(SX + 1);
-						}
+						if (memcmp(SP + SRT[Ref - 1], String, StringLen) == 0) Found = Ref;
 					}
 				}
+				Ref = CaseInsensitive ? CIXNext[Ref - 1] : HIXNext[Ref - 1];
 			}
 
-			//  NOT FOUND
-			return NULLSTRREF;
+			//  Return the matching reference (or NULLSTRREF)
+			return Found;
 		}
 
 		//  addUniqueString
@@ -816,6 +979,46 @@ namespace xymorg {
 			return ExistingString;
 		}
 
+		//  compact
+		//
+		//  Compacts the pool, removing all of the free space between strings
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool is compact, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	Pointers returned by getString() are invalidated by compaction
+		//
+
+		bool	compact() {
+			if (LiveBytes == SPUsed) return true;
+			return compactPool();
+		}
+
+		//  setCompactionThreshold
+		//
+		//  Sets the proportion of free space inside the pool at which the pool is compacted
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Compaction threshold (percent of the used space)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The default threshold is 25%, the pool is never compacted for less than the minimum growth increment
+		//
+
+		void	setCompactionThreshold(size_t NewCompactPct) {
+			CompactPct = NewCompactPct;
+			return;
+		}
+
 		//  Copy Assignment operator =
 		//
 		//  Replaces the content of this StringPool with a deep copy of the content of another StringPool
@@ -845,9 +1048,11 @@ namespace xymorg {
 				return *this;
 			}
 
-			//  Copy the content of the SRT & SP from the source
+			//  Copy the content of the SRT, SLT & SP from the source
 			if (SRT != nullptr) memcpy(SRT, rhs.SRT, rhs.SRTCap * sizeof(size_t));
-			if (SP != nullptr) memcpy(SP, rhs.SP, rhs.SPCap);
+			if (SLT != nullptr) memcpy(SLT, rhs.SLT, rhs.SRTCap * sizeof(size_t));
+			if (FRS != nullptr) memcpy(FRS, rhs.FRS, rhs.FRSEnts * sizeof(STRREF));
+			if (SP != nullptr) memcpy(SP, rhs.SP, rhs.SPUsed);
 
 			//  Copy the pool information from the source
 			SRTCap = rhs.SRTCap;
@@ -855,6 +1060,27 @@ namespace xymorg {
 			SRTHiWater = rhs.SRTHiWater;
 			SPCap = rhs.SPCap;
 			SPUsed = rhs.SPUsed;
+			FRSEnts = rhs.FRSEnts;
+			GrowthPct = rhs.GrowthPct;
+			RefIncrement = rhs.RefIncrement;
+			PoolIncrement = rhs.PoolIncrement;
+			CompactPct = rhs.CompactPct;
+
+			//  Copy the free extents from the source
+			LiveBytes = rhs.LiveBytes;
+			if (rhs.FEXEnts > 0) {
+				FEX = (FreeExtent*)malloc(rhs.FEXEnts * sizeof(FreeExtent));
+				if (FEX != nullptr) {
+					memcpy(FEX, rhs.FEX, rhs.FEXEnts * sizeof(FreeExtent));
+					FEXCap = FEXEnts = rhs.FEXEnts;
+					FEXFree = rhs.FEXFree;
+					memcpy(FEB, rhs.FEB, sizeof(FEB));
+					memcpy(FEBMap, rhs.FEBMap, sizeof(FEBMap));
+				}
+			}
+
+			//  Index the copied strings
+			reindexPool();
 
 			//  Return to caller
 			return *this;
@@ -879,13 +1105,11 @@ namespace xymorg {
 		StringPool& operator = (StringPool&& rhs) noexcept {
 
 			//  Dismiss any existing allocations
-			if (SRT != nullptr) free(SRT);
-			SRT = nullptr;
-			if (SP != nullptr) free(SP);
-			SP = nullptr;
+			clearPool();
 
 			//  Acquire the underlying pool storage from the source
 			SRT = rhs.SRT;
+			SLT = rhs.SLT;
 			SRTCap = rhs.SRTCap;
 			SRTEnts = rhs.SRTEnts;
 			SRTHiWater = rhs.SRTHiWater;
@@ -894,8 +1118,31 @@ namespace xymorg {
 			SPCap = rhs.SPCap;
 			SPUsed = rhs.SPUsed;
 
+			HIXCap = rhs.HIXCap;
+			HIX = rhs.HIX;
+			HIXNext = rhs.HIXNext;
+			CIX = rhs.CIX;
+			CIXNext = rhs.CIXNext;
+
+			FRS = rhs.FRS;
+			FRSEnts = rhs.FRSEnts;
+
+			GrowthPct = rhs.GrowthPct;
+			RefIncrement = rhs.RefIncrement;
+			PoolIncrement = rhs.PoolIncrement;
+
+			FEX = rhs.FEX;
+			FEXCap = rhs.FEXCap;
+			FEXEnts = rhs.FEXEnts;
+			FEXFree = rhs.FEXFree;
+			memcpy(FEB, rhs.FEB, sizeof(FEB));
+			memcpy(FEBMap, rhs.FEBMap, sizeof(FEBMap));
+			LiveBytes = rhs.LiveBytes;
+			CompactPct = rhs.CompactPct;
+
 			//  Disconnect the underlying storage from the source
 			rhs.SRT = nullptr;
+			rhs.SLT = nullptr;
 			rhs.SRTCap = 0;
 			rhs.SRTEnts = 0;
 			rhs.SRTHiWater = 0;
@@ -904,6 +1151,20 @@ namespace xymorg {
 			rhs.SPCap = 0;
 			rhs.SPUsed = 0;
 
+			rhs.HIXCap = 0;
+			rhs.HIX = nullptr;
+			rhs.HIXNext = nullptr;
+			rhs.CIX = nullptr;
+			rhs.CIXNext = nullptr;
+
+			rhs.FRS = nullptr;
+			rhs.FRSEnts = 0;
+
+			rhs.FEX = nullptr;
+			rhs.FEXCap = 0;
+			rhs.resetExtents();
+			rhs.LiveBytes = 0;
+
 			//  Return
 			return *this;
 		}
@@ -922,12 +1183,39 @@ namespace xymorg {
 		size_t			SRTHiWater;															//  Number of string reference entries (high watermark)
 		size_t			SRTEnts;															//  Number of string reference entries (in use)
 		size_t*			SRT;																//  Pointer to the String Reference Table
+		size_t*			SLT;																//  Pointer to the String Length Table
 
 		//  String Pool
 		size_t			SPCap;																//  String Pool capacity (bytes)
 		size_t			SPUsed;																//  String Pool Used (bytes)
 		char*			SP;																	//  String Pool
 
+		//  Hash Indexes
+		size_t			HIXCap;																//  Number of index buckets (power of 2)
+		STRREF*			HIX;																//  Index buckets (exact)
+		STRREF*			HIXNext;															//  Index chains (exact, parallel to the SRT)
+		STRREF*			CIX;																//  Index buckets (case-folded)
+		STRREF*			CIXNext;															//  Index chains (case-folded, parallel to the SRT)
+
+		//  Free Reference Stack
+		STRREF*			FRS;																//  References freed for reuse
+		size_t			FRSEnts;															//  Number of freed references
+
+		//  Growth Policy
+		size_t			GrowthPct;															//  Growth (percent of current capacity)
+		size_t			RefIncrement;														//  Minimum reference table growth (strings)
+		size_t			PoolIncrement;														//  Minimum pool growth (bytes)
+
+		//  Free Extents
+		FreeExtent*		FEX;																//  Free extent table
+		size_t			FEXCap;																//  Free extent table capacity
+		size_t			FEXEnts;															//  Number of free extent table entries used
+		size_t			FEXFree;															//  First unused free extent table entry
+		size_t			FEB[NumFreeBins];													//  Free extent bins (size order)
+		uint64_t		FEBMap[NumFreeBins / 64];											//  Map of non-empty free extent bins
+		size_t			LiveBytes;															//  Bytes occupied by strings (and terminators)
+		size_t			CompactPct;															//  Compaction threshold (percent of used space)
+
 		//  Empty String
 		char			EmptyString;														//  Empty String
 
@@ -953,6 +1241,8 @@ namespace xymorg {
 			//  Clear eny existing pool content
 			if (SRT != nullptr) free(SRT);
 			SRT = nullptr;
+			if (SLT != nullptr) free(SLT);
+			SLT = nullptr;
 			SRTCap = 0;
 			SRTHiWater = 0;
 			SRTEnts = 0;
@@ -960,6 +1250,23 @@ namespace xymorg {
 			SP = nullptr;
 			SPCap = 0;
 			SPUsed = 0;
+			if (HIX != nullptr) free(HIX);
+			HIX = nullptr;
+			if (HIXNext != nullptr) free(HIXNext);
+			HIXNext = nullptr;
+			if (CIX != nullptr) free(CIX);
+			CIX = nullptr;
+			if (CIXNext != nullptr) free(CIXNext);
+			CIXNext = nullptr;
+			HIXCap = 0;
+			if (FRS != nullptr) free(FRS);
+			FRS = nullptr;
+			FRSEnts = 0;
+			if (FEX != nullptr) free(FEX);
+			FEX = nullptr;
+			FEXCap = 0;
+			resetExtents();
+			LiveBytes = 0;
 
 			//  Return to caller
 			return;
@@ -997,20 +1304,44 @@ namespace xymorg {
 			SRTEnts = 0;
 			memset(SRT, 0xFF, RNS * sizeof(size_t));
 
+			//
+			//  Allocate and initialise the String Length Table (SLT) and the index chains
+			//
+
+			SLT = (size_t*)malloc(RNS * sizeof(size_t));
+			HIXNext = (STRREF*)malloc(RNS * sizeof(STRREF));
+			CIXNext = (STRREF*)malloc(RNS * sizeof(STRREF));
+			FRS = (STRREF*)malloc(RNS * sizeof(STRREF));
+			if (SLT == nullptr || HIXNext == nullptr || CIXNext == nullptr || FRS == nullptr) {
+				clearPool();
+				return false;
+			}
+			memset(SLT, 0, RNS * sizeof(size_t));
+
 			//
 			//  Allocate and initialise the String Pool (SP)
 			//
 
 			SP = (char*)malloc(RSPS);
 			if (SP == nullptr) {
-				free(SRT);
-				SRT = nullptr;
+				clearPool();
 				return false;
 			}
 			SPCap = RSPS;
 			SPUsed = 0;
 			memset(SP, 0, RSPS);
 
+			//
+			//  Allocate the index buckets
+			//
+
+			size_t		NewBuckets = MinIndexBuckets;
+			while (NewBuckets < RNS) NewBuckets = NewBuckets * 2;
+			if (!resizeIndex(NewBuckets)) {
+				clearPool();
+				return false;
+			}
+
 			//  Return to caller
 			return true;
 		}
@@ -1029,6 +1360,8 @@ namespace xymorg {
 		//
 		//  NOTES:
 		//
+		//		1.	Capacity is grown according to the growth policy, see setGrowthPolicy()
+		//
 
 		bool	checkCapacity(size_t NewStrLen) {
 
@@ -1037,9 +1370,9 @@ namespace xymorg {
 			//
 
 			if (SRTCap == 0 || SPCap == 0) {
-				if (NewStrLen < 4096) NewStrLen = 4096;
+				if (NewStrLen < PoolIncrement) NewStrLen = PoolIncrement;
 				else NewStrLen = 2 * NewStrLen;
-				return initialisePool(100, NewStrLen);
+				return initialisePool(RefIncrement, NewStrLen);
 			}
 
 			//
@@ -1047,66 +1380,686 @@ namespace xymorg {
 			//
 
 			if (SRTEnts == SRTCap) {
-				//  Expand the SRT Pool
-				size_t* NewSRT = (size_t*)realloc(SRT, (SRTCap + 100) * sizeof(size_t));
-				if (NewSRT == nullptr) {
-					free(SRT);
-					SRT = nullptr;
-					return false;
-				}
-				else SRT = NewSRT;
-				memset(SRT + SRTCap, 0xFF, 100 * sizeof(size_t));
-				SRTCap += 100;
+				if (!resizeTables(growCapacity(SRTCap, SRTCap + 1, RefIncrement))) return false;
+			}
+
+			//  Keep the index load factor at or below one string per bucket
+			if ((SRTEnts + 1) > HIXCap) {
+				if (!resizeIndex(HIXCap * 2)) return false;
 			}
 
 			//
 			//  3. The String Pool must have the capacity for the string plus terminator
 			//
 
-			NewStrLen++;
-			while (NewStrLen >= (SPCap - SPUsed)) {
-				//  Expand the String Pool (SP)
-				char* NewSP = (char*)realloc(SP, SPCap + 4096);
-				if (NewSP == nullptr) {
-					free(SP);
-					SP = nullptr;
-					return false;
+			if ((NewStrLen + 1) >= (SPCap - SPUsed)) {
+				if (isFragmented()) compactPool();
+				if ((NewStrLen + 1) >= (SPCap - SPUsed)) {
+					if (!resizePool(growCapacity(SPCap, SPUsed + NewStrLen + 2, PoolIncrement))) return false;
 				}
-				else SP = NewSP;
-				memset(SP + SPCap, 0, 4096);
-				SPCap += 4096;
 			}
 
 			//  Return to caller
 			return true;
 		}
 
-		//  locateFreeStringRef 
+		//  growCapacity 
 		//
-		//  Locates the first available string reference to use
+		//  Computes the new capacity for a table or pool according to the growth policy
 		//
 		//  PARAMETERS:
 		//
+		//		size_t			-		Current capacity
+		//		size_t			-		Minimum capacity required
+		//		size_t			-		Minimum increment
+		//
 		//  RETURNS:
 		//
-		//		STRREF			-		The first available string reference for a new string
+		//		size_t			-		The new capacity
 		//
 		//  NOTES:
 		//
 
-		STRREF	locateFreeStringRef() {
+		size_t	growCapacity(size_t Cap, size_t Required, size_t MinIncrement) {
+			size_t		NewCap = Cap + ((Cap * GrowthPct) / 100);								//  New capacity
+
+			if (NewCap < (Cap + MinIncrement)) NewCap = Cap + MinIncrement;
+			if (NewCap < Required) NewCap = Required;
+			return NewCap;
+		}
+
+		//  resizeTables 
+		//
+		//  Expands the String Reference Table (and the parallel tables) to the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		New capacity (number of strings)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the tables were expanded, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	On failure the pool is left unchanged at the previous capacity
+		//
+
+		bool	resizeTables(size_t NewCap) {
+
+			//  Safety
+			if (NewCap <= SRTCap) return true;
+
+			//  Expand the SRT
+			size_t* NewSRT = (size_t*)realloc(SRT, NewCap * sizeof(size_t));
+			if (NewSRT == nullptr) return false;
+			SRT = NewSRT;
+			memset(SRT + SRTCap, 0xFF, (NewCap - SRTCap) * sizeof(size_t));
+
+			//  Expand the SLT, index chains and free reference stack to match
+			size_t* NewSLT = (size_t*)realloc(SLT, NewCap * sizeof(size_t));
+			if (NewSLT == nullptr) return false;
+			SLT = NewSLT;
+			memset(SLT + SRTCap, 0, (NewCap - SRTCap) * sizeof(size_t));
+			STRREF* NewHIXNext = (STRREF*)realloc(HIXNext, NewCap * sizeof(STRREF));
+			if (NewHIXNext == nullptr) return false;
+			HIXNext = NewHIXNext;
+			STRREF* NewCIXNext = (STRREF*)realloc(CIXNext, NewCap * sizeof(STRREF));
+			if (NewCIXNext == nullptr) return false;
+			CIXNext = NewCIXNext;
+			STRREF* NewFRS = (STRREF*)realloc(FRS, NewCap * sizeof(STRREF));
+			if (NewFRS == nullptr) return false;
+			FRS = NewFRS;
+
+			//  Update the capacity
+			SRTCap = NewCap;
+
+			//  Return showing success
+			return true;
+		}
+
+		//  resizePool 
+		//
+		//  Expands the String Pool (SP) to the requested capacity
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		New capacity (bytes)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool was expanded, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	On failure the pool is left unchanged at the previous capacity
+		//		2.	The expansion is not cleared, only the used portion of the pool is significant
+		//
+
+		bool	resizePool(size_t NewCap) {
+
+			//  Safety
+			if (NewCap <= SPCap) return true;
+
+			char* NewSP = (char*)realloc(SP, NewCap);
+			if (NewSP == nullptr) return false;
+			SP = NewSP;
+			SPCap = NewCap;
+
+			//  Return showing success
+			return true;
+		}
+
+		//  allocateSpace 
+		//
+		//  Allocates space in the pool, reusing the best fitting free extent if there is one
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the space required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Offset of the allocated space in the pool
+		//
+		//  NOTES:
+		//
+		//		1.	checkCapacity() MUST have been called for the space required
+		//
+
+		size_t	allocateSpace(size_t Len) {
+			size_t		Off = SPUsed;														//  Offset of the space
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Safety
+			if (Len == 0) return Off;
+			LiveBytes += Len;
+
+			//  Reuse a free extent if one is available
+			FX = takeExtent(Len);
+			if (FX != NoExtent) {
+				Off = FEX[FX].Off;
+				if (FEX[FX].Len > Len) {
+					//  Return the residue of the extent as a (smaller) free extent
+					FEX[FX].Off += Len;
+					FEX[FX].Len -= Len;
+					binExtent(FX);
+				}
+				else dropExtent(FX);
+				return Off;
+			}
 
-			//  If there are no unused references in the table then return the next at the hi water mark
-			if (SRTEnts == SRTHiWater) return STRREF(SRTHiWater + 1);
+			//  Allocate from the unused space at the end of the pool
+			SPUsed += Len;
+			return Off;
+		}
+
+		//  releaseSpace 
+		//
+		//  Releases space in the pool for reuse
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Offset of the space in the pool
+		//		size_t			-		Size of the space (bytes)
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	Adjacent free extents are not coalesced, the space is recovered when the pool is compacted
+		//
+
+		void	releaseSpace(size_t Off, size_t Len) {
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Safety
+			if (Len == 0) return;
+			LiveBytes -= Len;
 
-			//  Search the String Reference Table for the first unused entry
+			//  Space at the end of the pool is returned to the unused space
+			if (Off + Len == SPUsed) {
+				SPUsed = Off;
+				return;
+			}
+
+			//  Acquire an extent (space that cannot be recorded is recovered by compaction)
+			if (FEXFree != NoExtent) {
+				FX = FEXFree;
+				FEXFree = FEX[FX].Next;
+			}
+			else {
+				if (FEXEnts == FEXCap) {
+					size_t		NewCap = (FEXCap == 0) ? 64 : FEXCap * 2;
+					FreeExtent* NewFEX = (FreeExtent*)realloc(FEX, NewCap * sizeof(FreeExtent));
+					if (NewFEX == nullptr) return;
+					FEX = NewFEX;
+					FEXCap = NewCap;
+				}
+				FX = FEXEnts++;
+			}
+
+			//  Record the free extent in the bin for its size
+			FEX[FX].Off = Off;
+			FEX[FX].Len = Len;
+			binExtent(FX);
+
+			//  Return to caller
+			return;
+		}
+
+		//  binOf 
+		//
+		//  Returns the free extent bin for an extent size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the extent (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The bin index
+		//
+		//  NOTES:
+		//
+		//		1.	Bins 0 - 63 hold extents of exactly 1 - 64 bytes, the remaining bins each hold a power of 2 range
+		//
+
+		static size_t	binOf(size_t Len) {
+			size_t		Bin = ExactFreeBins;												//  Bin index
+			size_t		Limit = ExactFreeBins * 2;											//  Upper limit of the bin
+
+			if (Len <= ExactFreeBins) return Len - 1;
+			while (Len > Limit && Bin < (NumFreeBins - 1)) {
+				Bin++;
+				Limit = Limit * 2;
+			}
+			return Bin;
+		}
+
+		//  binExtent 
+		//
+		//  Adds a free extent to the bin for its size
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Index of the free extent
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	binExtent(size_t FX) {
+			size_t		Bin = binOf(FEX[FX].Len);											//  Bin index
+
+			FEX[FX].Next = FEB[Bin];
+			FEB[Bin] = FX;
+			FEBMap[Bin / 64] |= (uint64_t(1) << (Bin % 64));
+			return;
+		}
+
+		//  dropExtent 
+		//
+		//  Returns a (no longer binned) free extent to the unused extents
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Index of the free extent
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	dropExtent(size_t FX) {
+			FEX[FX].Next = FEXFree;
+			FEXFree = FX;
+			return;
+		}
+
+		//  takeExtent 
+		//
+		//  Removes and returns the best fitting free extent for the requested space
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Size of the space required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the free extent, NoExtent if there is no extent large enough
+		//
+		//  NOTES:
+		//
+		//		1.	The smallest fitting extent in the bin for the size is taken, failing that the smallest extent
+		//			in the next larger non-empty bin.
+		//
+
+		size_t	takeExtent(size_t Len) {
+			size_t		Bin = binOf(Len);													//  Bin index
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Search the bin for the size for the best fit (exact bins always fit)
+			FX = takeFromBin(Bin, Len);
+			if (FX != NoExtent) return FX;
+
+			//  Take from the next larger non-empty bin
+			for (Bin = Bin + 1; Bin < NumFreeBins; Bin++) {
+				uint64_t	Map = FEBMap[Bin / 64] >> (Bin % 64);								//  Bins that hold extents
+				if (Map == 0) {
+					Bin = ((Bin / 64) * 64) + 63;
+					continue;
+				}
+				while ((Map & 1) == 0) {
+					Map = Map >> 1;
+					Bin++;
+				}
+				return takeFromBin(Bin, Len);
+			}
+
+			//  No extent is large enough
+			return NoExtent;
+		}
+
+		//  takeFromBin 
+		//
+		//  Removes and returns the smallest extent in a bin that will hold the requested space
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Bin index
+		//		size_t			-		Size of the space required (bytes)
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Index of the free extent, NoExtent if there is no extent large enough
+		//
+		//  NOTES:
+		//
+
+		size_t	takeFromBin(size_t Bin, size_t Len) {
+			size_t*		pLink = &FEB[Bin];													//  Link to the current extent
+			size_t*		pBest = nullptr;													//  Link to the best extent
+			size_t		FX = NoExtent;														//  Free extent index
+
+			//  Locate the smallest extent that fits
+			while (*pLink != NoExtent) {
+				if (FEX[*pLink].Len >= Len && (pBest == nullptr || FEX[*pLink].Len < FEX[*pBest].Len)) {
+					pBest = pLink;
+					if (FEX[*pLink].Len == Len) break;
+				}
+				pLink = &FEX[*pLink].Next;
+			}
+			if (pBest == nullptr) return NoExtent;
+
+			//  Unlink the extent from the bin
+			FX = *pBest;
+			*pBest = FEX[FX].Next;
+			if (FEB[Bin] == NoExtent) FEBMap[Bin / 64] &= ~(uint64_t(1) << (Bin % 64));
+			return FX;
+		}
+
+		//  resetExtents 
+		//
+		//  Discards all free extents
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	resetExtents() {
+			for (size_t Bin = 0; Bin < NumFreeBins; Bin++) FEB[Bin] = NoExtent;
+			FEBMap[0] = FEBMap[1] = 0;
+			FEXEnts = 0;
+			FEXFree = NoExtent;
+			return;
+		}
+
+		//  isFragmented 
+		//
+		//  Determines if the free space inside the pool has passed the compaction threshold
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool should be compacted, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	isFragmented() {
+			size_t		Waste = SPUsed - LiveBytes;											//  Space not holding strings
+
+			if (Waste < PoolIncrement) return false;
+			return (Waste * 100) > (SPUsed * CompactPct);
+		}
+
+		//  compactPool 
+		//
+		//  Compacts the content of the pool in a single pass, discarding all free extents
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the pool was compacted, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	compactPool() {
+			char*		NewSP = nullptr;													//  Compacted pool
+			size_t		NewUsed = 0;														//  Used space in the compacted pool
+
+			//  Allocate the compacted pool
+			NewSP = (char*)malloc(SPCap);
+			if (NewSP == nullptr) return false;
+
+			//  Copy each string into the compacted pool
 			for (size_t SRX = 0; SRX < SRTHiWater; SRX++) {
-				if (SRT[SRX] == EmptySlot) return STRREF(SRX + 1);
+				if (SRT[SRX] != EmptySlot) {
+					memcpy(NewSP + NewUsed, SP + SRT[SRX], SLT[SRX] + 1);
+					SRT[SRX] = NewUsed;
+					NewUsed += SLT[SRX] + 1;
+				}
 			}
 
+			//  Replace the pool
+			free(SP);
+			SP = NewSP;
+			SPUsed = NewUsed;
+			LiveBytes = NewUsed;
+
+			//  Discard the free extents
+			resetExtents();
+
+			//  Return showing success
+			return true;
+		}
+
+		//  locateFreeStringRef 
+		//
+		//  Locates the next available string reference to use
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		STRREF			-		The available string reference for a new string
+		//
+		//  NOTES:
+		//
+		//		1.	References freed by deleteString() are reused (most recent first) before new references are issued
+		//
+
+		STRREF	locateFreeStringRef() {
+
+			//  Reuse a freed reference if one is available
+			if (FRSEnts > 0) return FRS[--FRSEnts];
+
+			//  Otherwise return the next at the hi water mark
+			if (SRTHiWater < SRTCap) return STRREF(SRTHiWater + 1);
+
 			//  SNO - no available slot was located
 			return NULLSTRREF;
 		}
+
+		//  claimFreeStringRef 
+		//
+		//  Removes a specific reference from the free reference stack
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		The reference being reused
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	A reference that has just been freed is at the top of the stack
+		//
+
+		void	claimFreeStringRef(STRREF Ref) {
+
+			for (size_t FRX = FRSEnts; FRX > 0; FRX--) {
+				if (FRS[FRX - 1] == Ref) {
+					if (FRX < FRSEnts) memmove(FRS + (FRX - 1), FRS + FRX, (FRSEnts - FRX) * sizeof(STRREF));
+					FRSEnts--;
+					return;
+				}
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  hashString 
+		//
+		//  Computes the (FNV-1a) hash of a string, optionally folding the case of the characters
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the string
+		//		size_t			-		Length of the string
+		//		bool			-		true if the case of the characters is to be folded
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The hash of the string
+		//
+		//  NOTES:
+		//
+
+		static size_t	hashString(const char* String, size_t StringLen, bool FoldCase) {
+			uint32_t	Hash = 2166136261U;													//  Hash value
+
+			for (size_t CX = 0; CX < StringLen; CX++) {
+				if (FoldCase) Hash ^= uint32_t(tolower(BYTE(String[CX])));
+				else Hash ^= uint32_t(BYTE(String[CX]));
+				Hash *= 16777619U;
+			}
+
+			return size_t(Hash);
+		}
+
+		//  indexString 
+		//
+		//  Adds a string to the exact and case-folded indexes
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	indexString(STRREF Ref) {
+			size_t		Bucket = 0;															//  Index bucket
+
+			Bucket = hashString(SP + SRT[Ref - 1], SLT[Ref - 1], false) & (HIXCap - 1);
+			HIXNext[Ref - 1] = HIX[Bucket];
+			HIX[Bucket] = Ref;
+
+			Bucket = hashString(SP + SRT[Ref - 1], SLT[Ref - 1], true) & (HIXCap - 1);
+			CIXNext[Ref - 1] = CIX[Bucket];
+			CIX[Bucket] = Ref;
+
+			//  Return to caller
+			return;
+		}
+
+		//  unindexString 
+		//
+		//  Removes a string from the exact and case-folded indexes
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		Reference to the string
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The string must still be present in the pool
+		//
+
+		void	unindexString(STRREF Ref) {
+			STRREF*		pLink = nullptr;													//  Link to the reference in the chain
+
+			pLink = &HIX[hashString(SP + SRT[Ref - 1], SLT[Ref - 1], false) & (HIXCap - 1)];
+			while (*pLink != NULLSTRREF) {
+				if (*pLink == Ref) {
+					*pLink = HIXNext[Ref - 1];
+					break;
+				}
+				pLink = &HIXNext[*pLink - 1];
+			}
+
+			pLink = &CIX[hashString(SP + SRT[Ref - 1], SLT[Ref - 1], true) & (HIXCap - 1)];
+			while (*pLink != NULLSTRREF) {
+				if (*pLink == Ref) {
+					*pLink = CIXNext[Ref - 1];
+					break;
+				}
+				pLink = &CIXNext[*pLink - 1];
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  resizeIndex 
+		//
+		//  Replaces the index buckets with the requested number of buckets and re-indexes the pool
+		//
+		//  PARAMETERS:
+		//
+		//		size_t			-		Number of buckets (power of 2)
+		//
+		//  RETURNS:
+		//
+		//		bool			-		true if the index was resized, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	resizeIndex(size_t NewBuckets) {
+			STRREF*		NewHIX = (STRREF*)malloc(NewBuckets * sizeof(STRREF));				//  New exact buckets
+			STRREF*		NewCIX = (STRREF*)malloc(NewBuckets * sizeof(STRREF));				//  New case-folded buckets
+
+			if (NewHIX == nullptr || NewCIX == nullptr) {
+				if (NewHIX != nullptr) free(NewHIX);
+				if (NewCIX != nullptr) free(NewCIX);
+				return false;
+			}
+
+			//  Replace the buckets
+			if (HIX != nullptr) free(HIX);
+			if (CIX != nullptr) free(CIX);
+			HIX = NewHIX;
+			CIX = NewCIX;
+			HIXCap = NewBuckets;
+
+			//  Rebuild the index
+			reindexPool();
+
+			//  Return showing success
+			return true;
+		}
+
+		//  reindexPool 
+		//
+		//  Rebuilds the indexes from the content of the pool
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	reindexPool() {
+
+			//  Safety
+			if (HIXCap == 0) return;
+
+			//  Clear the buckets and index every string in the pool
+			memset(HIX, 0, HIXCap * sizeof(STRREF));
+			memset(CIX, 0, HIXCap * sizeof(STRREF));
+			for (size_t SRX = 0; SRX < SRTHiWater; SRX++) {
+				if (SRT[SRX] != EmptySlot) indexString(STRREF(SRX + 1));
+			}
+
+			//  Return to caller
+			return;
+		}
 	};
 
 }
@@ -3,20 +3,25 @@
 //*																													*
 //*   File:       StringThing.h																						*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.2.0	(Build: 05)																					*
+//*   Version:    1.5.0	(Build: 08)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2017 - 2025 Ian J. Tree.														*
+//*   Copyright 2017 - 2026 Ian J. Tree.																			*
 //*******************************************************************************************************************
 //*																													*
 //*	This header file contains the definition for the StringThing class. The StringThing class provides the			*
-//* namespace encapsulation for the static xymorg string buffer manipulation primitive functions. 					*
+//* namespace encapsulation for the static xymorg string buffer manipulation primitive functions.					*
 //*																													*
 //*	USAGE:																											*
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		Sub-string searches (_search) are vectorised (SSE2/AVX2) where the platform supports it, long			*
+//*			sub-strings are searched with Boyer-Moore-Horspool skips.												*
+//*	2.		Replacements (_replace) rewrite the buffer in a single sweep, _replaceCopy() is the out-of-place		*
+//*			variant.																								*
+//*	3.		Regular expressions are compiled (Regex) into a bit-parallel NFA, _regex_match and _regex_search accept	*
+//*			either an expression or a compiled Regex.																*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -28,6 +33,9 @@
 //* 1.0.2		27/10/2022	-	Fix replacement loops in _replace													*
 //* 1.1.0		31/10/2022	-	added st_xtoi and st_xtou hex translation functions.								*
 //* 1.2.0		12/02/2025	-	added st_getdtfmt determine date/time format										*
+//* 1.3.0		19/10/2026	-	Vectorised and Horspool sub-string search in _search								*
+//* 1.4.0		19/10/2026	-	Single sweep _replace and added _replaceCopy										*
+//* 1.5.0		19/10/2026	-	Compiled (bit-parallel) regular expressions											*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -39,6 +47,15 @@
 #include		"types.h"									//  xymorg primitive types
 #include		"consts.h"									//  xymorg constants
 
+//  SIMD support for the sub-string search
+#if defined(__AVX2__)
+#include		<immintrin.h>								//  AVX2 intrinsics
+#define		XY_ST_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include		<emmintrin.h>								//  SSE2 intrinsics
+#define		XY_ST_SSE2
+#endif
+
 namespace xymorg {
 
 //
@@ -86,6 +103,10 @@ namespace xymorg {
 #define		st_strirepall(b,l,t,r)			xymorg::StringThing::_replace(b,l,t,strlen(t),r,strlen(r),true,true)
 #define		st_strnrepall(b,l,t,m,r,n)		xymorg::StringThing::_replace(b,l,t,m,r,n,true,false)
 #define		st_strnirepall(b,l,t,m,r,n)		xymorg::StringThing::_replace(b,l,t,m,r,n,true,true)
+#define		st_strrepcpy(s,l,d,z,t,r)		xymorg::StringThing::_replaceCopy(s,l,d,z,t,strlen(t),r,strlen(r),false,false)
+#define		st_strirepcpy(s,l,d,z,t,r)		xymorg::StringThing::_replaceCopy(s,l,d,z,t,strlen(t),r,strlen(r),false,true)
+#define		st_strrepallcpy(s,l,d,z,t,r)	xymorg::StringThing::_replaceCopy(s,l,d,z,t,strlen(t),r,strlen(r),true,false)
+#define		st_strirepallcpy(s,l,d,z,t,r)	xymorg::StringThing::_replaceCopy(s,l,d,z,t,strlen(t),r,strlen(r),true,true)
 #define		st_trim(s)						xymorg::StringThing::_trim(s, strlen(s))
 #define		st_ucase(s)						xymorg::StringThing::_ucase(s, strlen(s))
 #define		st_lcase(s)						xymorg::StringThing::_lcase(s, strlen(s))
@@ -184,6 +205,9 @@ namespace xymorg {
 		static const BYTE ST_ANPREC_TABLE[256];											//  Alphanumeric string format recognizer table
 		static const BYTE ST_XPREC_TABLE[256];											//  Hexadecimal string format recognizer table
 
+		//  Search Constants
+		static const size_t		SearchLongNeedle = 32;									//  Sub-string length searched with Horspool skips
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Nested Structures		                                                                                        *
@@ -200,6 +224,525 @@ namespace xymorg {
 			char*			Token[30];													//  Pointers to individual tokens
 		} Tokens;
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Nested Classes                                                                                                *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//
+		//  Regex  -  Compiled regular expression (xymorg dialect)
+		//
+		//  The expression is compiled once into a bit-parallel (extended Shift-And) NFA. Each atom of the expression becomes
+		//  one or more positions in the state vector, optional positions are entered through an epsilon closure and repeatable
+		//  positions loop on themselves. Matching and searching are linear in the length of the text.
+		//
+
+		class Regex {
+		public:
+
+			//  Limits
+			static const size_t		MaxPositions = 4096;											//  Maximum number of NFA positions
+			static const size_t		MaxPrefix = 64;													//  Maximum length of the literal prefix
+
+			//  Constructor
+			//
+			//  Compiles the passed regular expression.
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the regular expression
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		An expression that is not valid (or needs more than MaxPositions positions) never matches, see isValid().
+			//
+
+			Regex(const char* szExpr) : Words(0), pMasks(nullptr), Accept(0), PrefixLen(0) {
+				memset(Prefix, 0, sizeof(Prefix));
+				if (!compile(szExpr)) clear();
+			}
+
+			//  Move Constructor
+			Regex(Regex&& Src) : Words(Src.Words), pMasks(Src.pMasks), Accept(Src.Accept), PrefixLen(Src.PrefixLen) {
+				memcpy(Prefix, Src.Prefix, sizeof(Prefix));
+				Src.Words = 0;
+				Src.pMasks = nullptr;
+			}
+
+			//  Prevent copying and assignment
+			Regex(const Regex& Src) = delete;
+			Regex& operator = (const Regex& rhs) = delete;
+			Regex& operator = (Regex&& rhs) = delete;
+
+			//  Destructor
+			~Regex() {
+				clear();
+			}
+
+			//  isValid
+			//
+			//  Returns true if the expression was compiled
+			//
+
+			bool	isValid() const { return pMasks != nullptr; }
+
+			//  match
+			//
+			//  This function will test if the passed text matches the expression in its entirety.
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the text
+			//		size_t			-		Length of the text
+			//
+			//  RETURNS:
+			//
+			//		bool			-		true if the text matches the expression, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	match(const char* pText, size_t TextLen) const {
+				return execute(pText, TextLen, false);
+			}
+
+			//  search
+			//
+			//  This function will test if the passed text contains a sub-string that matches the expression.
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the text
+			//		size_t			-		Length of the text
+			//
+			//  RETURNS:
+			//
+			//		bool			-		true if a matching sub-string was found, otherwise false
+			//
+			//  NOTES:
+			//
+			//	1.		When the expression starts with literal characters the text is scanned for them with _search() while
+			//			no partial match is in progress.
+			//
+
+			bool	search(const char* pText, size_t TextLen) const {
+				return execute(pText, TextLen, true);
+			}
+
+		private:
+
+			//  Mask indices, the character masks occupy indices 0 - 255
+			static const size_t		RepeatMask = 256;												//  Repeatable positions
+			static const size_t		OptionalMask = 257;												//  Optional positions
+			static const size_t		EntryMask = 258;												//  Position preceding each block of optional positions
+			static const size_t		FinalMask = 259;												//  Last position of each block of optional positions
+			static const size_t		StartMask = 260;												//  Closure of the start state
+			static const size_t		MaskCount = 261;												//  Number of masks
+			static const size_t		MaxWords = MaxPositions / 64;									//  Maximum words in a state vector
+
+			size_t			Words;																	//  Words in a state vector
+			uint64_t*		pMasks;																	//  Masks (MaskCount x Words)
+			size_t			Accept;																	//  Accepting position
+			char			Prefix[MaxPrefix];														//  Literal prefix
+			size_t			PrefixLen;																//  Length of the literal prefix
+
+			//  clear
+			//
+			//  Releases the compiled expression
+			//
+
+			void	clear() {
+				if (pMasks != nullptr) free(pMasks);
+				pMasks = nullptr;
+				Words = 0;
+				PrefixLen = 0;
+				return;
+			}
+
+			//  mask
+			//
+			//  Returns a pointer to the mask at the passed index
+			//
+
+			uint64_t*	mask(size_t Index) const { return pMasks + (Index * Words); }
+
+			//  setBit
+			//
+			//  Sets the bit for a position in the mask at the passed index
+			//
+
+			void	setBit(size_t Index, size_t Pos) { mask(Index)[Pos / 64] |= uint64_t(1) << (Pos % 64); }
+
+			//  testBit
+			//
+			//  Tests the bit for a position in the mask at the passed index
+			//
+
+			bool	testBit(size_t Index, size_t Pos) const { return (mask(Index)[Pos / 64] & (uint64_t(1) << (Pos % 64))) != 0; }
+
+			//  parseAtom
+			//
+			//  This function will parse the next atom (character class and repeat qualifier) from the expression.
+			//
+			//  PARAMETERS:
+			//
+			//		char*&			-		Reference to the pointer to the expression, updated past the atom
+			//		bool*			-		Pointer to the character class (256 entries) to be filled
+			//		size_t&			-		Reference to the minimum number of occurrences
+			//		size_t&			-		Reference to the maximum number of occurrences
+			//		bool&			-		Reference to the unbounded (no maximum) indicator
+			//
+			//  RETURNS:
+			//
+			//		bool			-		true if the atom is valid, otherwise false
+			//
+			//  NOTES:
+			//
+			//	1.		The dialect supports \d, \D, \s (space or tab), \S, \<char>, [<list>], [[:alpha:]] and <char> with the
+			//			qualifiers ?, +, *, {n}, {n,} and {n,m}.
+			//
+
+			static bool	parseAtom(const char*& pExpr, bool* pClass, size_t& Min, size_t& Max, bool& Unbounded) {
+
+				memset(pClass, 0, 256 * sizeof(bool));
+				Min = 1;
+				Max = 1;
+				Unbounded = false;
+
+				//  Decode the character class
+				if (*pExpr == '\\') {
+					pExpr++;
+					switch (*pExpr) {
+					case '\0':
+						return false;
+					case 'd':
+						for (size_t CX = '0'; CX <= '9'; CX++) pClass[CX] = true;
+						break;
+					case 'D':
+						for (size_t CX = 0; CX < 256; CX++) pClass[CX] = (CX < '0' || CX > '9');
+						break;
+					case 's':
+						pClass[BYTE(' ')] = true;
+						pClass[BYTE('\t')] = true;
+						break;
+					case 'S':
+						for (size_t CX = 0; CX < 256; CX++) pClass[CX] = (CX != ' ' && CX != '\t');
+						break;
+					default:
+						pClass[BYTE(*pExpr)] = true;
+						break;
+					}
+					pExpr++;
+				}
+				else if (*pExpr == '[') {
+					pExpr++;
+					if (*pExpr == '[') {
+						//  The only group name supported is :alpha:
+						if (strncmp(pExpr, "[:alpha:]]", 10) != 0) return false;
+						for (size_t CX = 'a'; CX <= 'z'; CX++) pClass[CX] = true;
+						for (size_t CX = 'A'; CX <= 'Z'; CX++) pClass[CX] = true;
+						pExpr += 10;
+					}
+					else {
+						while (*pExpr != ']') {
+							if (*pExpr == '\0') return false;
+							pClass[BYTE(*pExpr)] = true;
+							pExpr++;
+						}
+						pExpr++;
+					}
+				}
+				else {
+					pClass[BYTE(*pExpr)] = true;
+					pExpr++;
+				}
+
+				//  Decode the repeat qualifier
+				switch (*pExpr) {
+				case '?':
+					Min = 0;
+					pExpr++;
+					break;
+				case '+':
+					Unbounded = true;
+					pExpr++;
+					break;
+				case '*':
+					Min = 0;
+					Unbounded = true;
+					pExpr++;
+					break;
+				case '{':
+					pExpr++;
+					Min = parseCount(pExpr);
+					if (*pExpr == '}') Max = Min;
+					else if (*pExpr == ',') {
+						pExpr++;
+						if (*pExpr == '}') Unbounded = true;
+						else {
+							Max = parseCount(pExpr);
+							if (*pExpr != '}' || Max < Min) return false;
+						}
+					}
+					else return false;
+					pExpr++;
+					break;
+				}
+
+				return true;
+			}
+
+			//  parseCount
+			//
+			//  Parses a (decimal) occurrence count from the expression, the count is limited to MaxPositions
+			//
+
+			static size_t	parseCount(const char*& pExpr) {
+				size_t		Count = 0;																//  Count
+
+				while (*pExpr >= '0' && *pExpr <= '9') {
+					Count = (Count * 10) + size_t(*pExpr - '0');
+					if (Count > MaxPositions) Count = MaxPositions + 1;
+					pExpr++;
+				}
+				return Count;
+			}
+
+			//  compile
+			//
+			//  This function will compile the expression into the NFA masks.
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the expression
+			//
+			//  RETURNS:
+			//
+			//		bool			-		true if the expression was compiled, otherwise false
+			//
+			//  NOTES:
+			//
+			//	1.		Position 0 is the start state. An atom with a minimum of n occurrences contributes n mandatory positions,
+			//			a bounded maximum of m contributes (m - n) optional positions and an unbounded maximum makes the last
+			//			position (optional when n is 0) repeatable.
+			//
+
+			bool	compile(const char* szExpr) {
+				bool			Class[256] = {};													//  Character class of an atom
+				size_t			Min = 0;															//  Minimum occurrences
+				size_t			Max = 0;															//  Maximum occurrences
+				bool			Unbounded = false;													//  No maximum occurrences
+				size_t			Positions = 1;														//  Number of positions
+				size_t			Count = 0;															//  Positions in an atom
+				size_t			Pos = 0;															//  Position
+				size_t			Members = 0;														//  Members of a character class
+				char			Literal = '\0';														//  Single member of a character class
+				bool			InPrefix = true;													//  Still building the literal prefix
+				const char*		pExpr = szExpr;														//  Expression
+
+				if (szExpr == nullptr) return false;
+
+				//  First pass - validate the expression and count the positions
+				while (*pExpr != '\0') {
+					if (!parseAtom(pExpr, Class, Min, Max, Unbounded)) return false;
+					Positions += Unbounded ? ((Min > 0) ? Min : 1) : Max;
+					if (Positions > MaxPositions) return false;
+				}
+
+				//  Allocate the masks
+				Words = (Positions + 63) / 64;
+				pMasks = (uint64_t*) calloc(MaskCount * Words, sizeof(uint64_t));
+				if (pMasks == nullptr) return false;
+
+				//  Second pass - build the positions
+				pExpr = szExpr;
+				Pos = 1;
+				while (*pExpr != '\0') {
+					parseAtom(pExpr, Class, Min, Max, Unbounded);
+					Count = Unbounded ? ((Min > 0) ? Min : 1) : Max;
+
+					for (size_t PX = 0; PX < Count; PX++, Pos++) {
+						for (size_t CX = 0; CX < 256; CX++) if (Class[CX]) setBit(CX, Pos);
+						if (PX >= Min) setBit(OptionalMask, Pos);
+						if (Unbounded && PX == Count - 1) setBit(RepeatMask, Pos);
+					}
+
+					//  Extend the literal prefix with the mandatory occurrences of a single character
+					if (InPrefix) {
+						Members = 0;
+						for (size_t CX = 0; CX < 256; CX++) {
+							if (Class[CX]) {
+								Members++;
+								Literal = char(CX);
+							}
+						}
+						if (Members != 1) InPrefix = false;
+						else {
+							for (size_t PX = 0; PX < Min && PrefixLen < MaxPrefix; PX++) Prefix[PrefixLen++] = Literal;
+							if (Unbounded || Max > Min || PrefixLen == MaxPrefix) InPrefix = false;
+						}
+					}
+				}
+				Accept = Positions - 1;
+
+				//  Mark the entry and final positions of each block of optional positions
+				for (Pos = 1; Pos < Positions; Pos++) {
+					if (testBit(OptionalMask, Pos)) {
+						if (!testBit(OptionalMask, Pos - 1)) setBit(EntryMask, Pos - 1);
+						if (Pos + 1 == Positions || !testBit(OptionalMask, Pos + 1)) setBit(FinalMask, Pos);
+					}
+				}
+
+				//  The start state and the optional positions that follow it
+				setBit(StartMask, 0);
+				closure(mask(StartMask));
+
+				return true;
+			}
+
+			//  closure
+			//
+			//  This function will add the optional positions that can be reached without consuming a character to a state.
+			//
+			//  PARAMETERS:
+			//
+			//		uint64_t*		-		Pointer to the state vector
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//
+			//	1.		For each block of optional positions the subtraction of the entry bit carries from the lowest active
+			//			position up to the final bit of the block, filling the block from there in one step.
+			//
+
+			void	closure(uint64_t* pState) const {
+				const uint64_t*	pO = mask(OptionalMask);											//  Optional positions
+				const uint64_t*	pI = mask(EntryMask);												//  Entry positions
+				const uint64_t*	pF = mask(FinalMask);												//  Final positions
+				uint64_t		Borrow = 0;															//  Borrow between words
+				uint64_t		Df = 0;																//  State with the final positions
+				uint64_t		Diff = 0;															//  Difference
+
+				for (size_t WX = 0; WX < Words; WX++) {
+					Df = pState[WX] | pF[WX];
+					Diff = Df - pI[WX];
+					uint64_t	NextBorrow = (Df < pI[WX]) ? 1 : 0;
+					if (Diff < Borrow) NextBorrow = 1;
+					Diff -= Borrow;
+					Borrow = NextBorrow;
+					pState[WX] |= pO[WX] & ((~Diff) ^ Df);
+				}
+				return;
+			}
+
+			//  execute
+			//
+			//  This function will run the NFA over the passed text.
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the text
+			//		size_t			-		Length of the text
+			//		bool			-		true to search for a matching sub-string, false to match the entire text
+			//
+			//  RETURNS:
+			//
+			//		bool			-		true if the text matched, otherwise false
+			//
+			//  NOTES:
+			//
+			//	1.		Each character advances the active positions by one (or keeps the repeatable ones) where the character
+			//			is in their class, the closure then adds the optional positions. A search re-enters the start state
+			//			at every character.
+			//
+
+			bool	execute(const char* pText, size_t TextLen, bool Search) const {
+				uint64_t		State[MaxWords] = {};												//  Active positions
+				const uint64_t*	pStart = nullptr;													//  Start state
+				const uint64_t*	pRepeat = nullptr;													//  Repeatable positions
+				const uint64_t*	pChar = nullptr;													//  Positions accepting the character
+				const size_t	AW = Accept / 64;													//  Word holding the accepting position
+				const uint64_t	AB = uint64_t(1) << (Accept % 64);									//  Bit of the accepting position
+				const char*		pFound = nullptr;													//  Occurrence of the literal prefix
+				uint64_t		Carry = 0;															//  Carry between words
+				uint64_t		Active = 0;															//  Any position active
+
+				if (pMasks == nullptr) return false;
+				if (pText == nullptr) TextLen = 0;
+				pStart = mask(StartMask);
+				pRepeat = mask(RepeatMask);
+
+				//  Single word state (up to 63 positions)
+				if (Words == 1) {
+					const uint64_t	O = *mask(OptionalMask);										//  Optional positions
+					const uint64_t	I = *mask(EntryMask);											//  Entry positions
+					const uint64_t	F = *mask(FinalMask);											//  Final positions
+					const uint64_t	R = *pRepeat;													//  Repeatable positions
+					const uint64_t	S = *pStart;													//  Start state
+					uint64_t		D = S;															//  Active positions
+					uint64_t		Df = 0;															//  Active with the final positions
+
+					if (Search && (D & AB) != 0) return true;
+					for (size_t TX = 0; TX < TextLen; TX++) {
+
+						//  Skip to the next occurrence of the literal prefix when no match is in progress
+						if (Search && PrefixLen > 0 && D == S) {
+							pFound = StringThing::_search(pText + TX, TextLen - TX, Prefix, PrefixLen, false);
+							if (pFound == nullptr) return false;
+							TX = size_t(pFound - pText);
+						}
+
+						D = pMasks[BYTE(pText[TX])] & ((D << 1) | (D & R));
+						Df = D | F;
+						D |= O & ((~(Df - I)) ^ Df);
+						if (Search) {
+							D |= S;
+							if ((D & AB) != 0) return true;
+						}
+						else if (D == 0) return false;
+					}
+					return (D & AB) != 0;
+				}
+
+				//  Multiple word state
+				memcpy(State, pStart, Words * sizeof(uint64_t));
+				if (Search && (State[AW] & AB) != 0) return true;
+				for (size_t TX = 0; TX < TextLen; TX++) {
+
+					//  Skip to the next occurrence of the literal prefix when no match is in progress
+					if (Search && PrefixLen > 0 && memcmp(State, pStart, Words * sizeof(uint64_t)) == 0) {
+						pFound = StringThing::_search(pText + TX, TextLen - TX, Prefix, PrefixLen, false);
+						if (pFound == nullptr) return false;
+						TX = size_t(pFound - pText);
+					}
+
+					//  Advance the active positions
+					pChar = mask(BYTE(pText[TX]));
+					Carry = 0;
+					Active = 0;
+					for (size_t WX = 0; WX < Words; WX++) {
+						uint64_t	Shifted = (State[WX] << 1) | Carry;
+						Carry = State[WX] >> 63;
+						State[WX] = pChar[WX] & (Shifted | (State[WX] & pRepeat[WX]));
+					}
+					closure(State);
+					for (size_t WX = 0; WX < Words; WX++) {
+						if (Search) State[WX] |= pStart[WX];
+						Active |= State[WX];
+					}
+					if (Search) {
+						if ((State[AW] & AB) != 0) return true;
+					}
+					else if (Active == 0) return false;
+				}
+				return (State[AW] & AB) != 0;
+			}
+		};
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Public Functions                                                                                              *
@@ -236,6 +779,8 @@ namespace xymorg {
 		//
 		//		The algorithm searches the search space (1) for each candidate string that matches the first and last character of the sub-string (2) irrespective of case.
 		//		Candidate strings are then checked for a match in their entirety.
+		//		Where SSE2/AVX2 is available the candidates are found 16/32 positions at a time by comparing both cases of the first and last characters in-register.
+		//		Sub-strings of SearchLongNeedle or more characters are searched with Boyer-Moore-Horspool skips.
 		//
 
 		static const char* _search(const char* pString, size_t HLen, const char* pSubString, size_t Len, bool SCI) {
@@ -244,10 +789,8 @@ namespace xymorg {
 			char			CEL = '\0';																	//  Ending character of the sub-string in lower case
 			char			CEU = '\0';																	//  Ending character of the sub-string in upper case
 			size_t			Span = 0;																	//  The span betwwen the first and last character characters of the sub-string
-			size_t			LtoS = HLen;																//  Length of the haystack that is available to search
 			const char*		pCandidate = nullptr;														//  Pointer to a candidate matched string
 			const char*		pAltCandidate = nullptr;													//  Alternative candidate matched string
-			const char*		pMatch = nullptr;															//  Matching sub-string pointer
 
 			//  Contract envelope checks
 			if (pString == nullptr) return nullptr;
@@ -273,58 +816,24 @@ namespace xymorg {
 
 			//  Trivial case - the search sub string is a single character long. Return the first ocurrence of the upper or lower case character
 			if (Span == 0) {
-				pCandidate = (const char*) memchr(pString, CEL, LtoS);
-				pAltCandidate = (const char*) memchr(pString, CEU, LtoS);
+#if defined(XY_ST_AVX2) || defined(XY_ST_SSE2)
+				if (CEL != CEU) return searchVector(pString, HLen, pSubString, Len, SCI, CSL, CSU, CEL, CEU);
+#endif
+				pCandidate = (const char*) memchr(pString, CEL, HLen);
+				pAltCandidate = (const char*) memchr(pString, CEU, HLen);
 				if (pCandidate == nullptr || (pAltCandidate < pCandidate && pAltCandidate != nullptr)) pCandidate = pAltCandidate;
 				return pCandidate;
 			}
 
-			//  Initialise the search position
-			pCandidate = (const char*) memchr(pString + Span, CEL, LtoS - Span);
-			pAltCandidate =  (const char*) memchr(pString + Span, CEU, LtoS - Span);
-			if (pCandidate == nullptr || (pAltCandidate < pCandidate && pAltCandidate != nullptr)) pCandidate = pAltCandidate;
+			//  Long sub-strings - skip through the search space
+			if (Len >= SearchLongNeedle) return searchHorspool(pString, HLen, pSubString, Len, SCI);
 
-			//  Main search loop - continue detecting candidate strings within the search space until it is exhauseted
-			while (pCandidate != nullptr) {
-				//  Determine if a real candidate has been detected
-				if (*(pCandidate - Span) == CSL || *(pCandidate - Span) == CSU) {
-					pAltCandidate = (pCandidate - Span) + 1;
-					pMatch = pSubString + 1;
-					size_t CComp = 2;
-					if (SCI) {
-						//  Case insensitive compare
-						while (CComp < Len && tolower(*pAltCandidate) == tolower(*pMatch)) {
-							pMatch++;
-							pAltCandidate++;
-							CComp++;
-						}
-					}
-					else {
-						//  Case sensitive compare
-						while (CComp < Len && (*pAltCandidate == *pMatch)) {
-							pMatch++;
-							pAltCandidate++;
-							CComp++;
-						}
-					}
-
-					//  If the complete string was matched then return the pointer to the start of the matched string in the search space
-					if (CComp == Len) return pCandidate - Span;
-				}
-
-				//  The current candidate is not matched - move on to the next candidate
-				pAltCandidate = ++pCandidate;
-				if (size_t(pCandidate - pString) >= HLen) pCandidate = nullptr;
-				else {
-					LtoS = HLen - (pCandidate - pString);
-					pCandidate = (const char*)memchr(pCandidate, CEL, LtoS);
-					pAltCandidate = (const char*)memchr(pAltCandidate, CEU, LtoS);
-					if (pCandidate == nullptr || (pAltCandidate < pCandidate && pAltCandidate != nullptr)) pCandidate = pAltCandidate;
-				}
-			}
-
-			//  Sub-string was not found in the search space - return nullptr
-			return nullptr;
+#if defined(XY_ST_AVX2) || defined(XY_ST_SSE2)
+			//  Vectorised search for the candidates
+			return searchVector(pString, HLen, pSubString, Len, SCI, CSL, CSU, CEL, CEU);
+#else
+			return searchScalar(pString, HLen, pSubString, Len, SCI, CSL, CSU, CEL, CEU);
+#endif
 		}
 
 		//  _search
@@ -613,11 +1122,16 @@ namespace xymorg {
 		//
 		//  API Use Notes:
 		//
+		//		1.	The buffer is assumed to be large enough to hold the content after replacement.
+		//		2.	The content is rewritten in a single forward sweep. When the replacement is longer than the text the
+		//			occurrences are counted first and the content is moved up by the growth so that the sweep never
+		//			overtakes the unread content.
+		//		3.	Replacement text is never rescanned, occurrences are those found in the original content.
+		//
 
 		static size_t _replace(char *pBuffer, size_t ContentSize, const char *szText, size_t TextLen, const char *szNewText, size_t NewTextLen, bool RemoveAll, bool CaseInsensitive) {
 			size_t		NewSize = ContentSize;																	//  New size of the buffer contents
-			char		*pToken = nullptr;																		//  Pointer to the token in the buffer Token
-			bool		LoopDefeat = false;																		//  Loop prevention is needed
+			size_t		Growth = 0;																				//  Growth of the buffer contents
 
 			//  Contract envelope checks
 			if (pBuffer == nullptr) return 0;
@@ -625,60 +1139,75 @@ namespace xymorg {
 			if (TextLen == 0) return NewSize;
 			if (szNewText == nullptr) NewTextLen = 0;
 
-			//  Loop detection/protection
-			if (CaseInsensitive) {
-				if (NewTextLen > 0) {
-					if (NewTextLen == TextLen) {
-						//  Replacement text must not be equal to the original text
-						if (strcmp(szText, szNewText) == 0) return NewSize;
-					}
-					else if (NewTextLen > TextLen) {
-						//  Replacement text must not contain the original text
-						if (st_stristr(szNewText, szText) != nullptr) LoopDefeat = true;
-					}
-				}
-			}
-			else {
-				if (NewTextLen > 0) {
-					if (NewTextLen == TextLen) {
-						//  Replacement text must not be equal to the original text
-						if (strcmp(szText, szNewText) == 0) return NewSize;
-					}
-					else if (NewTextLen > TextLen) {
-						//  Replacement text must not contain the original text
-						if (strstr(szNewText, szText) != nullptr) LoopDefeat = true;
-					}
-				}
+			//  Replacement text that is equal to the original text leaves the content unchanged
+			if (NewTextLen == TextLen && memcmp(szText, szNewText, TextLen) == 0) return NewSize;
+
+			//  Growing replacement - move the content up by the total growth
+			if (NewTextLen > TextLen) {
+				Growth = countMatches(pBuffer, NewSize, szText, TextLen, RemoveAll, CaseInsensitive) * (NewTextLen - TextLen);
+				if (Growth == 0) return NewSize;
+				memmove(pBuffer + Growth, pBuffer, NewSize + 1);
 			}
 
-			//  Locate the first occurrence of the string in the buffer
-			if (CaseInsensitive) pToken = st_memimem(pBuffer, NewSize, szText, TextLen);
-			else pToken = st_memmem(pBuffer, NewSize, szText, TextLen);
+			//  Rewrite the content from the start of the buffer
+			NewSize = replaceForward(pBuffer + Growth, NewSize, pBuffer, szText, TextLen, szNewText, NewTextLen, RemoveAll, CaseInsensitive);
+			pBuffer[NewSize] = '\0';
 
-			//  Process all (or only the first of the matches)
-			while (pToken != nullptr) {
-				//  Snip the text from the buffer
-				NewSize = _snip(pBuffer, NewSize, pToken, TextLen);
+			//  Return the updated size
+			return NewSize;
+		}
 
-				//  If there is replacement text then inject it into the buffer 
-				if (szNewText != nullptr && NewTextLen > 0) NewSize = _inject(pBuffer, NewSize, pToken, szNewText, NewTextLen);
+		//  _replaceCopy
+		//
+		//  This function will copy the passed source text to the destination buffer replacing all or only the first occurrences
+		//  of the passed text array with the replacement text.
+		//  The text comparison may be case insensitive, determined by the flags
+		//
+		//  Parameters
+		//
+		//  1  -  char *				-  Const pointer to the source text
+		//  2  -  size_t				-  Length of the source text
+		//  3  -  char *				-  Pointer to the destination buffer
+		//  4  -  size_t				-  Size of the destination buffer
+		//  5  -  char *				-  Const pointer to the text to be removed
+		//  6  -  size_t				-  Length of the text to be removed
+		//  7  -  char *				-  Const pointer to the replacement text
+		//  8  -  size_t				-  Length of the replacement text
+		//  9  -  bool					-  If true replace all occurrences otherwise only replace the first occurrence
+		//  10 -  bool					-  If true then perform the case insensitive string matching otherwise perform an exact match
+		//
+		//  Returns
+		//
+		//		size_t				-  the length of the content after replacement
+		//
+		//  API Use Notes:
+		//
+		//		1.	As with snprintf() the content is only written (with a string terminator) if the destination buffer is
+		//			larger than the returned length, a destination of nullptr may be passed to determine the size needed.
+		//		2.	The source and destination must not overlap.
+		//
 
-				//  Move on to the next occurrence unless only doing the first one.
-				//  This must be done safely to avoid recursion on the injected (replacement) sub-string
-				if (RemoveAll) {
-					size_t	RemainingSize = NewSize;
-					if (LoopDefeat) pToken += NewTextLen;
-					RemainingSize = RemainingSize - (pToken - pBuffer);
-					if (RemainingSize < TextLen) pToken = nullptr;
-					else {
-						if (CaseInsensitive) pToken = st_memimem(pToken, RemainingSize, szText, TextLen);
-						else pToken = st_memmem(pToken, RemainingSize, szText, TextLen);
-					}
-				}
-				else pToken = nullptr;
+		static size_t _replaceCopy(const char* pSource, size_t SourceLen, char* pDest, size_t DestSize, const char* szText, size_t TextLen, const char* szNewText, size_t NewTextLen, bool RemoveAll, bool CaseInsensitive) {
+			size_t		NewSize = SourceLen;																	//  Size of the content after replacement
+			size_t		Matches = 0;																			//  Number of occurrences replaced
+
+			//  Contract envelope checks
+			if (pSource == nullptr) return 0;
+			if (szNewText == nullptr) NewTextLen = 0;
+
+			//  Determine the size of the replaced content
+			if (szText != nullptr && TextLen > 0 && NewTextLen != TextLen) {
+				Matches = countMatches(pSource, SourceLen, szText, TextLen, RemoveAll, CaseInsensitive);
+				NewSize = (SourceLen + (Matches * NewTextLen)) - (Matches * TextLen);
 			}
+			if (pDest == nullptr || DestSize <= NewSize) return NewSize;
 
-			//  Return the updated size
+			//  Copy the content with the replacements
+			if (szText == nullptr || TextLen == 0) memcpy(pDest, pSource, SourceLen);
+			else replaceForward(pSource, SourceLen, pDest, szText, TextLen, szNewText, NewTextLen, RemoveAll, CaseInsensitive);
+			pDest[NewSize] = '\0';
+
+			//  Return the size
 			return NewSize;
 		}
 
@@ -785,23 +1314,6 @@ namespace xymorg {
 			return false;
 		}
 
-		//  LOCAL DEFINITIONS
-		//
-		//  Encoded tests for regex evaluation
-		//
-
-	#define		RTEST_NUMERICS				10																		//  Test for numerics
-	#define		RTEST_NON_NUMERICS			20																		//  Test for non-numerics
-	#define		RTEST_CHAR					30																		//  Test for a specific character
-	#define		RTEST_LIST					40																		//  Test against a list of characters
-
-	#define		RTEST_COND_NONEORMORE		100																		//  0 or more occurrences
-	#define		RTEST_COND_ONEORMORE		110																		//  1 or more occurrences
-	#define		RTEST_COND_NONEORONE		120																		//  0 or 1 occurrences
-	#define		RTEST_COND_N				130																		//  n occurrences
-	#define		RTEST_COND_NORMORE			140																		//  n or more occurrences
-	#define		RTEST_COND_NTOM				150																		//  n to m occurrences
-
 		//  _regex_match
 		//
 		//  This function will test if the passed string matces the regular expression pattern provided.
@@ -819,785 +1331,47 @@ namespace xymorg {
 		//  API Use Notes:
 		//
 		//  THIS IS AN EXTREMELY LIMITED IMPLEMENTATION OF REGEX EVALUATION
-		//  IT SHOULD BE NOTED THAT THIS IMPLEMENTATION DOES NOT PERFORM "GIVE BACK" FROM GREEDY MATCHES
+		//  The expression is compiled for each call, use a Regex (or the overload below) to match many texts against one expression.
 		//
 
-		static bool _regex_match(const char *pText, size_t TextLen, const char *szExpr) {
-			const char			*pEval = pText;																//  Current evaluation point in the text string
-			const char			*pExpr = szExpr;															//  Current expression being evaluated
-			int					TestFor = 0;																//  Test type to apply
-			char				TestChar = 0;																//  Character to test for
-			char				TList[257] = {};															//  List to test against
-			size_t				NList = 0;																	//  Number of characters in the test list
-			int					TestCond = 0;																//  Test condition
-			int					TestCondMax = 0;															//  Test condition maximum 
-			int					TestCondMin = 0;															//  Test condition minimum (or absolute count)
-			size_t				CCount = 0;																	//  Number of characters used in the evaluation string
-
-			//  Process each expression until the expression string is exhausted
-			while (*pExpr != '\0') {
-
-				//  Decode the current test in the expression
-				//  Determine the form of the introducer
-				if (*pExpr == '\\') {
-					//  Escape sequence
-					pExpr++;
-					if (*pExpr == 'd') TestFor = RTEST_NUMERICS;
-					else {
-						if (*pExpr == 'D') TestFor = RTEST_NON_NUMERICS;
-						else {
-							if (*pExpr == 's') {
-								//  Whitespace - ' ' or tab
-								TestFor = RTEST_LIST;
-								NList = 2;
-								TList[0] = ' ';
-								TList[1] = 9;
-							}
-							else {
-								if (*pExpr == 'S') {
-									//  Non-whitespace
-									TestFor = RTEST_LIST;
-									for (NList = 0; NList < 256; NList++) {
-										if (NList == 9 || NList == ' ') TList[NList] = '?';
-										else TList[NList] = char(NList);
-									}
-									NList = 254;
-								}
-								else {
-									//  This is a character to test for
-									TestFor = RTEST_CHAR;
-									TestChar = *pExpr;
-								}
-							}
-						}
-					}
-					pExpr++;
-				}
-				else {
-					if (*pExpr == '[') {
-						//  List
-						pExpr++;
-						TestFor = RTEST_LIST;
-						if (*pExpr == '[') {
-							//  This is a group name
-							//  The only group we support (for the moment is :alpha:
-							if (strncmp(pExpr, "[:alpha:]", 9) == 0) {
-								strcpy_s(TList, 257, "abcdefghijklmnopqrstuvwxyz");
-								strcat_s(TList, 257, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
-								NList = strlen(TList);
-								while (*pExpr != ']' && *pExpr != '\0') pExpr++;
-								while (*pExpr == ']') pExpr++;
-							}
-							else return false;
-						}
-						else {
-							//  Populate the list
-							NList = 0;
-							while (*pExpr != ']') {
-								TList[NList] = *pExpr;
-								NList++;
-								pExpr++;
-							}
-							pExpr++;
-						}
-					}
-					else {
-						//  Character test
-						TestFor = RTEST_CHAR;
-						TestChar = *pExpr;
-						pExpr++;
-					}
-				}
-
-				//
-				//  The introducer has been digested now test for a repeat qualifier
-				//
-
-				TestCond = RTEST_COND_N;
-				TestCondMin = 1;
-				TestCondMax = 1;
-
-				if (*pExpr == '?') {
-					TestCond = RTEST_COND_NONEORONE;
-					pExpr++;
-				}
-				else {
-					if (*pExpr == '+') {
-						TestCond = RTEST_COND_ONEORMORE;
-						pExpr++;
-					}
-					else {
-						if (*pExpr == '*') {
-							TestCond = RTEST_COND_NONEORMORE;
-							pExpr++;
-						}
-						else {
-							if (*pExpr == '{') {
-								pExpr++;
-								TestCondMin = 0;
-								TestCondMax = 0;
-
-								//  Get the minimum occurrence count
-								while (*pExpr >= '0' && *pExpr <= '9') {
-									TestCondMin = (TestCondMin * 10) + (*pExpr - '0');
-									pExpr++;
-								}
-
-								if (*pExpr == '}') {
-									TestCond = RTEST_COND_N;
-									pExpr++;
-								}
-								else {
-									if (*pExpr == ',') {
-										pExpr++;
-										if (*pExpr == '}') {
-											TestCond = RTEST_COND_NORMORE;
-											pExpr++;
-										}
-										else {
-											TestCond = RTEST_COND_NTOM;
-											TestCondMax = 0;
-
-											while (*pExpr >= '0' && *pExpr <= '9') {
-												TestCondMax = (TestCondMax * 10) + (*pExpr - '0');
-												pExpr++;
-											}
-
-											if (*pExpr == '}') pExpr++;
-											else return false;										//  Invalid expression
-										}
-									}
-									else return false;												//  Invalid expression
-								}
-							}
-						}
-					}
-				}
-
-				//
-				//  The next atomic test condition has been encoded, test this against the current position in the test string.
-				//  The atomic tests are greedy they will consume as musch of the test string as possible
-				//
-
-				bool			TestEval = true;
-				int				Found = 0;
-
-				switch (TestCond) {
-
-				case RTEST_COND_NONEORONE:
-					//
-					//  Test for none or one ocurrenses of the specified character or type
-					//  This test NEVER fails it only consumes a single character matching the specification
-					//
-					if (CCount < TextLen) {
-						if (TestFor == RTEST_NUMERICS && (*pEval >= '0' && *pEval <= '9')) {
-							pEval++;
-							CCount++;
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS && (*pEval < '0' || *pEval > '9')) {
-								pEval++;
-								CCount++;
-							}
-							else {
-								if (TestFor == RTEST_CHAR && *pEval == TestChar) {
-									pEval++;
-									CCount++;
-								}
-								else {
-									if (memchr(TList, *pEval, NList) != nullptr) {
-										pEval++;
-										CCount++;
-									}
-								}
-							}
-						}
-					}
-					break;
-
-				case RTEST_COND_NONEORMORE:
-					//
-					//  Test for none or more occurrebces of the specified character or type
-					//  This test NEVER fails it only consumes as many characters of the matching type or value as possible
-					//
-					if (CCount < TextLen) {
-						if (TestFor == RTEST_NUMERICS) {
-							while (*pEval >= '0' && *pEval <= '9') {
-								pEval++;
-								CCount++;
-							}
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS) {
-								while (*pEval != '\0' && (*pEval < '0' || *pEval > '9')) {
-									pEval++;
-									CCount++;
-								}
-							}
-							else {
-								if (TestFor == RTEST_CHAR) {
-									while (*pEval == TestChar) {
-										pEval++;
-										CCount++;
-									}
-								}
-								else {
-									while (memchr(TList, *pEval, NList) != nullptr) {
-										pEval++;
-										CCount++;
-									}
-								}
-							}
-						}
-					}
-					break;
-
-				case RTEST_COND_ONEORMORE:
-					//
-					//  Test for one or more occurrences of the specified character or type
-					//  This test WILL fail if there is not at least one match
-					//
-					if (CCount == TextLen) TestEval = false;
-					else {
-						if (TestFor == RTEST_NUMERICS) {
-							while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9') Found++;
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS) {
-								while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9')) Found++;
-							}
-							else {
-								if (TestFor == RTEST_CHAR) {
-									while (*(pEval + Found) == TestChar) Found++;
-								}
-								else {
-									while (memchr(TList, *(pEval + Found), NList) != nullptr) Found++;
-								}
-							}
-						}
-					}
-					if (Found > 0) {
-						pEval += Found;
-						CCount += Found;
-					}
-					else TestEval = false;
-					break;
-
-				case RTEST_COND_N:
-					//
-					//  Test for n occurrences of the specified character or type
-					//  This test WILL fail if less than n ocuurences were evaluated
-					//
-					if (CCount == TextLen) TestEval = false;
-					else {
-						if (TestFor == RTEST_NUMERICS) {
-							while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9' && Found < TestCondMin) Found++;
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS) {
-								while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9') && Found < TestCondMin) Found++;
-							}
-							else {
-								if (TestFor == RTEST_CHAR) {
-									while (*(pEval + Found) == TestChar && Found < TestCondMin) Found++;
-								}
-								else {
-									while (memchr(TList, *(pEval + Found), NList) != nullptr && Found < TestCondMin) Found++;
-								}
-							}
-						}
-					}
-					if (Found == TestCondMin) {
-						pEval += Found;
-						CCount += Found;
-					}
-					else TestEval = false;
-					break;
-
-				case RTEST_COND_NORMORE:
-					//  
-					//  Test for n or more occurrences of the specified character or type
-					//  This test WILL fail if there are less than n occurrences
-					//
-					if (CCount == TextLen) TestEval = false;
-					else {
-						if (TestFor == RTEST_NUMERICS) {
-							while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9') Found++;
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS) {
-								while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9')) Found++;
-							}
-							else {
-								if (TestFor == RTEST_CHAR) {
-									while (*(pEval + Found) == TestChar) Found++;
-								}
-								else {
-									while (memchr(TList, *(pEval + Found), NList) != nullptr) Found++;
-								}
-							}
-						}
-					}
-
-					if (Found >= TestCondMin) {
-						pEval += Found;
-						CCount += Found;
-					}
-					else TestEval = false;
-					break;
-
-				case RTEST_COND_NTOM:
-					//
-					//  Test for n <= occurrences <= m of the specified character or type
-					//  This test WILL fail if there are less than the minimum
-					//
-					if (CCount == TextLen) TestEval = false;
-					else {
-						if (TestFor == RTEST_NUMERICS) {
-							while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9' && Found < TestCondMax) Found++;
-						}
-						else {
-							if (TestFor == RTEST_NON_NUMERICS) {
-								while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9') && Found < TestCondMax) Found++;
-							}
-							else {
-								if (TestFor == RTEST_CHAR) {
-									while (*(pEval + Found) == TestChar && Found < TestCondMax) Found++;
-								}
-								else {
-									while (memchr(TList, *(pEval + Found), NList) != nullptr && Found < TestCondMax) Found++;
-								}
-							}
-						}
-					}
-					if (Found >= TestCondMin) {
-						pEval += Found;
-						CCount += Found;
-					}
-					else TestEval = false;
-					break;
-
-				}
-
-				//  If the evaluation of the test failed then no match 
-				if (!TestEval) return false;
-
-			}      //  Evaluating the regular expression
-
-			//  For a match both the evaluated string and the expression must be exhausted
-			if (*pEval != '\0') return false;
-
-			//  Signal a match
-			return true;
-		}
-
-		//  _regex_search
-		//
-		//  This function will test if the passed string contains a sub-string that matches the regular expression pattern provided.
-		//
-		//  Parameters
-		//
-		//  1  -  char *				-  Const Pointer to the text to be searched
-		//  2  -  size_t				-  Size of text in the buffer
-		//  3  -  char *				-  Const pointer to the pattern mask
-		//
-		//  Returns
-		//
-		//		bool				-  true if the text matches the pattern expression otherwise false
-		//
-		//  API Use Notes:
-		//
-		//  THIS IS AN EXTREMELY LIMITED IMPLEMENTATION OF REGEX EVALUATION
-		//  IT SHOULD BE NOTED THAT THIS IMPLEMENTATION DOES NOT PERFORM "GIVE BACK" FROM GREEDY MATCHES
-		//
-
-		static bool _regex_search(const char *pText, size_t TextLen, const char *szExpr) {
-			const char			*pStartString = pText;														//  Start position in the string to be tested for a match
-			const char			*pEval = nullptr;															//  Current evaluation point in the text string
-			const char			*pExpr = nullptr;															//  Current expression being evaluated
-			int					TestFor = 0;																//  Test type to apply
-			char				TestChar = 0;																//  Character to test for
-			char				TList[257] = {};															//  List to test against
-			size_t				NList = 0;																	//  Number of characters in the test list
-			int					TestCond = 0;																//  Test condition
-			int					TestCondMax = 0;															//  Test condition maximum 
-			int					TestCondMin = 0;															//  Test condition minimum (or absolute count)
-			bool				TestEval = true;
-			size_t				CCount = 0;																	//  Number of characters used in the evaluation string
-
-			//  Test possible start positions in the string until a match is found
-			while (*pStartString != '\0') {
-
-				//  Setup to perform the match
-				pEval = pStartString;
-				pExpr = szExpr;
-				TestEval = true;
-				CCount = 0;
-
-				//std::cout << "TRACE: Evaluating string: '" << pEval << "'." << std::endl;
-
-				//  Process each expression until the expression string is exhausted
-				while (*pExpr != '\0' && TestEval) {
-
-					//std::cout << "TRACE: Expression: '" << pExpr << "' against string: '" << pEval << "' ";
-
-					//  Decode the current test in the expression
-					//  Determine the form of the introducer
-					if (*pExpr == '\\') {
-						//  Escape sequence
-						pExpr++;
-						if (*pExpr == 'd') TestFor = RTEST_NUMERICS;
-						else {
-							if (*pExpr == 'D') TestFor = RTEST_NON_NUMERICS;
-							else {
-								if (*pExpr == 's') {
-									//  Whitespace - ' ' or tab
-									TestFor = RTEST_LIST;
-									NList = 2;
-									TList[0] = ' ';
-									TList[1] = 9;
-								}
-								else {
-									if (*pExpr == 'S') {
-										//  Non-whitespace
-										TestFor = RTEST_LIST;
-										for (NList = 0; NList < 256; NList++) {
-											if (NList == 9 || NList == ' ') TList[NList] = '?';
-											else TList[NList] = char(NList);
-										}
-										NList = 254;
-									}
-									else {
-										//  This is a character to test for
-										TestFor = RTEST_CHAR;
-										TestChar = *pExpr;
-									}
-								}
-							}
-						}
-						pExpr++;
-					}
-					else {
-						if (*pExpr == '[') {
-							//  List
-							pExpr++;
-							TestFor = RTEST_LIST;
-							if (*pExpr == '[') {
-								//  This is a group name
-								//  The only group we support (for the moment is :alpha:
-								if (strncmp(pExpr, "[:alpha:]", 9) == 0) {
-									strcpy_s(TList, 257, "abcdefghijklmnopqrstuvwxyz");
-									strcat_s(TList, 257, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
-									NList = strlen(TList);
-									while (*pExpr != ']' && *pExpr != '\0') pExpr++;
-									while (*pExpr == ']') pExpr++;
-								}
-								else return false;
-							}
-							else {
-								//  Populate the list
-								NList = 0;
-								while (*pExpr != ']') {
-									TList[NList] = *pExpr;
-									NList++;
-									pExpr++;
-								}
-								pExpr++;
-							}
-						}
-						else {
-							//  Character test
-							TestFor = RTEST_CHAR;
-							TestChar = *pExpr;
-							pExpr++;
-						}
-					}
-
-					//
-					//  The introducer has been digested now test for a repeat qualifier
-					//
-
-					TestCond = RTEST_COND_N;
-					TestCondMin = 1;
-					TestCondMax = 1;
-
-					if (*pExpr == '?') {
-						TestCond = RTEST_COND_NONEORONE;
-						pExpr++;
-					}
-					else {
-						if (*pExpr == '+') {
-							TestCond = RTEST_COND_ONEORMORE;
-							pExpr++;
-						}
-						else {
-							if (*pExpr == '*') {
-								TestCond = RTEST_COND_NONEORMORE;
-								pExpr++;
-							}
-							else {
-								if (*pExpr == '{') {
-									pExpr++;
-									TestCondMin = 0;
-									TestCondMax = 0;
-
-									//  Get the minimum occurrence count
-									while (*pExpr >= '0' && *pExpr <= '9') {
-										TestCondMin = (TestCondMin * 10) + (*pExpr - '0');
-										pExpr++;
-									}
-
-									if (*pExpr == '}') {
-										TestCond = RTEST_COND_N;
-										pExpr++;
-									}
-									else {
-										if (*pExpr == ',') {
-											pExpr++;
-											if (*pExpr == '}') {
-												TestCond = RTEST_COND_NORMORE;
-												pExpr++;
-											}
-											else {
-												TestCond = RTEST_COND_NTOM;
-												TestCondMax = 0;
-
-												while (*pExpr >= '0' && *pExpr <= '9') {
-													TestCondMax = (TestCondMax * 10) + (*pExpr - '0');
-													pExpr++;
-												}
-
-												if (*pExpr == '}') pExpr++;
-												else return false;										//  Invalid expression
-											}
-										}
-										else return false;												//  Invalid expression
-									}
-								}
-							}
-						}
-					}
-
-					//
-					//  The next atomic test condition has been encoded, test this against the current position in the test string.
-					//  The atomic tests are greedy they will consume as musch of the test string as possible
-					//
-
-					//std::cout << " (COND: " << TestCond << ") ";
-
-					int				Found = 0;
-
-					switch (TestCond) {
-
-					case RTEST_COND_NONEORONE:
-						//
-						//  Test for none or one ocurrenses of the specified character or type
-						//  This test NEVER fails it only consumes a single character matching the specification
-						//
-						if (CCount < TextLen) {
-							if (TestFor == RTEST_NUMERICS && (*pEval >= '0' && *pEval <= '9')) {
-								pEval++;
-								CCount++;
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS && (*pEval < '0' || *pEval > '9')) {
-									pEval++;
-									CCount++;
-								}
-								else {
-									if (TestFor == RTEST_CHAR && *pEval == TestChar) {
-										pEval++;
-										CCount++;
-									}
-									else {
-										if (memchr(TList, *pEval, NList) != nullptr) {
-											pEval++;
-											CCount++;
-										}
-									}
-								}
-							}
-						}
-						break;
-
-					case RTEST_COND_NONEORMORE:
-						//
-						//  Test for none or more occurrebces of the specified character or type
-						//  This test NEVER fails it only consumes as many characters of the matching type or value as possible
-						//
-						if (CCount < TextLen) {
-							if (TestFor == RTEST_NUMERICS) {
-								while (*pEval >= '0' && *pEval <= '9') {
-									pEval++;
-									CCount++;
-								}
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS) {
-									while (CCount < TextLen && (*pEval < '0' || *pEval > '9')) {
-										pEval++;
-										CCount++;
-									}
-								}
-								else {
-									if (TestFor == RTEST_CHAR) {
-										while (*pEval == TestChar) {
-											pEval++;
-											CCount++;
-										}
-									}
-									else {
-										while (memchr(TList, *pEval, NList) != nullptr) {
-											pEval++;
-											CCount++;
-										}
-									}
-								}
-							}
-						}
-						break;
-
-					case RTEST_COND_ONEORMORE:
-						//
-						//  Test for one or more occurrences of the specified character or type
-						//  This test WILL fail if there is not at least one match
-						//
-						if (CCount == TextLen) TestEval = false;
-						else {
-							if (TestFor == RTEST_NUMERICS) {
-								while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9') Found++;
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS) {
-									while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9')) Found++;
-								}
-								else {
-									if (TestFor == RTEST_CHAR) {
-										while (*(pEval + Found) == TestChar) Found++;
-									}
-									else {
-										while (memchr(TList, *(pEval + Found), NList) != nullptr) Found++;
-									}
-								}
-							}
-						}
-						if (Found > 0) {
-							pEval += Found;
-							CCount += Found;
-						}
-						else TestEval = false;
-						break;
-
-					case RTEST_COND_N:
-						//
-						//  Test for n occurrences of the specified character or type
-						//  This test WILL fail if less than n ocuurences were evaluated
-						//
-						if (CCount == TextLen) TestEval = false;
-						else {
-							if (TestFor == RTEST_NUMERICS) {
-								while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9' && Found < TestCondMin) Found++;
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS) {
-									while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9') && Found < TestCondMin) Found++;
-								}
-								else {
-									if (TestFor == RTEST_CHAR) {
-										while (*(pEval + Found) == TestChar && Found < TestCondMin) Found++;
-									}
-									else {
-										while (memchr(TList, *(pEval + Found), NList) != nullptr && Found < TestCondMin) Found++;
-									}
-								}
-							}
-						}
-						if (Found == TestCondMin) {
-							pEval += Found;
-							CCount += Found;
-						}
-						else TestEval = false;
-						break;
-
-					case RTEST_COND_NORMORE:
-						//  
-						//  Test for n or more occurrences of the specified character or type
-						//  This test WILL fail if there are less than n occurrences
-						//
-						if (CCount == TextLen) TestEval = false;
-						else {
-							if (TestFor == RTEST_NUMERICS) {
-								while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9') Found++;
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS) {
-									while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9')) Found++;
-								}
-								else {
-									if (TestFor == RTEST_CHAR) {
-										while (*(pEval + Found) == TestChar) Found++;
-									}
-									else {
-										while (memchr(TList, *(pEval + Found), NList) != nullptr) Found++;
-									}
-								}
-							}
-						}
-
-						if (Found >= TestCondMin) {
-							pEval += Found;
-							CCount += Found;
-						}
-						else TestEval = false;
-						break;
-
-					case RTEST_COND_NTOM:
-						//
-						//  Test for n <= occurrences <= m of the specified character or type
-						//  This test WILL fail if there are less than the minimum
-						//
-						if (CCount == TextLen) TestEval = false;
-						else {
-							if (TestFor == RTEST_NUMERICS) {
-								while (*(pEval + Found) >= '0' && *(pEval + Found) <= '9' && Found < TestCondMax) Found++;
-							}
-							else {
-								if (TestFor == RTEST_NON_NUMERICS) {
-									while ((CCount + Found) < TextLen && (*(pEval + Found) < '0' || *(pEval + Found) > '9') && Found < TestCondMax) Found++;
-								}
-								else {
-									if (TestFor == RTEST_CHAR) {
-										while (*(pEval + Found) == TestChar && Found < TestCondMax) Found++;
-									}
-									else {
-										while (memchr(TList, *(pEval + Found), NList) != nullptr && Found < TestCondMax) Found++;
-									}
-								}
-							}
-						}
-						if (Found >= TestCondMin) {
-							pEval += Found;
-							CCount += Found;
-						}
-						else TestEval = false;
-						break;
+		static bool _regex_match(const char *pText, size_t TextLen, const char *szExpr) {
+			Regex		RE(szExpr);																	//  Compiled expression
 
-					}
+			return RE.match(pText, TextLen);
+		}
 
-					//if (TestEval) std::cout << " evaluated as TRUE." << std::endl;
-					//else std::cout << " evaluated as FALSE." << std::endl;
-				}      //  Evaluating the regular expression
+		static bool _regex_match(const char* pText, size_t TextLen, const Regex& RE) {
+			return RE.match(pText, TextLen);
+		}
 
-			   //  If we have reached the end of the expression and the last test succeeded then we have found a qualifying sub-string
-				if (*pExpr == '\0' && TestEval) return true;
+		//  _regex_search
+		//
+		//  This function will test if the passed string contains a sub-string that matches the regular expression pattern provided.
+		//
+		//  Parameters
+		//
+		//  1  -  char *				-  Const Pointer to the text to be searched
+		//  2  -  size_t				-  Size of text in the buffer
+		//  3  -  char *				-  Const pointer to the pattern mask
+		//
+		//  Returns
+		//
+		//		bool				-  true if the text matches the pattern expression otherwise false
+		//
+		//  API Use Notes:
+		//
+		//  THIS IS AN EXTREMELY LIMITED IMPLEMENTATION OF REGEX EVALUATION
+		//  The expression is compiled for each call, use a Regex (or the overload below) to search many texts for one expression.
+		//
 
-				//  Try the next start position in the string
-				pStartString++;
-				TextLen--;
-			}
+		static bool _regex_search(const char *pText, size_t TextLen, const char *szExpr) {
+			Regex		RE(szExpr);																	//  Compiled expression
 
-			//  No match was found
-			return false;
+			return RE.search(pText, TextLen);
+		}
+
+		static bool _regex_search(const char* pText, size_t TextLen, const Regex& RE) {
+			return RE.search(pText, TextLen);
 		}
 
 		//  _urlencode
@@ -3062,20 +2836,459 @@ namespace xymorg {
 			return false;
 		}
 
-	//
-	//  Undefine local definitions
-	//
+		//  foldCase
+		//
+		//  This function will return the lower case equivalent of an (ASCII) upper case character.
+		//
+		//  Parameters
+		//
+		//	1  -  char				-	Character to be folded
+		//
+		//  Returns
+		//
+		//		char		-	The folded character
+		//
+		//  API Use Notes:
+		//
+		//		1.	Used in place of tolower() in the inner loops of the searches, there is no locale lookup.
+		//
+
+		static char		foldCase(char Char) {
+			return (Char >= 'A' && Char <= 'Z') ? char(Char + ('a' - 'A')) : Char;
+		}
+
+		//  matchInner
+		//
+		//  This function will determine if the inner characters of a candidate string match the sub-string.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the candidate characters
+		//	2  -  char*				-	Const pointer to the sub-string characters
+		//	3  -  size_t			-	Number of characters to compare
+		//	4  -  bool				-	true if the compare is case insensitive
+		//
+		//  Returns
+		//
+		//		bool		-	true if the characters match, otherwise false
+		//
+		//  API Use Notes:
+		//
+		//
+
+		static bool		matchInner(const char* pCandidate, const char* pSubString, size_t Len, bool SCI) {
+			if (!SCI) return memcmp(pCandidate, pSubString, Len) == 0;
+			for (size_t CX = 0; CX < Len; CX++) {
+				if (foldCase(pCandidate[CX]) != foldCase(pSubString[CX])) return false;
+			}
+			return true;
+		}
+
+		//  countMatches
+		//
+		//  This function will count the (non-overlapping) occurrences of the passed text in the passed content.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the content
+		//	2  -  size_t			-	Length of the content
+		//	3  -  char*				-	Const pointer to the text
+		//	4  -  size_t			-	Length of the text (at least 1)
+		//	5  -  bool				-	If true count all occurrences otherwise only the first
+		//	6  -  bool				-	true if the matching is case insensitive
+		//
+		//  Returns
+		//
+		//		size_t		-	Number of occurrences
+		//
+		//  API Use Notes:
+		//
+		//		1.	Single character text is counted 16/32 characters at a time where SSE2/AVX2 is available.
+		//
+
+		static size_t	countMatches(const char* pContent, size_t ContentLen, const char* szText, size_t TextLen, bool All, bool SCI) {
+			size_t			Matches = 0;																//  Number of occurrences
+			const char*		pMatch = pContent;															//  Occurrence
+
+			if (!All) return (_search(pContent, ContentLen, szText, TextLen, SCI) != nullptr) ? 1 : 0;
+
+#if defined(XY_ST_AVX2) || defined(XY_ST_SSE2)
+			if (TextLen == 1) {
+				char	CL = SCI ? foldCase(szText[0]) : szText[0];										//  Character (lower case)
+				char	CU = SCI ? char(toupper(CL)) : CL;												//  Character (upper case)
+				return countChar(pContent, ContentLen, CL, CU);
+			}
+#endif
+
+			while ((pMatch = _search(pMatch, ContentLen - (pMatch - pContent), szText, TextLen, SCI)) != nullptr) {
+				Matches++;
+				pMatch += TextLen;
+			}
+
+			return Matches;
+		}
+
+		//  replaceForward
+		//
+		//  This function will copy content to the destination in a single forward sweep replacing the occurrences of the text.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the source content
+		//	2  -  size_t			-	Length of the source content
+		//	3  -  char*				-	Pointer to the destination
+		//	4  -  char*				-	Const pointer to the text
+		//	5  -  size_t			-	Length of the text (at least 1)
+		//	6  -  char*				-	Const pointer to the replacement text
+		//	7  -  size_t			-	Length of the replacement text
+		//	8  -  bool				-	If true replace all occurrences otherwise only the first
+		//	9  -  bool				-	true if the matching is case insensitive
+		//
+		//  Returns
+		//
+		//		size_t		-	Length of the content written to the destination (not terminated)
+		//
+		//  API Use Notes:
+		//
+		//		1.	The destination may overlap the source provided that it never runs ahead of the unread source, i.e. it
+		//			starts at or below the source and any growth has been allowed for by the placement of the source.
+		//
+
+		static size_t	replaceForward(const char* pSource, size_t SourceLen, char* pDest, const char* szText, size_t TextLen, const char* szNewText, size_t NewTextLen, bool All, bool SCI) {
+			const char*		pNext = pSource;															//  Next unread source
+			const char*		pEnd = pSource + SourceLen;													//  End of the source
+			const char*		pMatch = nullptr;															//  Occurrence
+			char*			pOut = pDest;																//  Next output
+
+			while ((pMatch = _search(pNext, size_t(pEnd - pNext), szText, TextLen, SCI)) != nullptr) {
+				if (pOut != pNext) memmove(pOut, pNext, size_t(pMatch - pNext));
+				pOut += pMatch - pNext;
+				if (NewTextLen > 0) memcpy(pOut, szNewText, NewTextLen);
+				pOut += NewTextLen;
+				pNext = pMatch + TextLen;
+				if (!All) break;
+			}
+
+			//  Copy the remaining content
+			if (pOut != pNext) memmove(pOut, pNext, size_t(pEnd - pNext));
+			pOut += pEnd - pNext;
+
+			return size_t(pOut - pDest);
+		}
+
+		//  searchScalar
+		//
+		//  This function will search for a sub-string by locating candidates on the last character with memchr().
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the search space
+		//	2  -  size_t			-	Length of the search space
+		//	3  -  char*				-	Const pointer to the sub-string
+		//	4  -  size_t			-	Length of the sub-string (at least 2)
+		//	5  -  bool				-	true if the search is case insensitive
+		//	6  -  char				-	First character of the sub-string (lower case)
+		//	7  -  char				-	First character of the sub-string (upper case)
+		//	8  -  char				-	Last character of the sub-string (lower case)
+		//	9  -  char				-	Last character of the sub-string (upper case)
+		//
+		//  Returns
+		//
+		//		const char*	-	Const pointer to the first occurrence of the sub-string, nullptr if not found
+		//
+		//  API Use Notes:
+		//
+		//		1.	Used where the vectorised filter is not available.
+		//
+
+		static const char* searchScalar(const char* pString, size_t HLen, const char* pSubString, size_t Len, bool SCI, char CSL, char CSU, char CEL, char CEU) {
+			size_t			Span = Len - 1;																//  The span betwwen the first and last character characters of the sub-string
+			size_t			LtoS = HLen;																//  Length of the haystack that is available to search
+			const char*		pCandidate = nullptr;														//  Pointer to a candidate matched string
+			const char*		pAltCandidate = nullptr;													//  Alternative candidate matched string
+			const char*		pMatch = nullptr;															//  Matching sub-string pointer
+
+			//  Initialise the search position
+			pCandidate = (const char*) memchr(pString + Span, CEL, LtoS - Span);
+			pAltCandidate =  (const char*) memchr(pString + Span, CEU, LtoS - Span);
+			if (pCandidate == nullptr || (pAltCandidate < pCandidate && pAltCandidate != nullptr)) pCandidate = pAltCandidate;
+
+			//  Main search loop - continue detecting candidate strings within the search space until it is exhauseted
+			while (pCandidate != nullptr) {
+				//  Determine if a real candidate has been detected
+				if (*(pCandidate - Span) == CSL || *(pCandidate - Span) == CSU) {
+					pAltCandidate = (pCandidate - Span) + 1;
+					pMatch = pSubString + 1;
+					size_t CComp = 2;
+					if (SCI) {
+						//  Case insensitive compare
+						while (CComp < Len && foldCase(*pAltCandidate) == foldCase(*pMatch)) {
+							pMatch++;
+							pAltCandidate++;
+							CComp++;
+						}
+					}
+					else {
+						//  Case sensitive compare
+						while (CComp < Len && (*pAltCandidate == *pMatch)) {
+							pMatch++;
+							pAltCandidate++;
+							CComp++;
+						}
+					}
+
+					//  If the complete string was matched then return the pointer to the start of the matched string in the search space
+					if (CComp == Len) return pCandidate - Span;
+				}
+
+				//  The current candidate is not matched - move on to the next candidate
+				pAltCandidate = ++pCandidate;
+				if (size_t(pCandidate - pString) >= HLen) pCandidate = nullptr;
+				else {
+					LtoS = HLen - (pCandidate - pString);
+					pCandidate = (const char*)memchr(pCandidate, CEL, LtoS);
+					pAltCandidate = (const char*)memchr(pAltCandidate, CEU, LtoS);
+					if (pCandidate == nullptr || (pAltCandidate < pCandidate && pAltCandidate != nullptr)) pCandidate = pAltCandidate;
+				}
+			}
+
+			//  Sub-string was not found in the search space - return nullptr
+			return nullptr;
+		}
+
+		//  searchHorspool
+		//
+		//  This function will search for a long sub-string using Boyer-Moore-Horspool skips.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the search space
+		//	2  -  size_t			-	Length of the search space
+		//	3  -  char*				-	Const pointer to the sub-string
+		//	4  -  size_t			-	Length of the sub-string (at least 2)
+		//	5  -  bool				-	true if the search is case insensitive
+		//
+		//  Returns
+		//
+		//		const char*	-	Const pointer to the first occurrence of the sub-string, nullptr if not found
+		//
+		//  API Use Notes:
+		//
+		//		1.	The skip for each character is the distance from its last occurrence (excluding the final character) to the
+		//			end of the sub-string, for a case insensitive search the table is built and indexed with folded characters.
+		//
+
+		static const char* searchHorspool(const char* pString, size_t HLen, const char* pSubString, size_t Len, bool SCI) {
+			size_t			Skip[256] = {};																//  Skip table
+			size_t			Span = Len - 1;																//  Offset of the last character
+			size_t			Pos = 0;																	//  Position of the candidate
+			char			CE = SCI ? foldCase(pSubString[Span]) : pSubString[Span];					//  Last character of the sub-string
+			char			CL = '\0';																	//  Last character of the candidate
+
+			//  Build the skip table
+			for (size_t CX = 0; CX < 256; CX++) Skip[CX] = Len;
+			for (size_t CX = 0; CX < Span; CX++) {
+				if (SCI) {
+					Skip[BYTE(foldCase(pSubString[CX]))] = Span - CX;
+					Skip[BYTE(toupper(foldCase(pSubString[CX])))] = Span - CX;
+				}
+				else Skip[BYTE(pSubString[CX])] = Span - CX;
+			}
+
+			//  Test each candidate, skipping on the last character
+			while (Pos + Span < HLen) {
+				CL = pString[Pos + Span];
+				if ((SCI ? foldCase(CL) : CL) == CE && matchInner(pString + Pos, pSubString, Span, SCI)) return pString + Pos;
+				Pos += Skip[BYTE(CL)];
+			}
+
+			return nullptr;
+		}
+
+#if defined(XY_ST_AVX2) || defined(XY_ST_SSE2)
+
+		//  lowestBit
+		//
+		//  This function will return the index of the lowest set bit in a (non-zero) mask.
+		//
+		//  Parameters
+		//
+		//	1  -  uint32_t			-	Mask
+		//
+		//  Returns
+		//
+		//		unsigned int	-	Index of the lowest set bit
+		//
+		//  API Use Notes:
+		//
+		//
+
+		static unsigned int		lowestBit(uint32_t Mask) {
+#if defined(_MSC_VER)
+			unsigned long		BX = 0;
+			_BitScanForward(&BX, Mask);
+			return (unsigned int) BX;
+#else
+			return (unsigned int) __builtin_ctz(Mask);
+#endif
+		}
+
+		//  countBits
+		//
+		//  This function will return the number of set bits in a mask.
+		//
+		//  Parameters
+		//
+		//	1  -  uint32_t			-	Mask
+		//
+		//  Returns
+		//
+		//		unsigned int	-	Number of set bits
+		//
+		//  API Use Notes:
+		//
+		//
+
+		static unsigned int		countBits(uint32_t Mask) {
+#if defined(_MSC_VER)
+			return (unsigned int) __popcnt(Mask);
+#else
+			return (unsigned int) __builtin_popcount(Mask);
+#endif
+		}
+
+		//  searchVector
+		//
+		//  This function will search for a sub-string using a vectorised filter on the first and last characters.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the search space
+		//	2  -  size_t			-	Length of the search space
+		//	3  -  char*				-	Const pointer to the sub-string
+		//	4  -  size_t			-	Length of the sub-string
+		//	5  -  bool				-	true if the search is case insensitive
+		//	6  -  char				-	First character of the sub-string (lower case)
+		//	7  -  char				-	First character of the sub-string (upper case)
+		//	8  -  char				-	Last character of the sub-string (lower case)
+		//	9  -  char				-	Last character of the sub-string (upper case)
+		//
+		//  Returns
+		//
+		//		const char*	-	Const pointer to the first occurrence of the sub-string, nullptr if not found
+		//
+		//  API Use Notes:
+		//
+		//		1.	Each block compares 32 (AVX2) or 16 (SSE2) candidate first characters and the matching last characters with
+		//			both cases in-register, the mask of candidates is then verified from the lowest position upwards.
+		//		2.	Candidates beyond the last full block are tested one at a time.
+		//
+
+		static const char* searchVector(const char* pString, size_t HLen, const char* pSubString, size_t Len, bool SCI, char CSL, char CSU, char CEL, char CEU) {
+			size_t			Span = Len - 1;																//  Offset of the last character
+			size_t			Candidates = HLen - Span;													//  Number of candidate positions
+			size_t			Pos = 0;																	//  Position of the block
+			uint32_t		Mask = 0;																	//  Candidate mask
+
+#if defined(XY_ST_AVX2)
+			const size_t	Width = 32;																	//  Block width
+			const __m256i	VSL = _mm256_set1_epi8(CSL);
+			const __m256i	VSU = _mm256_set1_epi8(CSU);
+			const __m256i	VEL = _mm256_set1_epi8(CEL);
+			const __m256i	VEU = _mm256_set1_epi8(CEU);
+#else
+			const size_t	Width = 16;																	//  Block width
+			const __m128i	VSL = _mm_set1_epi8(CSL);
+			const __m128i	VSU = _mm_set1_epi8(CSU);
+			const __m128i	VEL = _mm_set1_epi8(CEL);
+			const __m128i	VEU = _mm_set1_epi8(CEU);
+#endif
+
+			//  Filter full blocks of candidates
+			while (Pos + Width <= Candidates) {
+#if defined(XY_ST_AVX2)
+				__m256i		BF = _mm256_loadu_si256((const __m256i*) (pString + Pos));
+				__m256i		BL = _mm256_loadu_si256((const __m256i*) (pString + Pos + Span));
+				Mask = uint32_t(_mm256_movemask_epi8(_mm256_and_si256(_mm256_or_si256(_mm256_cmpeq_epi8(BF, VSL), _mm256_cmpeq_epi8(BF, VSU)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(BL, VEL), _mm256_cmpeq_epi8(BL, VEU)))));
+#else
+				__m128i		BF = _mm_loadu_si128((const __m128i*) (pString + Pos));
+				__m128i		BL = _mm_loadu_si128((const __m128i*) (pString + Pos + Span));
+				Mask = uint32_t(_mm_movemask_epi8(_mm_and_si128(_mm_or_si128(_mm_cmpeq_epi8(BF, VSL), _mm_cmpeq_epi8(BF, VSU)),
+					_mm_or_si128(_mm_cmpeq_epi8(BL, VEL), _mm_cmpeq_epi8(BL, VEU)))));
+#endif
+				while (Mask != 0) {
+					size_t	CX = Pos + lowestBit(Mask);
+					if (Len == 1 || matchInner(pString + CX + 1, pSubString + 1, Len - 2, SCI)) return pString + CX;
+					Mask &= Mask - 1;
+				}
+				Pos += Width;
+			}
+
+			//  Test the remaining candidates
+			for (; Pos < Candidates; Pos++) {
+				if ((pString[Pos] == CSL || pString[Pos] == CSU) && (pString[Pos + Span] == CEL || pString[Pos + Span] == CEU)) {
+					if (Len == 1 || matchInner(pString + Pos + 1, pSubString + 1, Len - 2, SCI)) return pString + Pos;
+				}
+			}
+
+			return nullptr;
+		}
+
+		//  countChar
+		//
+		//  This function will count the occurrences of a character (in either case) in the passed content.
+		//
+		//  Parameters
+		//
+		//	1  -  char*				-	Const pointer to the content
+		//	2  -  size_t			-	Length of the content
+		//	3  -  char				-	Character (lower case)
+		//	4  -  char				-	Character (upper case)
+		//
+		//  Returns
+		//
+		//		size_t		-	Number of occurrences
+		//
+		//  API Use Notes:
+		//
+		//		1.	Each block of 32 (AVX2) or 16 (SSE2) characters is counted from the population of its match mask.
+		//
+
+		static size_t	countChar(const char* pContent, size_t ContentLen, char CL, char CU) {
+			size_t			Count = 0;																	//  Number of occurrences
+			size_t			Pos = 0;																	//  Position of the block
+
+#if defined(XY_ST_AVX2)
+			const size_t	Width = 32;																	//  Block width
+			const __m256i	VL = _mm256_set1_epi8(CL);
+			const __m256i	VU = _mm256_set1_epi8(CU);
+
+			while (Pos + Width <= ContentLen) {
+				__m256i		Block = _mm256_loadu_si256((const __m256i*) (pContent + Pos));
+				Count += countBits(uint32_t(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(Block, VL), _mm256_cmpeq_epi8(Block, VU)))));
+				Pos += Width;
+			}
+#else
+			const size_t	Width = 16;																	//  Block width
+			const __m128i	VL = _mm_set1_epi8(CL);
+			const __m128i	VU = _mm_set1_epi8(CU);
+
+			while (Pos + Width <= ContentLen) {
+				__m128i		Block = _mm_loadu_si128((const __m128i*) (pContent + Pos));
+				Count += countBits(uint32_t(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(Block, VL), _mm_cmpeq_epi8(Block, VU)))));
+				Pos += Width;
+			}
+#endif
+
+			//  Count the remaining characters
+			for (; Pos < ContentLen; Pos++) if (pContent[Pos] == CL || pContent[Pos] == CU) Count++;
+
+			return Count;
+		}
+
+#endif
 
-	#undef		RTEST_NUMERICS
-	#undef		RTEST_NON_NUMERICS
-	#undef		RTEST_CHAR
-	#undef		RTEST_LIST
-	#undef		RTEST_COND_NONEORMORE
-	#undef		RTEST_COND_ONEORMORE
-	#undef		RTEST_COND_NONEORONE
-	#undef		RTEST_COND_N
-	#undef		RTEST_COND_NORMORE
-	#undef		RTEST_COND_NTOM
 
 	};
 
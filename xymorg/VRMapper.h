@@ -3,10 +3,10 @@
 //*																													*
 //*   File:       VRMapper.h																						*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.1.0	(Build: 02)																					*
+//*   Version:    1.2.2	(Build: 10)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2017 - 2023 Ian J. Tree																				*
+//*   Copyright 2017 - 2026 Ian J. Tree																				*
 //*******************************************************************************************************************
 //*																													*
 //*	This header file contains the definition for the VRMapper class. The class holds the Virtual Resource Maps		*
@@ -17,7 +17,13 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		Resources may be opened as read-only views (mapResource()), large files are mapped into memory and		*
+//*			paged in on demand rather than being read into a private buffer.										*
+//*	2.		Resources are stored through a temporary file that replaces the target when complete, a failed store	*
+//*			leaves the existing resource unchanged. A target that is a symbolic link is resolved so that the file	*
+//*			it refers to is replaced and the link is kept.															*
+//*	3.		Virtual file names are resolved once and held in a resolved path cache until the map changes, stat		*
+//*			information may also be cached (setStatCaching()) and is invalidated by change notification (inotify).	*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -25,6 +31,12 @@
 //*																													*
 //*	1.0.0 -		02/12/2017	-	Initial Release																		*
 //*	1.1.0 -		27/10/2022	-	MIME type resolver																	*
+//*	1.2.0 -		19/10/2026	-	Memory mapped resource views (MappedResource)										*
+//*							-	Atomic buffered resource stores (ResourceWriter)									*
+//*							-	Resolved path cache with optional stat caching										*
+//*							-	Large charmed resources are compressed as parallel Chimera frames					*
+//*	1.2.1 -		19/10/2026	-	Stores resolve symbolic links, thread safe temporary file names						*
+//*	1.2.2 -		19/10/2026	-	Large charmed resources are compressed as a stream into the resource writer			*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -43,11 +55,29 @@
 #include	"CODECS/Chimera.h"																//  Chimera Data Compression
 #include	"XMLMicroParser.h"																//  XML Parsing
 
+//  Additional Language Headers
+#include	<mutex>																			//  Resolution cache lock
+#include	<atomic>																		//  Temporary file sequence
+#include	<climits>																		//  Path limits
+
 #ifdef  XY_NEEDS_CRYPTO
 #include	"CRYPTO/SObjectPool.h"															//  Secure objects pool
 #include	"CRYPTO/TripleDESCBC.h"															//  Triple-DES CODEC
 #endif
 
+//  Platform file mapping and low level I/O
+#if  (defined(_WIN32) || defined(_WIN64))
+#include	<io.h>																			//  Low level I/O
+#include	<fcntl.h>																		//  File control
+#include	<process.h>																		//  Process identification
+#else
+#include	<fcntl.h>																		//  File control
+#include	<sys/mman.h>																	//  Memory mapping
+#if defined(__linux__)
+#include	<sys/inotify.h>																	//  Change notification
+#endif
+#endif
+
 //
 //  NODE Identifiers for the Virtual Resource Map
 //
@@ -95,332 +125,1058 @@ namespace xymorg {
 	};
 
 	//
-	//  VRMapper class definition
+	//  MappedResource class definition
+	//
+	//	The MappedResource class holds a read-only view of the content of a resource file. Large files are mapped into
+	//	memory and paged in on demand, small files are read into a private buffer. The view is released when the object
+	//	is destroyed.
 	//
 
-	class VRMapper {
+	class MappedResource {
 	public:
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Constructors			                                                                                        *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
+		//  Access pattern advice
+		static const int	AdviseNormal = 0;															//  No particular pattern
+		static const int	AdviseSequential = 1;														//  Read from start to end
+		static const int	AdviseWillNeed = 2;															//  Whole content needed soon
+		static const int	AdviseRandom = 3;															//  Random access
 
-		//  Constructor 
+		//  Files smaller than this are read rather than mapped
+		static const size_t	MapThreshold = 32768;
+
+		//  Constructor
 		//
-		//  Constructs a new VRMapper object, determining the project root location for the application
+		//  Constructs an empty (unloaded) view
 		//
 		//  PARAMETERS:
 		//
-		//		StringPool&			-		Reference to the application level public string pool
-		//		SOPool&				-		Reference to the secure object pool
-		//		int					-		Count of application invocation parameters
-		//		char*[]				-		Array of pointers to the application invocation parameters
-		//		
-		//
 		//  RETURNS:
 		//
 		//  NOTES:
 		//
 
-#ifdef XY_NEEDS_CRYPTO
-		VRMapper(StringPool& PubSpool, SObjectPool& SecPool, int argc, char* argv[]) : SPool(PubSpool), SOPool(SecPool), RString(NULLSTRREF), MTMap(nullptr), CLFPUsed(false) {
-#else
-		VRMapper(StringPool & PubSpool, int argc, char* argv[]) : SPool(PubSpool), RString(NULLSTRREF), MTMap(nullptr), CLFPUsed(false) {
-#endif
-
-			//  Discover the project root directory
-			RString = setRoot(argc, argv);
-			if (RString == NULLSTRREF) return;
-
-			//  Setup the Resource Map root 
-			RMap.getRoot()->setName(NULLSTRREF);
-			RMap.getRoot()->setMappedName(RString);
-
-			//  Setup the default nodes of the resource map in the hierarchy
-			//
-			//	1.		Config		--->		<root>/Config
-			//  2.		Logs		--->		<root>/Logs
-			//
+		MappedResource() {}
 
-			setupDefaultMap();
+		//  Move Constructor
+		//
+		//  Constructs a view taking over the content of the source view
+		//
+		//  PARAMETERS:
+		//
+		//		MappedResource&&	-		Reference to the source view
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
 
-			//  Return to caller
+		MappedResource(MappedResource&& Src) noexcept {
+			take(Src);
 			return;
 		}
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Destructor			                                                                                        *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
+		//  Views cannot be copied
+		MappedResource(const MappedResource&) = delete;
+		MappedResource& operator = (const MappedResource&) = delete;
 
 		//  Destructor
 		//
-		//  Destroys the VRMapper object destroying any contained objects.
+		//  Releases the view
 		//
 		//  PARAMETERS:
 		//
 		//  RETURNS:
 		//
 		//  NOTES:
-		//  
-
-		~VRMapper() {
+		//
 
-			//  Return to caller
+		~MappedResource() {
+			release();
 			return;
 		}
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Public Members                                                                                                *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
-
-
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Public Functions                                                                                              *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
-
-		//  isFirstCLPUsed
+		//  Move Assignment
+		//
+		//  Releases the current view and takes over the content of the source view
 		//
-		//  This function will indicate if the first command line parameter is used by xymorg (project root directory).
-		//  
 		//  PARAMETERS:
 		//
+		//		MappedResource&&	-		Reference to the source view
+		//
 		//  RETURNS:
-		// 
-		//		bool		-		true if first parameter used, otherwise false
+		//
+		//		MappedResource&		-		Reference to self
 		//
 		//  NOTES:
 		//
 
-		bool	isFirstCLPUsed() { return CLFPUsed; }
+		MappedResource& operator = (MappedResource&& Src) noexcept {
+			if (this != &Src) {
+				release();
+				take(Src);
+			}
+			return *this;
+		}
 
-		//  extendConfiguration
+		//  open
 		//
-		//  This function will extend the current configuration of the resource map based on the content of the
-		//  <VRMap> element in the configuration file.
-		//  
+		//  Opens a view of the content of the named (real) file
 		//
 		//  PARAMETERS:
 		//
-		//		XMLIterator&			-		Reference to the XML iterator for the scope <VRMap>
+		//		char*				-		Const pointer to the file name
+		//		int					-		Expected access pattern
 		//
 		//  RETURNS:
 		//
+		//		bool				-		true if the view was opened, otherwise false
+		//
 		//  NOTES:
 		//
+		//		1.	The content is always followed by a null byte so that text resources may be treated as strings
+		//		2.	A mapped file must not be truncated while the view is open
+		//
 
-		void	extendConfiguration(XMLMicroParser::XMLIterator & VRMIt) {
-			QHierarchy<RNode>::Node*	pMapPos = RMap.getRoot();									//  Current position in the hierarchy
-			QHierarchy<RNode>::Node*	pSearch = nullptr;											//  Search in the hierarchy
-			const char*					pDir = nullptr;												//  Directory name from config
-			size_t						DirLen = 0;													//  Length of directory name
-
-			//  Check that we have a valid element scope
-			if (VRMIt.isNull()) return;
-
-			//
-			//  Iterate over the content of the map building a new node in the hierarchy for each node identified
-			//
+		bool	open(const char* szFileName, int Advice = AdviseSequential) {
+			BYTE*		pImg = nullptr;																//  Private image
 
-			for (; !VRMIt.isAtEnd(); VRMIt++) {
+			release();
+			if (szFileName == nullptr || szFileName[0] == '\0') return false;
 
-				//
-				//  Only process "node" elements
-				//
-				if (VRMIt.isNode(NODE_VRES_NODE)) {
+#if (defined(_WIN32) || defined(_WIN64))
+			//  WINDOWS PLATFORM - Read into a private buffer
+			FILE*		pRFile = nullptr;															//  File handle
+			size_t		FSize = 0;																	//  File size
 
-					//  Check if this is the closing of the node, in which case move the current position up a level
-					if (VRMIt.isClosing()) pMapPos = pMapPos->getParent();
-					else {
-						//  Verify that the node has name=, type= and target= attributes, discard the node if not well-formed
-						if (VRMIt.hasAttribute(PARM_VRES_NAME) && VRMIt.hasAttribute(PARM_VRES_TYPE) && VRMIt.hasAttribute(PARM_VRES_TGT)) {
+			Advice = Advice;
+			if (fopen_s(&pRFile, szFileName, "rb") != 0 || pRFile == nullptr) return false;
+			fseek(pRFile, 0, SEEK_END);
+			FSize = ftell(pRFile);
+			rewind(pRFile);
+			pImg = (BYTE*) malloc(FSize + 1);
+			if (pImg == nullptr || fread(pImg, 1, FSize, pRFile) != FSize) {
+				if (pImg != nullptr) free(pImg);
+				fclose(pRFile);
+				return false;
+			}
+			fclose(pRFile);
+#else
+			//  UNIX/Linux PLATFORM - Map large files, read small ones
+			int				FD = -1;																//  File descriptor
+			struct stat		FileInfo = {};															//  File information
+			size_t			FSize = 0;																//  File size
+			size_t			Done = 0;																//  Bytes read
+			ssize_t			ReadLen = 0;															//  Length of a read
+
+			FD = ::open(szFileName, O_RDONLY | O_CLOEXEC);
+			if (FD < 0) return false;
+			if (fstat(FD, &FileInfo) != 0 || !S_ISREG(FileInfo.st_mode)) {
+				close(FD);
+				return false;
+			}
+			FSize = size_t(FileInfo.st_size);
+
+			if (FSize >= MapThreshold) {
+				//  Reserve the pages for the file plus a null byte, then map the file over the start of the reservation.
+				//  The remainder of the last file page and any following page read as zero.
+				size_t		PageSize = size_t(sysconf(_SC_PAGESIZE));						//  System page size
+				void*		pMap = nullptr;													//  File mapping
+
+				MapLen = ((FSize + PageSize) / PageSize) * PageSize;
+				pBase = mmap(nullptr, MapLen, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (pBase != MAP_FAILED) {
+					pMap = mmap(pBase, FSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, FD, 0);
+					if (pMap != MAP_FAILED) {
+						close(FD);
+						pData = (const BYTE*) pBase;
+						Size = FSize;
+						advise(Advice);
+						return true;
+					}
+					munmap(pBase, MapLen);
+				}
 
-							//  Check that the node does not already exist as a child of the current map position
-							pDir = VRMIt.getAttribute(PARM_VRES_NAME, DirLen);
-							pSearch = pMapPos->getChild();
-							while (pSearch != nullptr) {
-								if (_memicmp(SPool.getString(pSearch->getName()), pDir, DirLen) == 0) break;
-								pSearch = pSearch->getTwin();
-							}
+				//  Mapping failed - fall back to reading the file
+				pBase = nullptr;
+				MapLen = 0;
+			}
 
-							//  If the node already exists then check if it needs to be updated, otherwise create the new node
-							if (pSearch != nullptr) {
-								if (_memicmp(SPool.getString(pSearch->getMappedName()), pDir, DirLen) != 0) {
-									//  Mapped name has changed
-									//  1. Replace the string in the pool
-									SPool.replaceString(pSearch->getMappedName(), pDir, DirLen);
+			pImg = (BYTE*) malloc(FSize + 1);
+			if (pImg == nullptr) {
+				close(FD);
+				return false;
+			}
+			while (Done < FSize) {
+				ReadLen = read(FD, pImg + Done, FSize - Done);
+				if (ReadLen < 0 && errno == EINTR) continue;
+				if (ReadLen <= 0) break;
+				Done += size_t(ReadLen);
+			}
+			close(FD);
+			if (Done != FSize) {
+				free(pImg);
+				return false;
+			}
+#endif
 
-									//  2.  Create the directory for the new target if it does not already exist
-									createTarget(pSearch);
+			//  Private image
+			pImg[FSize] = 0;
+			pHeap = pImg;
+			pData = pImg;
+			Size = FSize;
+			return true;
+		}
 
-									//  3.  Update the current position to the updated node
-									pMapPos = pSearch;
-								}
-							}
-							else {
+		//  release
+		//
+		//  Releases the view
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
 
-								//  Build a new node as the child of the current position
-								pMapPos = pMapPos->addChild();
+		void	release() {
+#if !(defined(_WIN32) || defined(_WIN64))
+			if (pBase != nullptr) munmap(pBase, MapLen);
+#endif
+			if (pHeap != nullptr) free(pHeap);
+			pBase = nullptr;
+			MapLen = 0;
+			pHeap = nullptr;
+			pData = nullptr;
+			Size = 0;
 
-								//  Add the name
-								pMapPos->setName(SPool.addString(pDir, DirLen));
+			//  Return to caller
+			return;
+		}
 
-								//  Add the mapped name
-								pDir = VRMIt.getAttribute(PARM_VRES_TGT, DirLen);
-								pMapPos->setMappedName(SPool.addString(pDir, DirLen));
+		//  advise
+		//
+		//  Advises the system of the expected access pattern for the view
+		//
+		//  PARAMETERS:
+		//
+		//		int					-		Expected access pattern
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	Only mapped views are affected
+		//
 
-								//  Create the target directory
-								createTarget(pMapPos);
-							}
-						}
-						else VRMIt++;
-					}
-				}
+		void	advise(int Advice) {
+#if !(defined(_WIN32) || defined(_WIN64))
+			if (pBase == nullptr) return;
+			switch (Advice) {
+			case AdviseSequential:
+				madvise(pBase, MapLen, MADV_SEQUENTIAL);
+				break;
+			case AdviseWillNeed:
+				madvise(pBase, MapLen, MADV_WILLNEED);
+				break;
+			case AdviseRandom:
+				madvise(pBase, MapLen, MADV_RANDOM);
+				break;
+			default:
+				madvise(pBase, MapLen, MADV_NORMAL);
+				break;
 			}
+#else
+			Advice = Advice;
+#endif
 
 			//  Return to caller
 			return;
 		}
 
-		//  mapFile (1)
+		//  acquireBuffer
 		//
-		//  This function resolves an application file reference (virtual) to an external file reference (qualified).
-		//  
+		//  Acquires ownership of the private image of a view that was read rather than mapped
 		//
 		//  PARAMETERS:
 		//
-		//		STRREF			-		String reference of the virtual file to be mapped
-		//		char *			-		Pointer to the buffer that is to hold the resulting qualified file name
-		//		size_t			-		Size of the buffer that holds the qualified file name
+		//		size_t&				-		Reference to the variable where the size of the image will be returned
 		//
 		//  RETURNS:
 		//
-		//		char *			-		Convenience pointer to the qualified file name
+		//		BYTE*				-		Pointer to the (null terminated) image, nullptr if the view is mapped or not loaded
 		//
 		//  NOTES:
 		//
+		//		1.	The view is left unloaded, the caller is responsible for freeing the image
+		//
 
-		char* mapFile(STRREF VFR, char* szQFile, size_t BfrLen) {
-			return mapFile(SPool.getString(VFR), szQFile, BfrLen);
+		BYTE*	acquireBuffer(size_t& BSize) {
+			BYTE*		pImg = pHeap;																	//  Private image
+
+			BSize = 0;
+			if (pImg == nullptr) return nullptr;
+			BSize = Size;
+			pHeap = nullptr;
+			release();
+			return pImg;
 		}
 
+		//  Getters
+		bool			isLoaded() const { return pData != nullptr; }
+		bool			isMapped() const { return pBase != nullptr; }
+		const BYTE*		getData() const { return pData; }
+		const char*		getText() const { return (const char*) pData; }
+		size_t			getSize() const { return Size; }
 
-		//  mapFile (2)
+	private:
+
+		const BYTE*		pData = nullptr;																//  Content of the resource
+		size_t			Size = 0;																		//  Size of the content
+		void*			pBase = nullptr;																//  Base of the mapping
+		size_t			MapLen = 0;																		//  Length of the mapping
+		BYTE*			pHeap = nullptr;																//  Private image
+
+		//  take
 		//
-		//  This function resolves an application file string (virtual) to an external file reference (qualified).
-		//  
+		//  Takes over the content of another view, leaving it empty
 		//
 		//  PARAMETERS:
 		//
-		//		const char *	-		Const pointer to the virtual file name
-		//		char *			-		Pointer to the buffer that is to hold the resulting qualified file name
-		//		size_t			-		Size of the buffer that holds the qualified file name
+		//		MappedResource&		-		Reference to the source view
 		//
 		//  RETURNS:
 		//
-		//		char *			-		Convenience pointer to the qualified file name
-		//
 		//  NOTES:
 		//
 
-		char* mapFile(const char* szVFile, char* szQFile, size_t BfrLen) {
-			const char*		pSeg = szVFile;																//  Pointer to the next segment to process
-			size_t			SegLen = 0;																	//  Next segment length
-			size_t			MappedLen = 0;																//  Length of a mapped segment
-			size_t			BfrUsed = 0;																//  Bytes used in the output buffer
-			QHierarchy<RNode>::Node* pMapNode = nullptr;											//  Current node in the resource hierarchy
-
-			//  Contract Defense
-			if (szQFile == nullptr || BfrLen == 0) return nullptr;
-			szQFile[0] = '\0';
-
-			//
-			//  If the virtual file name is absolute then copy it to the output (if there is room)
-			//
+		void	take(MappedResource& Src) {
+			pData = Src.pData;
+			Size = Src.Size;
+			pBase = Src.pBase;
+			MapLen = Src.MapLen;
+			pHeap = Src.pHeap;
+			Src.pData = nullptr;
+			Src.Size = 0;
+			Src.pBase = nullptr;
+			Src.MapLen = 0;
+			Src.pHeap = nullptr;
 
-			if (isAbsolute(szVFile)) {
-				MappedLen = strlen(szVFile);
-				if (MappedLen >= BfrLen) return nullptr;
-				strcpy_s(szQFile, BfrLen, szVFile);
-				return szQFile;
-			}
+			//  Return to caller
+			return;
+		}
+	};
 
-			//
-			//  Insert the <root> mapped string into the qualified file name
-			//
+	//
+	//  ResourceWriter class definition
+	//
+	//	The ResourceWriter class writes the content of a resource file through a fixed size buffer into a temporary file
+	//	alongside the target. The temporary file replaces the target only when the write is committed, a failed or
+	//	abandoned write leaves any existing target unchanged.
+	//
 
-			MappedLen = SPool.getLength(RString);
-			if (MappedLen >= BfrLen) return nullptr;
-			strcpy_s(szQFile, BfrLen, SPool.getString(RString));
-			BfrUsed = MappedLen;
+	class ResourceWriter {
+	public:
 
-			//  Set position in the hierarchy
-			pMapNode = RMap.getRoot();
+		//  Size of the write buffer
+		static const size_t	BufferSize = 65536;
 
+		//  Constructor
+		//
+		//  Constructs a writer that is not open
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		ResourceWriter() {}
+
+		//  Writers cannot be copied
+		ResourceWriter(const ResourceWriter&) = delete;
+		ResourceWriter& operator = (const ResourceWriter&) = delete;
+
+		//  Destructor
+		//
+		//  Abandons any write that has not been committed and releases the buffer
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		~ResourceWriter() {
+			abandon();
+			if (pBuffer != nullptr) free(pBuffer);
+			return;
+		}
+
+		//  open
+		//
+		//  Opens a write of the content of the named (real) file
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the file name
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the write was opened, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The temporary file is created in the same directory as the target so that it can be renamed over it
+		//		2.	A target that is a symbolic link is resolved first, the file that the link refers to is replaced
+		//			(as a write through the link would) and the link itself is left in place (not on Windows)
+		//		3.	Writers may be used concurrently from several threads, the temporary file names are unique
+		//
+
+		bool	open(const char* szFileName) {
+			static std::atomic<size_t>	Sequence(0);											//  Temporary file sequence
+
+			abandon();
+			if (szFileName == nullptr || szFileName[0] == '\0') return false;
+			if (strlen(szFileName) > MAX_PATH) return false;
+			if (pBuffer == nullptr) {
+				pBuffer = (BYTE*) malloc(BufferSize);
+				if (pBuffer == nullptr) return false;
+			}
+			if (!resolveTarget(szFileName)) return false;
+
+			//  Create a temporary file that does not already exist
+			for (int Try = 0; Try < 100 && FD < 0; Try++) {
+#if (defined(_WIN32) || defined(_WIN64))
+				sprintf_s(szTemp, MAX_PATH + 48, "%s.%d.%zu.tmp", szTarget, _getpid(), Sequence++);
+				FD = _open(szTemp, _O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+				sprintf_s(szTemp, MAX_PATH + 48, "%s.%d.%zu.tmp", szTarget, int(getpid()), Sequence++);
+				FD = ::open(szTemp, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+#endif
+				if (FD < 0 && errno != EEXIST) break;
+			}
+			if (FD < 0) return false;
+
+#if !(defined(_WIN32) || defined(_WIN64))
+			//  Keep the permissions of a target that is being replaced
+			struct stat		FileInfo = {};															//  Target information
+			if (stat(szTarget, &FileInfo) == 0) fchmod(FD, FileInfo.st_mode & 07777);
+#endif
+
+			Used = 0;
+			Failed = false;
+			return true;
+		}
+
+		//  write
+		//
+		//  Writes data to the resource
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*				-		Const pointer to the data
+		//		size_t				-		Length of the data
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the data was written, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	Writes that are larger than the buffer are passed directly to the file
+		//
+
+		bool	write(const BYTE* pData, size_t DataLen) {
+			if (FD < 0 || Failed) return false;
+			if (DataLen == 0) return true;
+			if (pData == nullptr) return false;
+
+			//  Buffer small writes
+			if (Used + DataLen <= BufferSize) {
+				memcpy(pBuffer + Used, pData, DataLen);
+				Used += DataLen;
+				return true;
+			}
+
+			//  Top up the buffer and pass the remainder through if it will not fit
+			if (!flush()) return false;
+			if (DataLen < BufferSize) {
+				memcpy(pBuffer, pData, DataLen);
+				Used = DataLen;
+				return true;
+			}
+			return writeFile(pData, DataLen);
+		}
+
+		//  commit
+		//
+		//  Completes the write, replacing the target with the written content
+		//
+		//  PARAMETERS:
+		//
+		//		bool				-		true if the content must be on stable storage before returning
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the target was replaced, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	If the commit fails the write is abandoned and the target is unchanged
+		//
+
+		bool	commit(bool Durable = false) {
+			bool		Done = false;															//  Target replaced
+
+			if (FD < 0) return false;
+			if (!flush()) {
+				abandon();
+				return false;
+			}
+
+#if (defined(_WIN32) || defined(_WIN64))
+			if (Durable && _commit(FD) != 0) Failed = true;
+			_close(FD);
+			FD = -1;
+			if (!Failed) Done = MoveFileExA(szTemp, szTarget, MOVEFILE_REPLACE_EXISTING | (Durable ? MOVEFILE_WRITE_THROUGH : 0)) != 0;
+#else
+#if defined(__APPLE__)
+			if (Durable && fsync(FD) != 0) Failed = true;
+#else
+			if (Durable && fdatasync(FD) != 0) Failed = true;
+#endif
+			if (close(FD) != 0) Failed = true;
+			FD = -1;
+			if (!Failed) Done = rename(szTemp, szTarget) == 0;
+			if (Done && Durable) syncDirectory();
+#endif
+			if (!Done) remove(szTemp);
+			szTemp[0] = '\0';
+			return Done;
+		}
+
+		//  abandon
+		//
+		//  Abandons the write, the target is left unchanged
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	abandon() {
+			if (FD >= 0) {
+#if (defined(_WIN32) || defined(_WIN64))
+				_close(FD);
+#else
+				close(FD);
+#endif
+				FD = -1;
+				remove(szTemp);
+			}
+			szTemp[0] = '\0';
+			Used = 0;
+
+			//  Return to caller
+			return;
+		}
+
+		//  Getters
+		bool		isOpen() const { return FD >= 0; }
+
+	private:
+
+		int				FD = -1;																		//  Temporary file descriptor
+		BYTE*			pBuffer = nullptr;																//  Write buffer
+		size_t			Used = 0;																		//  Bytes in the buffer
+		bool			Failed = false;																	//  A write has failed
+		char			szTarget[MAX_PATH + 1] = {};													//  Target file name
+		char			szTemp[MAX_PATH + 48] = {};														//  Temporary file name
+
+		//  resolveTarget
+		//
+		//  Sets the target file name, following any symbolic links to the file that they refer to
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the file name
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the target was set, false if the resolved name is too long
+		//
+		//  NOTES:
+		//
+		//		1.	A target that does not yet exist is used as named, a dangling link is resolved to the file that it
+		//			names (relative to the directory holding the link)
+		//
+
+		bool	resolveTarget(const char* szFileName) {
+#if (defined(_WIN32) || defined(_WIN64))
+			strcpy_s(szTarget, MAX_PATH + 1, szFileName);
+			return true;
+#else
+			char			szResolved[PATH_MAX + 1] = {};													//  Resolved path
+			char			szLink[PATH_MAX + 1] = {};														//  Link content
+			struct stat		LinkInfo = {};																	//  Link information
+			ssize_t			LinkLen = 0;																	//  Length of the link content
+			const char*		pSlash = nullptr;																//  End of the link directory
+
+			//  Existing targets (and links to them) are resolved to the real file
+			if (realpath(szFileName, szResolved) != nullptr) {
+				if (strlen(szResolved) > MAX_PATH) return false;
+				strcpy_s(szTarget, MAX_PATH + 1, szResolved);
+				return true;
+			}
+
+			//  A new target is used as named
+			strcpy_s(szTarget, MAX_PATH + 1, szFileName);
+			if (lstat(szFileName, &LinkInfo) != 0 || !S_ISLNK(LinkInfo.st_mode)) return true;
+
+			//  A dangling link names the file that is to be created
+			LinkLen = readlink(szFileName, szLink, PATH_MAX);
+			if (LinkLen <= 0) return true;
+			szLink[LinkLen] = '\0';
+			pSlash = strrchr(szFileName, '/');
+			if (szLink[0] == '/' || pSlash == nullptr) {
+				if (size_t(LinkLen) > MAX_PATH) return false;
+				strcpy_s(szTarget, MAX_PATH + 1, szLink);
+				return true;
+			}
+			if (size_t(pSlash - szFileName) + 1 + size_t(LinkLen) > MAX_PATH) return false;
+			memcpy(szTarget, szFileName, size_t(pSlash - szFileName) + 1);
+			strcpy_s(szTarget + (pSlash - szFileName) + 1, MAX_PATH + 1 - ((pSlash - szFileName) + 1), szLink);
+			return true;
+#endif
+		}
+
+		//  flush
+		//
+		//  Writes the content of the buffer to the file
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the buffer was written, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	flush() {
+			if (Failed) return false;
+			if (Used == 0) return true;
+			if (!writeFile(pBuffer, Used)) return false;
+			Used = 0;
+			return true;
+		}
+
+		//  writeFile
+		//
+		//  Writes data to the file, completing any partial writes
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*				-		Const pointer to the data
+		//		size_t				-		Length of the data
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the data was written, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	writeFile(const BYTE* pData, size_t DataLen) {
+			while (DataLen > 0) {
+#if (defined(_WIN32) || defined(_WIN64))
+				int			Chunk = (DataLen > 0x40000000) ? 0x40000000 : int(DataLen);		//  Size of this write
+				int			Written = _write(FD, pData, (unsigned int) Chunk);				//  Bytes written
+#else
+				ssize_t		Written = ::write(FD, pData, DataLen);								//  Bytes written
+				if (Written < 0 && errno == EINTR) continue;
+#endif
+				if (Written <= 0) {
+					Failed = true;
+					return false;
+				}
+				pData += Written;
+				DataLen -= size_t(Written);
+			}
+			return true;
+		}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+		//  syncDirectory
+		//
+		//  Makes the rename of the target durable by synchronising the directory that contains it
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	syncDirectory() {
+			char		szDir[MAX_PATH + 1] = {};													//  Directory name
+			char*		pSlash = nullptr;															//  Last separator
+			int			DirFD = -1;																	//  Directory descriptor
+
+			strcpy_s(szDir, MAX_PATH + 1, szTarget);
+			pSlash = strrchr(szDir, '/');
+			if (pSlash == nullptr) strcpy_s(szDir, MAX_PATH + 1, ".");
+			else if (pSlash == szDir) szDir[1] = '\0';
+			else *pSlash = '\0';
+
+			DirFD = ::open(szDir, O_RDONLY | O_CLOEXEC);
+			if (DirFD < 0) return;
+			fsync(DirFD);
+			close(DirFD);
+
+			//  Return to caller
+			return;
+		}
+#endif
+	};
+
+	//
+	//  VRMapper class definition
+	//
+
+	class VRMapper {
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Constructors			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Constructor 
+		//
+		//  Constructs a new VRMapper object, determining the project root location for the application
+		//
+		//  PARAMETERS:
+		//
+		//		StringPool&			-		Reference to the application level public string pool
+		//		SOPool&				-		Reference to the secure object pool
+		//		int					-		Count of application invocation parameters
+		//		char*[]				-		Array of pointers to the application invocation parameters
+		//		
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+#ifdef XY_NEEDS_CRYPTO
+		VRMapper(StringPool& PubSpool, SObjectPool& SecPool, int argc, char* argv[]) : SPool(PubSpool), SOPool(SecPool), RString(NULLSTRREF), MTMap(nullptr), CLFPUsed(false), DurableStores(false), PathCache(), PathEntries(0), PathGeneration(0), WatchFD(-1), WatchSeq(0) {
+#else
+		VRMapper(StringPool & PubSpool, int argc, char* argv[]) : SPool(PubSpool), RString(NULLSTRREF), MTMap(nullptr), CLFPUsed(false), DurableStores(false), PathCache(), PathEntries(0), PathGeneration(0), WatchFD(-1), WatchSeq(0) {
+#endif
+
+			//  Discover the project root directory
+			RString = setRoot(argc, argv);
+			if (RString == NULLSTRREF) return;
+
+			//  Setup the Resource Map root 
+			RMap.getRoot()->setName(NULLSTRREF);
+			RMap.getRoot()->setMappedName(RString);
+
+			//  Setup the default nodes of the resource map in the hierarchy
 			//
-			//  Append each segment from the virtual file string onto the mapped file name
+			//	1.		Config		--->		<root>/Config
+			//  2.		Logs		--->		<root>/Logs
 			//
 
-			while (pSeg != nullptr) {
-				while (*pSeg != '\0') {
+			setupDefaultMap();
 
-					//  Determine the length of the next segment
-					SegLen = getSegmentLen(pSeg);
+			//  Return to caller
+			return;
+		}
 
-					//  Attempt to locate the segment in the map
-					if (findMapping(pSeg, SegLen, pMapNode)) {
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Destructor			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
 
-						//  If the mapped path is an absolute path then it replaces any path that has been accumulated so far
-						if (isAbsolute(SPool.getString(pMapNode->getMappedName()))) BfrUsed = 0;
+		//  Destructor
+		//
+		//  Destroys the VRMapper object destroying any contained objects.
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
 
-						//  Check that there is sufficient space in the output buffer for the mapped path plus a delimiter
-						MappedLen = SPool.getLength(pMapNode->getMappedName());
-						if ((BfrLen - BfrUsed) <= MappedLen) {
-							szQFile[0] = '\0';
-							return nullptr;
-						}
+		~VRMapper() {
 
-						//  If there is already a partial path then append a delimiter
-						if (BfrUsed > 0) szQFile[BfrUsed++] = '/';
+			//  Release the resolved path cache and any change notification
+			clearPathCache();
+			setStatCaching(false);
 
-						//  Append the mapped path
-						strcpy_s(szQFile + BfrUsed, BfrLen - BfrUsed, SPool.getString(pMapNode->getMappedName()));
-						BfrUsed += MappedLen;
+			//  Return to caller
+			return;
+		}
 
-						//  Point to the next segment
-						pSeg += SegLen;
-						while (*pSeg == '/' || *pSeg == '\\') pSeg++;
-					}
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Members                                                                                                *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  isFirstCLPUsed
+		//
+		//  This function will indicate if the first command line parameter is used by xymorg (project root directory).
+		//  
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		// 
+		//		bool		-		true if first parameter used, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	isFirstCLPUsed() { return CLFPUsed; }
+
+		//  setDurableStores
+		//
+		//  This function will set whether stored resources must be on stable storage before the store returns.
+		//  
+		//  PARAMETERS:
+		//
+		//		bool		-		true if stores are to be durable, otherwise false
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	setDurableStores(bool Durable) { DurableStores = Durable; return; }
+
+		//  setStatCaching
+		//
+		//  This function will set whether the stat information for resources is held in the resolved path cache.
+		//  
+		//  PARAMETERS:
+		//
+		//		bool		-		true if stat information is to be cached, otherwise false
+		//
+		//  RETURNS:
+		//
+		//		bool		-		true if stat information is now being cached, otherwise false
+		//
+		//  NOTES:
+		//
+		//	1.		Cached stat information is invalidated by change notifications on the directory holding the resource,
+		//			where change notification is not available (non-Linux platforms) stat information is not cached.
+		//	2.		Changes to the ancestors of the directory holding a resource are not observed.
+		//
+
+		bool	setStatCaching(bool Enable) {
+			std::lock_guard<std::mutex>		CacheGuard(PathLock);										//  Cache lock
+
+#if defined(__linux__)
+			//  Start or stop change notification
+			if (Enable && WatchFD < 0) WatchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if (!Enable && WatchFD >= 0) {
+				close(WatchFD);
+				WatchFD = -1;
+			}
+#else
+			Enable = Enable;
+#endif
+
+			//  Discard any stat information held
+			invalidateWatch(-1);
+			return WatchFD >= 0;
+		}
+
+		//  extendConfiguration
+		//
+		//  This function will extend the current configuration of the resource map based on the content of the
+		//  <VRMap> element in the configuration file.
+		//  
+		//
+		//  PARAMETERS:
+		//
+		//		XMLIterator&			-		Reference to the XML iterator for the scope <VRMap>
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	extendConfiguration(XMLMicroParser::XMLIterator & VRMIt) {
+			QHierarchy<RNode>::Node*	pMapPos = RMap.getRoot();									//  Current position in the hierarchy
+			QHierarchy<RNode>::Node*	pSearch = nullptr;											//  Search in the hierarchy
+			const char*					pDir = nullptr;												//  Directory name from config
+			size_t						DirLen = 0;													//  Length of directory name
+
+			//  Check that we have a valid element scope
+			if (VRMIt.isNull()) return;
+
+			//
+			//  Iterate over the content of the map building a new node in the hierarchy for each node identified
+			//
+
+			for (; !VRMIt.isAtEnd(); VRMIt++) {
+
+				//
+				//  Only process "node" elements
+				//
+				if (VRMIt.isNode(NODE_VRES_NODE)) {
+
+					//  Check if this is the closing of the node, in which case move the current position up a level
+					if (VRMIt.isClosing()) pMapPos = pMapPos->getParent();
 					else {
+						//  Verify that the node has name=, type= and target= attributes, discard the node if not well-formed
+						if (VRMIt.hasAttribute(PARM_VRES_NAME) && VRMIt.hasAttribute(PARM_VRES_TYPE) && VRMIt.hasAttribute(PARM_VRES_TGT)) {
 
-						//  There is no mapping for current segment - the remainder of the virtual path is appended
-						MappedLen = strlen(pSeg);
-						if ((BfrLen - BfrUsed) <= MappedLen) {
-							szQFile[0] = '\0';
-							return nullptr;
-						}
+							//  Check that the node does not already exist as a child of the current map position
+							pDir = VRMIt.getAttribute(PARM_VRES_NAME, DirLen);
+							pSearch = pMapPos->getChild();
+							while (pSearch != nullptr) {
+								if (_memicmp(SPool.getString(pSearch->getName()), pDir, DirLen) == 0) break;
+								pSearch = pSearch->getTwin();
+							}
 
-						//  If there is already a partial path then append a delimiter
-						if (BfrUsed > 0) szQFile[BfrUsed++] = '/';
+							//  If the node already exists then check if it needs to be updated, otherwise create the new node
+							if (pSearch != nullptr) {
+								if (_memicmp(SPool.getString(pSearch->getMappedName()), pDir, DirLen) != 0) {
+									//  Mapped name has changed
+									//  1. Replace the string in the pool
+									SPool.replaceString(pSearch->getMappedName(), pDir, DirLen);
 
-						//  Append the virtual path
-						strcpy_s(szQFile + BfrUsed, BfrLen - BfrUsed, pSeg);
-						BfrUsed += MappedLen;
+									//  2.  Create the directory for the new target if it does not already exist
+									createTarget(pSearch);
 
-						pSeg += MappedLen;
+									//  3.  Update the current position to the updated node
+									pMapPos = pSearch;
+								}
+							}
+							else {
+
+								//  Build a new node as the child of the current position
+								pMapPos = pMapPos->addChild();
+
+								//  Add the name
+								pMapPos->setName(SPool.addString(pDir, DirLen));
+
+								//  Add the mapped name
+								pDir = VRMIt.getAttribute(PARM_VRES_TGT, DirLen);
+								pMapPos->setMappedName(SPool.addString(pDir, DirLen));
+
+								//  Create the target directory
+								createTarget(pMapPos);
+							}
+						}
+						else VRMIt++;
 					}
 				}
-				pSeg = nullptr;
 			}
 
-			//  Return the pointer to the mapped buffer
+			//  Resolutions made against the previous map are no longer valid
+			clearPathCache();
+
+			//  Return to caller
+			return;
+		}
+
+		//  mapFile (1)
+		//
+		//  This function resolves an application file reference (virtual) to an external file reference (qualified).
+		//  
+		//
+		//  PARAMETERS:
+		//
+		//		STRREF			-		String reference of the virtual file to be mapped
+		//		char *			-		Pointer to the buffer that is to hold the resulting qualified file name
+		//		size_t			-		Size of the buffer that holds the qualified file name
+		//
+		//  RETURNS:
+		//
+		//		char *			-		Convenience pointer to the qualified file name
+		//
+		//  NOTES:
+		//
+
+		char* mapFile(STRREF VFR, char* szQFile, size_t BfrLen) {
+			return mapFile(SPool.getString(VFR), szQFile, BfrLen);
+		}
+
+
+		//  mapFile (2)
+		//
+		//  This function resolves an application file string (virtual) to an external file reference (qualified).
+		//  
+		//
+		//  PARAMETERS:
+		//
+		//		const char *	-		Const pointer to the virtual file name
+		//		char *			-		Pointer to the buffer that is to hold the resulting qualified file name
+		//		size_t			-		Size of the buffer that holds the qualified file name
+		//
+		//  RETURNS:
+		//
+		//		char *			-		Convenience pointer to the qualified file name
+		//
+		//  NOTES:
+		//
+		//	1.		Resolutions are held in the resolved path cache until the resource map is changed.
+		//
+
+		char* mapFile(const char* szVFile, char* szQFile, size_t BfrLen) {
+			size_t			VLen = 0;																	//  Length of the virtual file name
+			size_t			Hash = 0;																	//  Hash of the virtual file name
+			size_t			Generation = 0;																//  Map generation of the resolution
+			PathEntry*		pEntry = nullptr;															//  Cached resolution
+
+			//  Contract Defense
+			if (szQFile == nullptr || BfrLen == 0) return nullptr;
+			szQFile[0] = '\0';
+			if (szVFile == nullptr) return nullptr;
+
+			//  Absolute file names are not mapped
+			if (isAbsolute(szVFile)) return resolvePath(szVFile, szQFile, BfrLen);
+
+			//
+			//  Return a previous resolution of the virtual file name if there is one
+			//
+
+			VLen = strlen(szVFile);
+			Hash = hashPath(szVFile, VLen);
+			{
+				std::lock_guard<std::mutex>		CacheGuard(PathLock);									//  Cache lock
+
+				pEntry = findPath(szVFile, VLen, Hash);
+				if (pEntry != nullptr) {
+					if (pEntry->QLen >= BfrLen) return nullptr;
+					memcpy(szQFile, pEntry->szQName, pEntry->QLen + 1);
+					return szQFile;
+				}
+				Generation = PathGeneration;
+			}
+
+			//  Resolve the virtual file name through the map and remember the resolution
+			if (resolvePath(szVFile, szQFile, BfrLen) == nullptr) return nullptr;
+			cachePath(szVFile, VLen, Hash, szQFile, Generation);
 			return szQFile;
 		}
 
@@ -459,8 +1215,8 @@ namespace xymorg {
 			ptmLocal = localtime_safe(&ttNow, &tmLocalStore);
 			strftime(szFinalVFile, MAX_PATH, szVirtFile, ptmLocal);
 
-			//  Return the mapped file name
-			return mapFile(szFinalVFile, szQFile, BfrLen);
+			//  Return the mapped file name (time stamped names are not held in the resolved path cache)
+			return resolvePath(szFinalVFile, szQFile, BfrLen);
 		}
 
 		//  makeDirectory
@@ -626,6 +1382,41 @@ namespace xymorg {
 			return pFImg;
 		}
 
+		//  mapResource
+		//
+		//  Opens a read-only view of the resource identified by the passed virtual file name.
+		//
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the virtual file name of the resource
+		//		int				-		Expected access pattern (MappedResource::AdviseXXX)
+		//
+		//  RETURNS:
+		//
+		//		MappedResource	-		View of the resource, not loaded if the resource could not be opened
+		//
+		//  NOTES:
+		//
+		//	1.		The content of the view is null terminated, it is released when the view is destroyed.
+		//
+
+		MappedResource	mapResource(const char* szVRN, int Advice = MappedResource::AdviseSequential) {
+			MappedResource		Res;																			//  Resource view
+			char				szFileName[MAX_PATH + 1] = {};													//  Mapped file name
+
+			//  Safety
+			if (szVRN == nullptr) return Res;
+			if (szVRN[0] == '\0') return Res;
+
+			//  Map the virtual file name to the real name
+			mapFile(szVRN, szFileName, MAX_PATH + 1);
+			if (szFileName[0] == '\0') return Res;
+
+			//  Open the view
+			Res.open(szFileName, Advice);
+			return Res;
+		}
+
 		//  loadCharmedResource
 		//
 		//  Loads the charmed resource identified by the passed virtual file name. Returns a pointer to the loaded uncharmed file and the length of the loaded file.
@@ -644,45 +1435,47 @@ namespace xymorg {
 		//  NOTES:
 		//
 		//	1.		If the resource loaded is NOT a charmed stream then it is returned as is.
+		//	2.		When encryption is not configured a charmed stream is decompressed directly from the mapped image.
 		//  
 
 		BYTE* loadCharmedResource(const char* szVRN, size_t & ResLen, int EncScheme, STRREF EncKey) {
-			size_t		RSize = 0;																					//  Resource size
-			BYTE* pResource = loadResource(szVRN, RSize);														//  Loaded resource
+			MappedResource	Res = mapResource(szVRN);															//  Resource view
+			const BYTE*		pImg = Res.getData();																//  Resource image
+			size_t			RSize = Res.getSize();																//  Resource size
+			BYTE*			pResource = nullptr;																//  Loaded resource
 
 			//  Clear the returned length
 			ResLen = 0;
 
 			//  Check that the resource (charmed) was loaded
-			if (pResource == nullptr) return nullptr;
-			if (RSize < 5) {
-				ResLen = RSize;
-				return pResource;
-			}
+			if (!Res.isLoaded()) return nullptr;
 
-			//  Check that the loaded stream is charmed, if not then return the raw resource
+			//  Check that the loaded stream is charmed, if not then return a copy of the raw resource
 			//  'CHx:' - where x is the encryption scheme
-			if (pResource[0] != 'C') {
-				ResLen = RSize;
-				return pResource;
-			}
-
-			if (pResource[1] != 'H') {
-				ResLen = RSize;
-				return pResource;
-			}
-
-			if (pResource[3] != ':') {
-				ResLen = RSize;
+			if (RSize < 5 || pImg[0] != 'C' || pImg[1] != 'H' || pImg[3] != ':') {
+				pResource = Res.acquireBuffer(ResLen);
+				if (pResource == nullptr) pResource = copyImage(pImg, RSize, ResLen);
 				return pResource;
 			}
 
+#ifdef  XY_NEEDS_CRYPTO
 			//
-			//  Decrypt and decompress the charmed stream
-			//  The input stream is consumed by the uncharming process
+			//  The stream may be encrypted, it is uncharmed from a private copy that is consumed by the uncharming process
 			//
-
+			pResource = copyImage(pImg, RSize, RSize);
+			if (pResource == nullptr) return nullptr;
 			pResource = uncharmStream(pResource, RSize, EncScheme, EncKey);
+#else
+			//
+			//  Decompress the charmed stream directly from the image, if it cannot be decompressed then return the
+			//  compressed stream
+			//
+			EncScheme = EncScheme;
+			EncKey = EncKey;
+			RSize = RSize - 4;
+			pResource = decompressImage(pImg + 4, RSize);
+			if (pResource == nullptr) return copyImage(pImg + 4, RSize, ResLen);
+#endif
 
 			//  Return the uncharmed resource to the caller
 			ResLen = RSize;
@@ -706,20 +1499,13 @@ namespace xymorg {
 
 		bool		isValidResource(const char* szVRN) {
 			struct stat			FileInfo = {};																//  File stat information
-			char				szFileName[MAX_PATH + 1] = {};												//  Mapped file name
 
 			//  Safety
 			if (szVRN == nullptr) return false;
 			if (szVRN[0] == '\0') return false;
 
-			//  Map the file to the real file space
-			mapFile(szVRN, szFileName, MAX_PATH + 1);
-
-			//  Check that the file name was mappable
-			if (szFileName[0] == '\0') return false;
-
 			//  Stat the file to check that it exists
-			if (stat(szFileName, &FileInfo) == -1) return false;
+			if (!statResource(szVRN, FileInfo)) return false;
 
 			//  Return showing that the resource is valid
 			return true;
@@ -742,18 +1528,13 @@ namespace xymorg {
 
 		size_t		getResourceSize(const char* szVRN) {
 			struct stat			FileInfo = {};																//  File stat information
-			char				szFileName[MAX_PATH + 1] = {};												//  Mapped file name
 
 			//  Safety
 			if (szVRN == nullptr) return 0;
 			if (szVRN[0] == '\0') return 0;
 
-			//  Map the file to the real file space
-			mapFile(szVRN, szFileName, MAX_PATH + 1);
-			if (szFileName[0] == '\0') return 0;
-
 			//  Stat the file
-			if (stat(szFileName, &FileInfo) == -1) return 0;
+			if (!statResource(szVRN, FileInfo)) return 0;
 
 			//  Return the size
 			return size_t(FileInfo.st_size);
@@ -778,18 +1559,13 @@ namespace xymorg {
 			struct stat			FileInfo = {};																//  File stat information
 			struct tm			tmLocalStore = {};															//  Storage for local time
 			struct tm*			ptmCreate = {};																//  Local time structure
-			char				szFileName[MAX_PATH + 1] = {};												//  Mapped file name
 
 			//  Safety
 			if (szVRN == nullptr) return FileInfo.st_ctime;
 			if (szVRN[0] == '\0') return FileInfo.st_ctime;
 
-			//  Map the file to the real file space
-			mapFile(szVRN, szFileName, MAX_PATH + 1);
-			if (szFileName[0] == '\0') return FileInfo.st_ctime;
-
 			//  Stat the file
-			if (stat(szFileName, &FileInfo) == -1) return FileInfo.st_ctime;
+			if (!statResource(szVRN, FileInfo)) return FileInfo.st_ctime;
 
 			//  Cycle the time to local time zone
 			ptmCreate = localtime_safe(&FileInfo.st_ctime, &tmLocalStore);
@@ -815,18 +1591,13 @@ namespace xymorg {
 			struct stat			FileInfo = {};																//  File stat information
 			struct tm			tmLocalStore = {};															//  Storage for local time
 			struct tm*			ptmMod = {};																//  Local time structure
-			char				szFileName[MAX_PATH + 1] = {};												//  Mapped file name
 
 			//  Safety
 			if (szVRN == nullptr) return FileInfo.st_mtime;
 			if (szVRN[0] == '\0') return FileInfo.st_mtime;
 
-			//  Map the file to the real file space
-			mapFile(szVRN, szFileName, MAX_PATH + 1);
-			if (szFileName[0] == '\0') return FileInfo.st_mtime;
-
 			//  Stat the file
-			if (stat(szFileName, &FileInfo) == -1) return FileInfo.st_mtime;
+			if (!statResource(szVRN, FileInfo)) return FileInfo.st_mtime;
 
 			//  Cycle the time to local time zone
 			ptmMod = localtime_safe(&FileInfo.st_mtime, &tmLocalStore);
@@ -891,40 +1662,22 @@ namespace xymorg {
 		//		bool			-		true if the resource was stored, otherwise false
 		//
 		//  NOTES:
+		//
+		//	1.		The resource is written to a temporary file that then replaces the target, if the store fails
+		//			the existing target is unchanged.
+		//	2.		If durable stores are set the content is synchronised to storage before the target is replaced.
 		//  
 
 		bool	storeResource(const char* szVRN, BYTE * pRes, size_t ResLen, bool Dispose) {
-			FILE*		pRFile = nullptr;																					//  Handle of the resource file
-			errno_t		Result = 0;																							//  Return from fopen_s()
-			size_t		ElementsWrit = 0;																					//  Number of alements written
-			char		szFileName[MAX_PATH + 1];																			//  Mapped file name
+			ResourceWriter		Writer;																				//  Resource writer
 
 			//  Safety
-			if (szVRN == nullptr) return false;
-			if (szVRN[0] == '\0') return false;
 			if (pRes == nullptr) return false;
 
-			//  Map the virtual file name to the real name
-			mapFile(szVRN, szFileName, MAX_PATH + 1);
-			if (szFileName[0] == '\0') return false;
-
-			//  Open the requested file for output
-			Result = fopen_s(&pRFile, szFileName, "wb");
-			if (Result != 0) return false;
-
-			//  Write the file contents
-			if (pRFile != nullptr) {
-				if (ResLen > 0) {
-					ElementsWrit = fwrite(pRes, 1, ResLen, pRFile);
-					if (ElementsWrit != ResLen) {
-						fclose(pRFile);
-						return false;
-					}
-				}
-
-				//  Close the output file
-				fclose(pRFile);
-			}
+			//  Write the resource and replace the target
+			if (!openResourceWriter(szVRN, Writer)) return false;
+			if (!Writer.write(pRes, ResLen)) return false;
+			if (!Writer.commit(DurableStores)) return false;
 
 			//  Consume the resource
 			if (Dispose) free(pRes);
@@ -933,6 +1686,40 @@ namespace xymorg {
 			return true;
 		}
 
+		//  openResourceWriter
+		//
+		//  Opens a writer for the specified (virtual) file, the content written replaces the resource when the writer
+		//  is committed.
+		//
+		//  PARAMETERS:
+		//
+		//		const char*			-		Const pointer to the virtual file name of the resource
+		//		ResourceWriter&		-		Reference to the writer to open
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the writer was opened, otherwise false
+		//
+		//  NOTES:
+		//
+		//	1.		Large resources may be written in parts without holding the whole resource in memory.
+		//  
+
+		bool	openResourceWriter(const char* szVRN, ResourceWriter & Writer) {
+			char		szFileName[MAX_PATH + 1] = {};																//  Mapped file name
+
+			//  Safety
+			if (szVRN == nullptr) return false;
+			if (szVRN[0] == '\0') return false;
+
+			//  Map the virtual file name to the real name
+			mapFile(szVRN, szFileName, MAX_PATH + 1);
+			if (szFileName[0] == '\0') return false;
+
+			//  Open the writer
+			return Writer.open(szFileName);
+		}
+
 		//  storeCharmedResource
 		//
 		//  Charms and stores the passed resource in the specified (virtual) file
@@ -950,11 +1737,18 @@ namespace xymorg {
 		//		bool			-		true if the resource was stored, otherwise false
 		//
 		//  NOTES:
+		//
+		//	1.		The passed resource is consumed.
+		//	2.		Resources of StreamThreshold bytes or more that are not encrypted are compressed incrementally into the
+		//			writer, the whole compressed stream is never held in memory.
 		//  
 
 		bool	storeCharmedResource(const char* szVRN, BYTE * pRes, size_t ResLen, int EncScheme, STRREF EncKey) {
-			BYTE* pCStream = nullptr;														//  Pointer to the charmed stream
-			size_t		CSize = 0;																//  Charmed size
+			BYTE*				pCStream = nullptr;														//  Pointer to the charmed stream
+			size_t				CSize = 0;																//  Charmed size
+			ResourceWriter		Writer;																	//  Resource writer
+			BYTE				Signature[4] = { 'C', 'H', BYTE('1' + EncScheme), ':' };				//  Charm signature
+			bool				Stored = false;															//  Resource stored
 
 			//  Safety
 			if (szVRN == nullptr) return false;
@@ -962,6 +1756,21 @@ namespace xymorg {
 			if (pRes == nullptr) return false;
 			if (EncScheme > 1) return false;
 
+			//
+			//  Large resources that are not encrypted are streamed through the compressor into the writer
+			//
+#ifdef  XY_NEEDS_CRYPTO
+			if (EncScheme == 0 && ResLen >= StreamThreshold) {
+#else
+			if (ResLen >= StreamThreshold) {
+#endif
+				if (openResourceWriter(szVRN, Writer)) {
+					if (Writer.write(Signature, 4) && writeCompressedStream(pRes, ResLen, Writer)) Stored = Writer.commit(DurableStores);
+				}
+				free(pRes);
+				return Stored;
+			}
+
 			//
 			//  Charm the input stream
 			//
@@ -969,11 +1778,18 @@ namespace xymorg {
 			pCStream = charmStream(pRes, CSize, EncScheme, EncKey);
 			if (pCStream == nullptr) return false;
 
+			//  If the stream could not be charmed then store it as is
+			if (pCStream == pRes) return storeResource(szVRN, pCStream, CSize);
+
 			//
-			//  Store the resulting resource
+			//  Store the signature followed by the charmed stream
 			//
 
-			return storeResource(szVRN, pCStream, CSize);
+			if (openResourceWriter(szVRN, Writer)) {
+				if (Writer.write(Signature, 4) && Writer.write(pCStream, CSize)) Stored = Writer.commit(DurableStores);
+			}
+			free(pCStream);
+			return Stored;
 		}
 
 		//  deleteResource
@@ -1044,11 +1860,34 @@ namespace xymorg {
 				free(MTMap);
 				MTMap = nullptr;
 			}
+			MTView.release();
+
+			//  Discard the resolved path cache
+			clearPathCache();
 
 			//  Return to caller
 			return;
 		}
 
+		//  clearPathCache
+		//
+		//  Discards all of the resolutions held in the resolved path cache
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void		clearPathCache() {
+			std::lock_guard<std::mutex>		CacheGuard(PathLock);										//  Cache lock
+
+			purgePaths();
+			PathGeneration++;
+			return;
+		}
+
 		//  getMIMEType
 		//
 		//  This function will locate and return the MIME type of a file given the name (file extension)
@@ -1066,8 +1905,8 @@ namespace xymorg {
 
 		void		getMIMEType(const char* FileName, char* MIMEType, size_t BfrLen) {
 			const char* pFileExt = nullptr;														//  Pointer to the file type
-			char* pMapEntry = nullptr;													//  Pointer to the entry in the mapping file
-			char* pScan = nullptr;														//  Scanning pointer
+			const char* pMapEntry = nullptr;													//  Pointer to the entry in the mapping file
+			const char* pScan = nullptr;														//  Scanning pointer
 
 			//  Safety
 			if (MIMEType == nullptr) return;
@@ -1181,6 +2020,38 @@ namespace xymorg {
 
 	private:
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Constants		                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		static const size_t		PathBuckets = 256;												//  Number of resolved path cache buckets
+		static const size_t		PathCacheLimit = 4096;											//  Maximum number of resolved paths held
+		static const size_t		FrameThreshold = 2 * Chimera::DefaultBlockSize;					//  Smallest stream compressed as a frame
+		static const size_t		StreamThreshold = 16 * Chimera::DefaultBlockSize;					//  Smallest resource compressed as a stream
+		static const size_t		StreamDrainSize = 64 * 1024;									//  Stream drain buffer size
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Structures	                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Resolved Path (the virtual and qualified names follow the entry in the same allocation)
+		typedef struct PathEntry {
+			PathEntry*		pNext;																	//  Next entry in the bucket
+			size_t			Hash;																	//  Hash of the virtual name
+			size_t			VLen;																	//  Length of the virtual name
+			size_t			QLen;																	//  Length of the qualified name
+			char*			szVName;																//  Virtual name
+			char*			szQName;																//  Qualified name
+			int				WD;																		//  Watch descriptor of the containing directory
+			bool			StatValid;																//  Cached stat information is valid
+			bool			Exists;																	//  Resource existed when stat'ed
+			struct stat		Info;																	//  Cached stat information
+		} PathEntry;
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Members																								*
@@ -1190,8 +2061,16 @@ namespace xymorg {
 		StringPool&			SPool;													//  Public string pool
 		STRREF				RString;												//  Root string reference
 		QHierarchy<RNode>	RMap;													//  Resource Map
-		char*				MTMap;													//  MIME type file image
+		char*				MTMap;													//  MIME type additions
+		MappedResource		MTView;													//  MIME type system map
 		bool				CLFPUsed;												//  First command line parameter is used
+		bool				DurableStores;											//  Stored resources are synchronised to storage
+		PathEntry*			PathCache[PathBuckets];									//  Resolved path cache
+		size_t				PathEntries;											//  Count of resolved paths held
+		size_t				PathGeneration;											//  Resource map generation
+		int					WatchFD;												//  Change notification descriptor (stat caching)
+		size_t				WatchSeq;												//  Change notification sequence
+		std::mutex			PathLock;												//  Resolved path cache lock
 
 #ifdef XY_NEEDS_CRYPTO
 		SObjectPool&		SOPool;													//  Secure object pool
@@ -1221,6 +2100,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 		//	1.		If the stream cannot be charmed then it is returned as is.
+		//	2.		The charm signature ('CHx:') is not included, it is written ahead of the stream when it is stored.
 		//  
 
 		BYTE* charmStream(BYTE * pPStream, size_t & RSize, int EncScheme, STRREF EncKey) {
@@ -1229,6 +2109,7 @@ namespace xymorg {
 
 			//  Safety
 			EncKey = EncKey;
+			EncScheme = EncScheme;
 			if (pPStream == nullptr) return nullptr;
 			if (RSize == 0) return pPStream;
 
@@ -1238,7 +2119,11 @@ namespace xymorg {
 			CSize = RSize;
 			pCStream = compressStream(pPStream, CSize);
 			if (pCStream == nullptr) return pPStream;
-			if (CSize == 0) return pPStream;
+			if (pCStream == pPStream) return pPStream;
+			if (CSize == 0) {
+				free(pCStream);
+				return nullptr;
+			}
 
 #ifdef  XY_NEEDS_CRYPTO
 			//
@@ -1247,27 +2132,10 @@ namespace xymorg {
 			pCStream = encryptStream(pCStream, CSize, EncScheme, EncKey);
 			if (pCStream == NULL) return NULL;
 #endif
-			//  Form the charmed stream
-			BYTE* pNewCStream = (BYTE*)malloc(CSize + 4);
-			if (pNewCStream == nullptr) {
-				free(pCStream);
-				return nullptr;
-			}
-
-			//  Insert the charm signature
-			pNewCStream[0] = 'C';
-			pNewCStream[1] = 'H';
-			pNewCStream[2] = BYTE('1' + EncScheme);
-			pNewCStream[3] = ':';
-
-			//  Copy the charmed data into the new stream
-			memcpy(pNewCStream + 4, pCStream, CSize);
-			CSize += 4;
-			free(pCStream);
 
 			//  Return the charmed stream
 			RSize = CSize;
-			return pNewCStream;
+			return pCStream;
 		}
 
 		//  uncharmStream
@@ -1490,6 +2358,8 @@ namespace xymorg {
 		//  NOTES:
 		//
 		//	1.		If the stream cannot be compressed then it is returned as is.
+		//	2.		Streams of FrameThreshold bytes or more are compressed as a Chimera frame.
+		//	3.		The output buffer starts at half of the plaintext size and is extended as needed.
 		//
 
 		BYTE* compressStream(BYTE * pPStream, size_t & RSize) {
@@ -1497,7 +2367,7 @@ namespace xymorg {
 			size_t				CompSize = 0;																		//  Size of the compressed stream
 			xymorg::Chimera		MyEncoder(std::cout);																//  Chimera Encoder
 			xymorg::ByteStream	bsIn(pPStream, RSize);																//  Input stream
-			xymorg::ByteStream	bsOut(2 * RSize, 4096);																//  Output stream
+			xymorg::ByteStream	bsOut((RSize / 2) + 4096, (RSize / 4) + 4096);										//  Output stream (grows on demand)
 
 			//  Safety
 			if (pPStream == nullptr) return nullptr;
@@ -1509,13 +2379,18 @@ namespace xymorg {
 			MyEncoder.permitOptions(0);
 
 			//
-			//  Compress the stream
+			//  Compress the stream, large streams are compressed as a frame of blocks in parallel
 			//
-			CompSize = MyEncoder.compress(bsIn, bsOut);
+			if (RSize >= FrameThreshold) CompSize = MyEncoder.compressFramed(bsIn, bsOut);
+			else CompSize = MyEncoder.compress(bsIn, bsOut);
+			if (CompSize == 0) return pPStream;
 			pComp = bsOut.acquireBuffer(CompSize);
 
 			//  If compression failed return the plaintext stream
-			if (RSize == 0) return pPStream;
+			if (CompSize == 0 || pComp == nullptr) {
+				if (pComp != nullptr) free(pComp);
+				return pPStream;
+			}
 
 			//  Free the passed plaintext stream and return the compressed stream
 			free(pPStream);
@@ -1523,6 +2398,61 @@ namespace xymorg {
 			return pComp;
 		}
 
+		//  writeCompressedStream
+		//
+		//  This function will compress (chimera) the passed plaintext stream incrementally into the passed resource writer.
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*				-		Const pointer to the plaintext stream
+		//		size_t				-		Size of the plaintext stream
+		//		ResourceWriter&		-		Reference to the open writer that receives the compressed stream
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the compressed stream was written, otherwise false
+		//
+		//  NOTES:
+		//
+		//	1.		Only a single stream block and the drain buffer are held, the output is a Chimera stream ('CHS1').
+		//
+
+		bool	writeCompressedStream(const BYTE * pPStream, size_t RSize, ResourceWriter & Writer) {
+			xymorg::Chimera		MyEncoder(std::cout);																//  Chimera Encoder
+			BYTE*				pDrain = nullptr;																	//  Drain buffer
+			size_t				Fed = 0;																			//  Plaintext bytes fed
+			size_t				DLen = 0;																			//  Bytes drained
+			bool				Written = true;																		//  Stream written
+
+			//  Safety
+			if (pPStream == nullptr) return false;
+
+			//
+			//  Configure Chimera to be a pure entropy encoder/decoder
+			//
+			MyEncoder.permitOptions(0);
+
+			xymorg::Chimera::StreamEncoder	Stream(MyEncoder);														//  Stream encoder
+
+			if (Stream.hasFailed()) return false;
+			pDrain = (BYTE*)malloc(StreamDrainSize);
+			if (pDrain == nullptr) return false;
+
+			//
+			//  Feed the plaintext and drain the compressed stream into the writer until the stream is complete
+			//
+			while (Written && !Stream.isFinished()) {
+				if (Fed < RSize) Fed += Stream.feed(pPStream + Fed, RSize - Fed);
+				else Stream.finish();
+				DLen = Stream.drain(pDrain, StreamDrainSize);
+				if (DLen > 0) Written = Writer.write(pDrain, DLen);
+			}
+
+			//  Return the outcome
+			free(pDrain);
+			return Written;
+		}
+
 		//  decompressStream
 		//
 		//  This function will decompress (chimera) the passed charmed stream.
@@ -1534,42 +2464,156 @@ namespace xymorg {
 		//
 		//  RETURNS:
 		//
-		//		BYTE*			-		Pointer to the deccompressed stream
+		//		BYTE*			-		Pointer to the deccompressed stream
+		//
+		//  NOTES:
+		//
+		//	1.		If the stream cannot be decompressed then it is returned as is.
+		//
+
+		BYTE* decompressStream(BYTE * pCStream, size_t & RSize) {
+			BYTE*				pDecomp = nullptr;																	//  Decompressed Stream
+			size_t				DecompSize = RSize;																	//  Size of the decompressed stream
+
+			//  Safety
+			if (pCStream == nullptr) return nullptr;
+			if (RSize == 0) return pCStream;
+
+			//
+			//  Decompress the stream
+			//
+			pDecomp = decompressImage(pCStream, DecompSize);
+
+			//  If the decompression failed then return the native (compressed) stream
+			if (pDecomp == nullptr) return pCStream;
+
+			//  Free the passed compressed stream and return the decompressed stream
+			free(pCStream);
+			RSize = DecompSize;
+			return pDecomp;
+		}
+
+		//  decompressImage
+		//
+		//  This function will decompress (chimera) the passed compressed image into a new stream, the image is not altered.
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*			-		Const pointer to the compressed image
+		//		size_t&			-		Reference to the variabe holding the size of the image, updated to the output size on return
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the deccompressed stream, nullptr if the image could not be decompressed
+		//
+		//  NOTES:
+		//
+		//	1.		The image may be a Chimera frame, a Chimera stream or a single compressed block.
+		//
+
+		BYTE* decompressImage(const BYTE * pCImage, size_t & RSize) {
+			BYTE*				pDecomp = nullptr;																	//  Decompressed Stream
+			size_t				DecompSize = 0;																		//  Size of the decompressed stream
+			xymorg::Chimera		MyDecoder(std::cout);																//  Chimera Decoder
+			xymorg::ByteStream	bsIn(const_cast<BYTE*>(pCImage), RSize);											//  Input stream (read only)
+			xymorg::ByteStream	bsOut(4 * RSize, 4096);																//  Output stream
+
+			//  Safety
+			if (pCImage == nullptr || RSize == 0) return nullptr;
+
+			//
+			//  Configure Chimera to be a pure entropy encoder/decoder
+			//
+			MyDecoder.permitOptions(0);
+
+			//
+			//  Decompress the image, either as a frame of blocks, as an incremental stream or as a single stream
+			//
+			if (xymorg::Chimera::getFrameLength(pCImage, RSize) == RSize) DecompSize = MyDecoder.decompressFramed(bsIn, bsOut);
+			else if (RSize > 4 && memcmp(pCImage, "CHS1", 4) == 0) DecompSize = decodeStreamImage(MyDecoder, pCImage, RSize, bsOut);
+			else DecompSize = MyDecoder.decompress(bsIn, bsOut);
+			if (DecompSize == 0) return nullptr;
+
+			//  Return the decompressed stream
+			pDecomp = bsOut.acquireBuffer(DecompSize);
+			RSize = DecompSize;
+			return pDecomp;
+		}
+
+		//  decodeStreamImage
+		//
+		//  This function will decompress a Chimera stream image (written by writeCompressedStream) into the passed output stream.
+		//
+		//  PARAMETERS:
+		//
+		//		Chimera&		-		Reference to the configured decoder
+		//		BYTE*			-		Const pointer to the stream image
+		//		size_t			-		Size of the image
+		//		ByteStream&		-		Reference to the output stream
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		Size of the decompressed content, 0 if the image is not a complete valid stream
+		//
+		//  NOTES:
+		//
+
+		size_t	decodeStreamImage(xymorg::Chimera & MyDecoder, const BYTE * pCImage, size_t RSize, xymorg::ByteStream & bsOut) {
+			xymorg::Chimera::StreamDecoder	Stream(MyDecoder);														//  Stream decoder
+			BYTE*							pDrain = (BYTE*)malloc(StreamDrainSize);								//  Drain buffer
+			size_t							Fed = 0;																//  Image bytes fed
+			size_t							DLen = 0;																//  Bytes drained
+			size_t							Accepted = 0;															//  Bytes accepted by the decoder
+			size_t							DecompSize = 0;															//  Decompressed size
+
+			if (pDrain == nullptr) return 0;
+
+			//
+			//  Feed the image and drain the content until the stream is complete, invalid or no progress can be made
+			//
+			while (!Stream.isComplete() && !Stream.hasFailed()) {
+				Accepted = Stream.feed(pCImage + Fed, RSize - Fed);
+				Fed += Accepted;
+				DLen = Stream.drain(pDrain, StreamDrainSize);
+				if (DLen > 0 && bsOut.writeSpan(pDrain, DLen) != DLen) break;
+				DecompSize += DLen;
+				if (Accepted == 0 && DLen == 0) break;
+			}
+
+			//  The whole image must be a complete stream
+			free(pDrain);
+			if (!Stream.isComplete() || Fed != RSize) return 0;
+			return DecompSize;
+		}
+
+		//  copyImage
+		//
+		//  This function will return a private copy of a resource image.
+		//
+		//  PARAMETERS:
+		//
+		//		BYTE*			-		Const pointer to the image
+		//		size_t			-		Size of the image
+		//		size_t&			-		Reference to the variable that will hold the size of the copy
+		//
+		//  RETURNS:
+		//
+		//		BYTE*			-		Pointer to the copy, nullptr if storage is exhausted
 		//
 		//  NOTES:
 		//
-		//	1.		If the stream cannot be decompressed then it is returned as is.
+		//	1.		The copy has the same layout as a loaded resource, it is null terminated with room for a cr/lf insert.
 		//
 
-		BYTE* decompressStream(BYTE * pCStream, size_t & RSize) {
-			BYTE*				pDecomp = nullptr;																	//  Decompressed Stream
-			size_t				DecompSize = 0;																		//  Size of the decompressed stream
-			xymorg::Chimera		MyDecoder(std::cout);																//  Chimera Decoder
-			xymorg::ByteStream	bsIn(pCStream, RSize);																//  Input stream
-			xymorg::ByteStream	bsOut(4 * RSize, 4096);																//  Output stream
-
-			//  Safety
-			if (pCStream == nullptr) return nullptr;
-			if (RSize == 0) return pCStream;
-
-			//
-			//  Configure Chimera to be a pure entropy encoder/decoder
-			//
-			MyDecoder.permitOptions(0);
-
-			//
-			//  Decompress the stream
-			//
-			DecompSize = MyDecoder.decompress(bsIn, bsOut);
-
-			//  If the decompression failed then return the native (compressed) stream
-			if (DecompSize == 0) return pCStream;
+		BYTE* copyImage(const BYTE * pImg, size_t ImgLen, size_t & CopyLen) {
+			BYTE*		pCopy = (BYTE*)malloc(ImgLen + 3);													//  Copy of the image
 
-			//  Free the passed compressed stream and return the decompressed stream
-			free(pCStream);
-			pDecomp = bsOut.acquireBuffer(DecompSize);
-			RSize = DecompSize;
-			return pDecomp;
+			CopyLen = 0;
+			if (pCopy == nullptr) return nullptr;
+			memcpy(pCopy, pImg, ImgLen);
+			pCopy[ImgLen] = '\0';
+			CopyLen = ImgLen;
+			return pCopy;
 		}
 
 		//  SetRoot
@@ -1661,167 +2705,599 @@ namespace xymorg {
 								pTgt++;
 							}
 
-							//  If the terminal character is a directory separator then lose it
-							while (*(pTgt - 1) == '/' && pTgt > szRootDir) pTgt--;
-							*pTgt = '\0';
+							//  If the terminal character is a directory separator then lose it
+							while (*(pTgt - 1) == '/' && pTgt > szRootDir) pTgt--;
+							*pTgt = '\0';
+
+							//  Check that the provisional directory exists and is a directory
+							if (isDirectory(szRootDir)) {
+								free(pEnvVar);
+								return SPool.addString(szRootDir);
+							}
+
+							//  Clear the provisional directory name
+							szRootDir[0] = '\0';
+						}
+					}
+				}
+				free(pEnvVar);
+			}
+
+			//
+			//  (3)		-		Use the parent directory of the directory from which the applicaton was invoked
+			//
+			//  This assumes that a standalone project is in use with executables located in <project root>/<exectables directory>
+			//
+
+			getExecutablePath(szXPath, MAX_PATH + 1);
+			pSrc = szXPath;
+
+			//  Copy the provisional root directory to the persistent member, the string is normalised in this process
+			while (*pSrc != '\0') {
+				if (*pSrc == '\\') *pTgt = '/';
+				else *pTgt = *pSrc;
+				if (*pTgt == '/') SepCount++;
+				pSrc++;
+				pTgt++;
+			}
+
+			//  We need at least 3 separators in the program file path
+			if (SepCount >= 3) {
+				//  Back the target up to the previous directory separator
+				while (*pTgt != '/') pTgt--;
+				pTgt--;
+				//  Back the target up to the previous directory separator
+				while (*pTgt != '/') pTgt--;
+				*pTgt = '\0';
+
+				//  Check that the provisional directory exists and is a directory
+				if (isDirectory(szRootDir)) return SPool.addString(szRootDir);
+
+				//  Clear the provisional directory name
+				szRootDir[0] = '\0';
+			}
+
+			//
+			//  (4)		-		No project root directory could be determined
+			//
+
+			std::cerr << "ERROR: No project root directory is available, logging and other basic functions will not be available to the program." << std::endl;
+
+			//  Return to caller
+			return NULLSTRREF;
+		}
+
+		//  getExecutablePath
+		//
+		//  This function will return the executable path of the current program.
+		//  If the path cannot be determined then a platform dependent default is returned.
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the buffer to hold the returned file name
+		//		size_t			-		Size of the buffer
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		//
+		//  PLATFORM DEPENDENT VERSIONS
+		//
+
+#if  (defined(_WIN32) || defined(_WIN64))
+		//
+		//  WINDOWS PLATFORM VERSIONS
+		//
+		void getExecutablePath(char* szXPath, size_t BfrSize) {
+			int			Size = 0;																	//  Returned size
+
+			//  Get the executable path
+			Size = GetModuleFileName(NULL, szXPath, DWORD(BfrSize));
+
+			//  If we failed to get one then pass back a dummy file name that will cause a default project root to be used
+			if (Size == 0) strcpy_s(szXPath, BfrSize, "c:\\xybase\\Bin\\application.exe");
+
+			//  Return to caller
+			return;
+		}
+
+#else
+		//
+		//  UNIX/LINUX PLATFORM VERSIONS
+		//
+		void getExecutablePath(char* szXPath, size_t BfrSize) {
+			int			Size = 0;																	//  Returned size
+			char		szLink[64];																	//  Program file name symbolic link
+
+			//  Build the symbolic link
+			sprintf_s(szLink, 64, "/proc/%d/exe", getpid());
+
+			//  Read the link
+			Size = readlink(szLink, szXPath, BfrSize);
+
+			//  If we failed to get one then pass back a dummy file name that will cause a default project root to be used
+			if (Size == 0) strcpy_s(szXPath, BfrSize, "/var/xybase/Bin/application");
+
+			//  Return to caller
+			return;
+		}
+
+#endif
+
+		//  setupDefaultMap
+		//
+		//  This function will setup the default resource map nodes.
+		//
+		//	DEFAULT MAP
+		//	-----------
+		//  
+		//	1.		Config		--->		<root>/Config
+		//  2.		Logs		--->		<root>/Logs
+		//
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//  
+
+		void	setupDefaultMap() {
+			STRREF			CFGString = NULLSTRREF;														//  Config string
+			STRREF			LogString = NULLSTRREF;														//  Logs string
+			QHierarchy<RNode>::Node* pRNode = nullptr;												//  Resource Node
+
+			//  Add the default map node strings to the String Pool
+			CFGString = SPool.addString("Config");
+			LogString = SPool.addString("Logs");
+
+			//  Add the child nodes to the resource map
+			pRNode = RMap.getRoot()->addChild();
+			pRNode->setName(CFGString);
+			pRNode->setMappedName(CFGString);
+			createTarget(pRNode);
+
+			pRNode = RMap.getRoot()->addChild();
+			pRNode->setName(LogString);
+			pRNode->setMappedName(LogString);
+			createTarget(pRNode);
+
+			//  Return to caller
+			return;
+		}
+
+		//  resolvePath
+		//
+		//  This function resolves an application file string (virtual) to an external file reference (qualified) by
+		//  walking the resource map.
+		//  
+		//
+		//  PARAMETERS:
+		//
+		//		const char *	-		Const pointer to the virtual file name
+		//		char *			-		Pointer to the buffer that is to hold the resulting qualified file name
+		//		size_t			-		Size of the buffer that holds the qualified file name
+		//
+		//  RETURNS:
+		//
+		//		char *			-		Convenience pointer to the qualified file name, nullptr if it could not be resolved
+		//
+		//  NOTES:
+		//
+
+		char* resolvePath(const char* szVFile, char* szQFile, size_t BfrLen) {
+			const char*		pSeg = szVFile;																//  Pointer to the next segment to process
+			size_t			SegLen = 0;																	//  Next segment length
+			size_t			MappedLen = 0;																//  Length of a mapped segment
+			size_t			BfrUsed = 0;																//  Bytes used in the output buffer
+			QHierarchy<RNode>::Node* pMapNode = nullptr;											//  Current node in the resource hierarchy
+
+			//  Contract Defense
+			if (szQFile == nullptr || BfrLen == 0) return nullptr;
+			szQFile[0] = '\0';
+
+			//
+			//  If the virtual file name is absolute then copy it to the output (if there is room)
+			//
+
+			if (isAbsolute(szVFile)) {
+				MappedLen = strlen(szVFile);
+				if (MappedLen >= BfrLen) return nullptr;
+				strcpy_s(szQFile, BfrLen, szVFile);
+				return szQFile;
+			}
+
+			//
+			//  Insert the <root> mapped string into the qualified file name
+			//
+
+			MappedLen = SPool.getLength(RString);
+			if (MappedLen >= BfrLen) return nullptr;
+			strcpy_s(szQFile, BfrLen, SPool.getString(RString));
+			BfrUsed = MappedLen;
+
+			//  Set position in the hierarchy
+			pMapNode = RMap.getRoot();
+
+			//
+			//  Append each segment from the virtual file string onto the mapped file name
+			//
+
+			while (pSeg != nullptr) {
+				while (*pSeg != '\0') {
+
+					//  Determine the length of the next segment
+					SegLen = getSegmentLen(pSeg);
+
+					//  Attempt to locate the segment in the map
+					if (findMapping(pSeg, SegLen, pMapNode)) {
+
+						//  If the mapped path is an absolute path then it replaces any path that has been accumulated so far
+						if (isAbsolute(SPool.getString(pMapNode->getMappedName()))) BfrUsed = 0;
+
+						//  Check that there is sufficient space in the output buffer for the mapped path plus a delimiter
+						MappedLen = SPool.getLength(pMapNode->getMappedName());
+						if ((BfrLen - BfrUsed) <= MappedLen) {
+							szQFile[0] = '\0';
+							return nullptr;
+						}
+
+						//  If there is already a partial path then append a delimiter
+						if (BfrUsed > 0) szQFile[BfrUsed++] = '/';
 
-							//  Check that the provisional directory exists and is a directory
-							if (isDirectory(szRootDir)) {
-								free(pEnvVar);
-								return SPool.addString(szRootDir);
-							}
+						//  Append the mapped path
+						strcpy_s(szQFile + BfrUsed, BfrLen - BfrUsed, SPool.getString(pMapNode->getMappedName()));
+						BfrUsed += MappedLen;
 
-							//  Clear the provisional directory name
-							szRootDir[0] = '\0';
+						//  Point to the next segment
+						pSeg += SegLen;
+						while (*pSeg == '/' || *pSeg == '\\') pSeg++;
+					}
+					else {
+
+						//  There is no mapping for current segment - the remainder of the virtual path is appended
+						MappedLen = strlen(pSeg);
+						if ((BfrLen - BfrUsed) <= MappedLen) {
+							szQFile[0] = '\0';
+							return nullptr;
 						}
+
+						//  If there is already a partial path then append a delimiter
+						if (BfrUsed > 0) szQFile[BfrUsed++] = '/';
+
+						//  Append the virtual path
+						strcpy_s(szQFile + BfrUsed, BfrLen - BfrUsed, pSeg);
+						BfrUsed += MappedLen;
+
+						pSeg += MappedLen;
 					}
 				}
-				free(pEnvVar);
+				pSeg = nullptr;
 			}
 
-			//
-			//  (3)		-		Use the parent directory of the directory from which the applicaton was invoked
-			//
-			//  This assumes that a standalone project is in use with executables located in <project root>/<exectables directory>
-			//
+			//  Return the pointer to the mapped buffer
+			return szQFile;
+		}
 
-			getExecutablePath(szXPath, MAX_PATH + 1);
-			pSrc = szXPath;
+		//  hashPath
+		//
+		//  Computes the (FNV-1a) hash of a virtual file name
+		//
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the virtual file name
+		//		size_t			-		Length of the virtual file name
+		//
+		//  RETURNS:
+		//
+		//		size_t			-		The hash of the name
+		//
+		//  NOTES:
+		//
+		//	1.		The case of the name is preserved, segments that are not mapped keep their case in the qualified name.
+		//
 
-			//  Copy the provisional root directory to the persistent member, the string is normalised in this process
-			while (*pSrc != '\0') {
-				if (*pSrc == '\\') *pTgt = '/';
-				else *pTgt = *pSrc;
-				if (*pTgt == '/') SepCount++;
-				pSrc++;
-				pTgt++;
-			}
+		static size_t	hashPath(const char* szVFile, size_t VLen) {
+			uint32_t	Hash = 2166136261U;																//  Hash value
 
-			//  We need at least 3 separators in the program file path
-			if (SepCount >= 3) {
-				//  Back the target up to the previous directory separator
-				while (*pTgt != '/') pTgt--;
-				pTgt--;
-				//  Back the target up to the previous directory separator
-				while (*pTgt != '/') pTgt--;
-				*pTgt = '\0';
+			for (size_t CX = 0; CX < VLen; CX++) {
+				Hash ^= uint32_t(BYTE(szVFile[CX]));
+				Hash *= 16777619U;
+			}
 
-				//  Check that the provisional directory exists and is a directory
-				if (isDirectory(szRootDir)) return SPool.addString(szRootDir);
+			return size_t(Hash);
+		}
 
-				//  Clear the provisional directory name
-				szRootDir[0] = '\0';
-			}
+		//  findPath
+		//
+		//  Locates the resolved path cache entry for a virtual file name
+		//
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the virtual file name
+		//		size_t			-		Length of the virtual file name
+		//		size_t			-		Hash of the virtual file name
+		//
+		//  RETURNS:
+		//
+		//		PathEntry*		-		Pointer to the cache entry, nullptr if the name is not in the cache
+		//
+		//  NOTES:
+		//
+		//	1.		The caller MUST hold the cache lock.
+		//
 
-			//
-			//  (4)		-		No project root directory could be determined
-			//
+		PathEntry*	findPath(const char* szVFile, size_t VLen, size_t Hash) {
+			PathEntry*		pEntry = PathCache[Hash % PathBuckets];									//  Entry in the bucket
 
-			std::cerr << "ERROR: No project root directory is available, logging and other basic functions will not be available to the program." << std::endl;
+			while (pEntry != nullptr) {
+				if (pEntry->Hash == Hash && pEntry->VLen == VLen && memcmp(pEntry->szVName, szVFile, VLen) == 0) return pEntry;
+				pEntry = pEntry->pNext;
+			}
 
-			//  Return to caller
-			return NULLSTRREF;
+			return nullptr;
 		}
 
-		//  getExecutablePath
+		//  cachePath
 		//
-		//  This function will return the executable path of the current program.
-		//  If the path cannot be determined then a platform dependent default is returned.
+		//  Adds the resolution of a virtual file name to the resolved path cache
 		//
 		//  PARAMETERS:
 		//
-		//		char*			-		Pointer to the buffer to hold the returned file name
-		//		size_t			-		Size of the buffer
+		//		const char*		-		Const pointer to the virtual file name
+		//		size_t			-		Length of the virtual file name
+		//		size_t			-		Hash of the virtual file name
+		//		const char*		-		Const pointer to the qualified file name
+		//		size_t			-		Resource map generation that the name was resolved against
 		//
 		//  RETURNS:
 		//
 		//  NOTES:
-		//  
+		//
+		//	1.		If the resource map has changed since the name was resolved then the resolution is not held.
+		//	2.		When the cache is full it is emptied before the new resolution is added.
+		//
+
+		void	cachePath(const char* szVFile, size_t VLen, size_t Hash, const char* szQFile, size_t Generation) {
+			std::lock_guard<std::mutex>		CacheGuard(PathLock);										//  Cache lock
+			size_t							QLen = strlen(szQFile);										//  Length of the qualified name
+			PathEntry*						pEntry = nullptr;											//  New entry
+
+			//  Discard resolutions against a previous map or ones that have been added by another thread
+			if (Generation != PathGeneration) return;
+			if (findPath(szVFile, VLen, Hash) != nullptr) return;
+
+			//  Make room
+			if (PathEntries >= PathCacheLimit) purgePaths();
+
+			//  Build the entry with the names following it
+			pEntry = (PathEntry*)malloc(sizeof(PathEntry) + VLen + QLen + 2);
+			if (pEntry == nullptr) return;
+			memset(pEntry, 0, sizeof(PathEntry));
+			pEntry->Hash = Hash;
+			pEntry->VLen = VLen;
+			pEntry->QLen = QLen;
+			pEntry->szVName = (char*)(pEntry + 1);
+			pEntry->szQName = pEntry->szVName + VLen + 1;
+			pEntry->WD = -1;
+			memcpy(pEntry->szVName, szVFile, VLen);
+			pEntry->szVName[VLen] = '\0';
+			memcpy(pEntry->szQName, szQFile, QLen + 1);
+
+			//  Chain the entry into the bucket
+			pEntry->pNext = PathCache[Hash % PathBuckets];
+			PathCache[Hash % PathBuckets] = pEntry;
+			PathEntries++;
+			return;
+		}
 
+		//  purgePaths
 		//
-		//  PLATFORM DEPENDENT VERSIONS
+		//  Frees all of the entries in the resolved path cache
 		//
-
-#if  (defined(_WIN32) || defined(_WIN64))
+		//  PARAMETERS:
 		//
-		//  WINDOWS PLATFORM VERSIONS
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.		The caller MUST hold the cache lock.
 		//
-		void getExecutablePath(char* szXPath, size_t BfrSize) {
-			int			Size = 0;																	//  Returned size
 
-			//  Get the executable path
-			Size = GetModuleFileName(NULL, szXPath, DWORD(BfrSize));
+		void	purgePaths() {
+			PathEntry*		pEntry = nullptr;														//  Entry being freed
 
-			//  If we failed to get one then pass back a dummy file name that will cause a default project root to be used
-			if (Size == 0) strcpy_s(szXPath, BfrSize, "c:\\xybase\\Bin\\application.exe");
+			for (size_t BX = 0; BX < PathBuckets; BX++) {
+				while (PathCache[BX] != nullptr) {
+					pEntry = PathCache[BX];
+					PathCache[BX] = pEntry->pNext;
+					free(pEntry);
+				}
+			}
+			PathEntries = 0;
+			return;
+		}
 
-			//  Return to caller
+		//  invalidateWatch
+		//
+		//  Invalidates the cached stat information for resources in a watched directory
+		//
+		//  PARAMETERS:
+		//
+		//		int				-		Watch descriptor of the directory, -1 for all resources
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.		The caller MUST hold the cache lock.
+		//
+
+		void	invalidateWatch(int WD) {
+			PathEntry*		pEntry = nullptr;														//  Entry being inspected
+
+			for (size_t BX = 0; BX < PathBuckets; BX++) {
+				for (pEntry = PathCache[BX]; pEntry != nullptr; pEntry = pEntry->pNext) {
+					if (WD < 0 || pEntry->WD == WD) pEntry->StatValid = false;
+				}
+			}
 			return;
 		}
 
-#else
+		//  drainWatches
 		//
-		//  UNIX/LINUX PLATFORM VERSIONS
+		//  Reads any pending change notifications and invalidates the stat information that they affect
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.		The caller MUST hold the cache lock.
+		//	2.		Each notification advances the notification sequence.
 		//
-		void getExecutablePath(char* szXPath, size_t BfrSize) {
-			int			Size = 0;																	//  Returned size
-			char		szLink[64];																	//  Program file name symbolic link
 
-			//  Build the symbolic link
-			sprintf_s(szLink, 64, "/proc/%d/exe", getpid());
+		void	drainWatches() {
+#if defined(__linux__)
+			alignas(struct inotify_event) char		EvBuf[4096];										//  Notification buffer
+			ssize_t									EvLen = 0;											//  Length of notifications read
+			const struct inotify_event*				pEvent = nullptr;									//  Notification
 
-			//  Read the link
-			Size = readlink(szLink, szXPath, BfrSize);
+			if (WatchFD < 0) return;
 
-			//  If we failed to get one then pass back a dummy file name that will cause a default project root to be used
-			if (Size == 0) strcpy_s(szXPath, BfrSize, "/var/xybase/Bin/application");
+			while ((EvLen = read(WatchFD, EvBuf, sizeof(EvBuf))) > 0) {
+				for (ssize_t EX = 0; EX < EvLen; EX += ssize_t(sizeof(struct inotify_event) + pEvent->len)) {
+					pEvent = (const struct inotify_event*)(EvBuf + EX);
 
-			//  Return to caller
+					//  A queue overflow loses notifications, everything is invalidated
+					if (pEvent->mask & IN_Q_OVERFLOW) invalidateWatch(-1);
+					else invalidateWatch(pEvent->wd);
+					WatchSeq++;
+				}
+			}
+#endif
 			return;
 		}
 
-#endif
-
-		//  setupDefaultMap
+		//  watchDirectory
 		//
-		//  This function will setup the default resource map nodes.
+		//  Adds a change notification watch for the directory that holds a file
 		//
-		//	DEFAULT MAP
-		//	-----------
-		//  
-		//	1.		Config		--->		<root>/Config
-		//  2.		Logs		--->		<root>/Logs
+		//  PARAMETERS:
+		//
+		//		const char*		-		Const pointer to the qualified file name
+		//
+		//  RETURNS:
+		//
+		//		int				-		Watch descriptor, -1 if the directory is not watched
+		//
+		//  NOTES:
+		//
+		//	1.		The caller MUST hold the cache lock.
+		//	2.		Watching a directory that is already watched returns the existing watch descriptor.
+		//
+
+		int		watchDirectory(const char* szQFile) {
+#if defined(__linux__)
+			char			szDir[MAX_PATH + 1] = {};												//  Directory name
+			const char*		pLast = strrchr(szQFile, '/');											//  Last delimiter
+
+			if (WatchFD < 0) return -1;
+
+			//  Isolate the directory name
+			if (pLast == nullptr) strcpy_s(szDir, MAX_PATH + 1, ".");
+			else if (pLast == szQFile) strcpy_s(szDir, MAX_PATH + 1, "/");
+			else {
+				if (size_t(pLast - szQFile) > MAX_PATH) return -1;
+				memcpy(szDir, szQFile, pLast - szQFile);
+				szDir[pLast - szQFile] = '\0';
+			}
+
+			return inotify_add_watch(WatchFD, szDir, IN_CREATE | IN_DELETE | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+#else
+			szQFile = szQFile;
+			return -1;
+#endif
+		}
+
+		//  statResource
 		//
+		//  Obtains the stat information for a resource, using the resolved path cache where possible
 		//
 		//  PARAMETERS:
 		//
+		//		const char*		-		Const pointer to the virtual file name of the resource
+		//		struct stat&	-		Reference to the structure to hold the stat information
+		//
 		//  RETURNS:
 		//
+		//		bool			-		true if the resource exists, otherwise false
+		//
 		//  NOTES:
-		//  
+		//
+		//	1.		Stat information is only held while the directory containing the resource is watched for changes,
+		//			the watch is placed before the stat so that any later change invalidates the cached information.
+		//	2.		The stat information is left untouched if the resource does not exist.
+		//
+
+		bool	statResource(const char* szVRN, struct stat& FileInfo) {
+			struct stat		NewInfo = {};															//  Current stat information
+			char			szFileName[MAX_PATH + 1] = {};											//  Mapped file name
+			size_t			VLen = strlen(szVRN);													//  Length of the virtual name
+			size_t			Hash = hashPath(szVRN, VLen);											//  Hash of the virtual name
+			size_t			Seq = 0;																//  Notification sequence before the stat
+			PathEntry*		pEntry = nullptr;														//  Cached resolution
+			int				WD = -1;																//  Directory watch descriptor
+			bool			Exists = false;															//  Resource exists
+
+			//  Use the cached stat information if it is still current
+			{
+				std::lock_guard<std::mutex>		CacheGuard(PathLock);									//  Cache lock
+
+				drainWatches();
+				pEntry = findPath(szVRN, VLen, Hash);
+				if (pEntry != nullptr && pEntry->StatValid) {
+					if (pEntry->Exists) FileInfo = pEntry->Info;
+					return pEntry->Exists;
+				}
+			}
 
-		void	setupDefaultMap() {
-			STRREF			CFGString = NULLSTRREF;														//  Config string
-			STRREF			LogString = NULLSTRREF;														//  Logs string
-			QHierarchy<RNode>::Node* pRNode = nullptr;												//  Resource Node
+			//  Map the file to the real file space
+			mapFile(szVRN, szFileName, MAX_PATH + 1);
+			if (szFileName[0] == '\0') return false;
 
-			//  Add the default map node strings to the String Pool
-			CFGString = SPool.addString("Config");
-			LogString = SPool.addString("Logs");
+			//  Watch the containing directory
+			{
+				std::lock_guard<std::mutex>		CacheGuard(PathLock);									//  Cache lock
 
-			//  Add the child nodes to the resource map
-			pRNode = RMap.getRoot()->addChild();
-			pRNode->setName(CFGString);
-			pRNode->setMappedName(CFGString);
-			createTarget(pRNode);
+				if (!isAbsolute(szVRN)) WD = watchDirectory(szFileName);
+				drainWatches();
+				Seq = WatchSeq;
+			}
 
-			pRNode = RMap.getRoot()->addChild();
-			pRNode->setName(LogString);
-			pRNode->setMappedName(LogString);
-			createTarget(pRNode);
+			//  Stat the file
+			Exists = (stat(szFileName, &NewInfo) == 0);
+			if (Exists) FileInfo = NewInfo;
+			if (WD < 0) return Exists;
+
+			//  Hold the stat information unless something changed while the stat was in progress
+			{
+				std::lock_guard<std::mutex>		CacheGuard(PathLock);									//  Cache lock
+
+				drainWatches();
+				if (Seq != WatchSeq) return Exists;
+				pEntry = findPath(szVRN, VLen, Hash);
+				if (pEntry == nullptr || strcmp(pEntry->szQName, szFileName) != 0) return Exists;
+				pEntry->WD = WD;
+				pEntry->Exists = Exists;
+				pEntry->Info = NewInfo;
+				pEntry->StatValid = true;
+			}
 
-			//  Return to caller
-			return;
+			return Exists;
 		}
 
 		//  getSegmentLen
@@ -2080,55 +3556,45 @@ namespace xymorg {
 
 		//  loadMIMEMap
 		//
-		//  This function will load a MIME mapping file (unix/linux: /etc/mime.types), windows: empty file.
-		//  The loaded map is extended with some well-known exceptions that are needed 
+		//  This function will map the system MIME mapping file (unix/linux: /etc/mime.types), windows: none.
+		//  A separate map is built holding some well-known exceptions that are needed 
 		//
 		//  PARAMETERS:
 		//
 		//  RETURNS:
 		//
-		//		char*			-		Pointer to the map
+		//		char*			-		Pointer to the map of additions
 		//
 		//  NOTES:
+		//
+		//	1.		The system map is held as a read-only view in MTView, it is searched before the additions.
 		//  
 
 		char* loadMIMEMap() {
 			char*		pNewMap = nullptr;														//  Pointer to the new map
-			size_t		Slop = 8192;															//  Slop additional size to extend the loaded map
-			size_t		MapSize = 0;															//  Size of the map
+			size_t		Slop = 8192;															//  Size of the map of additions
 
 #if (defined(_WIN32) || defined(_WIN64))
-			//  WINDOWS PLATFORM - Empty Map with slop
+			//  WINDOWS PLATFORM - No system map
+#else
+			//  UNIX/Linux PLATFORM - map /etc/mime.types
+			MTView = mapResource("/etc/mime.types", MappedResource::AdviseWillNeed);
+#endif
+			//  Empty map of additions
 			pNewMap = (char*)malloc(Slop);
 			if (pNewMap == nullptr) return nullptr;
 			memset(pNewMap, 0, Slop);
-			MapSize = Slop;
-#else
-			//  UNIX/Linux PLATFORM - load /etc/mime.types and extend with slop
-			pNewMap = (char*)loadResource("/etc/mime.types", MapSize);
-			if (MapSize == 0 || pNewMap == nullptr) {
-				pNewMap = (char*)malloc(Slop);
-				if (pNewMap == nullptr) return nullptr;
-				memset(pNewMap, 0, Slop);
-			}
-			else {
-				char* pXBfr = (char*)realloc(pNewMap, MapSize + Slop);
-				if (pXBfr == nullptr) return pNewMap;
-				pNewMap = pXBfr;
-				memset(pNewMap + MapSize, 0, Slop);
-				MapSize += Slop;
-			}
-#endif
+
 			//
 			//  Append any well-known additions to the list
 			//
 
 			//  All platforms
-			strcat_s(pNewMap, MapSize, "application/notes\t\tnsf\n");
+			strcat_s(pNewMap, Slop, "application/notes\t\tnsf\n");
 
 #if (defined(_WIN32) || defined(_WIN64))
 			//  Windows
-			strcat_s(pNewMap, MapSize, "application/javascript\t\tjs\n");
+			strcat_s(pNewMap, Slop, "application/javascript\t\tjs\n");
 #else
 			//  UNIX/Linux
 #endif
@@ -2146,17 +3612,43 @@ namespace xymorg {
 		//
 		//  RETURNS:
 		//
-		//		char*			-		Pointer to the map entry, nullptr if not found
+		//		char*			-		Const pointer to the map entry, nullptr if not found
+		//
+		//  NOTES:
+		//
+		//	1.		The system map is searched before the additions
+		//  
+
+		const char* findMIMEEntry(const char* pFX) {
+			const char*		pEntry = nullptr;														//  Map entry
+
+			if (MTView.isLoaded()) pEntry = findMIMEEntry(pFX, MTView.getText());
+			if (pEntry == nullptr) pEntry = findMIMEEntry(pFX, MTMap);
+			return pEntry;
+		}
+
+		//  findMIMEEntry
+		//
+		//  This function will locate the entry in a MIME mapping for the given file extension
+		//
+		//  PARAMETERS:
+		//
+		//		char*			-		Pointer to the file extension
+		//		char*			-		Const pointer to the (null terminated) map
+		//
+		//  RETURNS:
+		//
+		//		char*			-		Const pointer to the map entry, nullptr if not found
 		//
 		//  NOTES:
 		//  
 
-		char* findMIMEEntry(const char* pFX) {
-			char* pScan = MTMap;																	//  Scanning pointer
+		const char* findMIMEEntry(const char* pFX, const char* pMap) {
+			const char* pScan = pMap;																//  Scanning pointer
 
 			//  Safety
-			if (pFX == nullptr || MTMap == nullptr) return nullptr;
-			if (pFX[0] == '\0' || MTMap[0] == '\0') return nullptr;
+			if (pFX == nullptr || pMap == nullptr) return nullptr;
+			if (pFX[0] == '\0' || pMap[0] == '\0') return nullptr;
 
 			//  Loop searching for possible instances of the file extension
 			while (pScan != nullptr) {
@@ -2167,10 +3659,10 @@ namespace xymorg {
 						pScan += (strlen(pFX) + 1);
 						if (*pScan == '\n' || *pScan == '\r' || *pScan == ' ' || *pScan == '\t' || *pScan == '#' || *pScan == '\0') {
 							//  Locate the start of this entry line
-							char* pLastLoc = pScan;
+							const char* pLastLoc = pScan;
 							pScan--;
-							while (pScan > MTMap && *pScan != '\n' && *pScan != '\r') pScan--;
-							if (pScan > MTMap) pScan++;
+							while (pScan > pMap && *pScan != '\n' && *pScan != '\r') pScan--;
+							if (pScan > pMap) pScan++;
 							if (*pScan == '#') pScan = pLastLoc;
 							else return pScan;
 						}
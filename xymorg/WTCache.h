@@ -17,6 +17,10 @@
 //*																													*
 //*	NOTES:																											*
 //*																													*
+//*	1.		With the WRITE_BEHIND option dirty records that leave the cache are written by a background thread,	*
+//*			readers and evictions never wait on the backing store. Override syncCachedRecords() to commit the		*
+//*			store once per batch of writes and use setWriteBehindLimit() to bound the queued (dirty) bytes.		*
+//*																													*
 //*******************************************************************************************************************
 //*																													*
 //*   History:																										*
@@ -109,6 +113,29 @@ namespace xymorg {
 			//  Return to caller
 			return;
 		}
+
+		//  Constructor 
+		//
+		//  Constructs a new sharded Write Through Cache (base) with the given attributes
+		//
+		//  PARAMETERS:
+		//
+		//		SWITCHES			-		Cache configuration options
+		//		size_t				-		Budget size (Kb)
+		//		size_t				-		Number of shards
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//	1.	Extending classes MUST invoke one of these constructors
+		//
+
+		WTCache(SWITCHES NewCfg, size_t NewBudget, size_t NewShards) : Cache(NewCfg, NewBudget, NewShards) {
+
+			//  Return to caller
+			return;
+		}
 #endif
 
 		//*******************************************************************************************************************
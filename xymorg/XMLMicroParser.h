@@ -3,20 +3,27 @@
 //*																													*
 //*   File:       XMLMicroParser.h																					*
 //*   Suite:      xymorg Integration																				*
-//*   Version:    1.1.0	(Build: 02)																					*
+//*   Version:    1.2.1	(Build: 06)																					*
 //*   Author:     Ian Tree/HMNL																						*
 //*																													*
-//*   Copyright 2017 - 2025 Ian J. Tree.														*
+//*   Copyright 2017 - 2026 Ian J. Tree.																			*
 //*******************************************************************************************************************
 //*																													*
 //*	This header file contains the definition for the XMLMicroParser class. The XMLMicroParser class provides the	*
-//* minimal non-validating XML parser needed for parsing simple, well-formed XML documents. 						*
+//* minimal non-validating XML parser needed for parsing simple, well-formed XML documents.							*
 //*																													*
 //*	USAGE:																											*
 //*																													*
 //*	NOTES:																											*
 //*																													*
-//*	1.																												*
+//*	1.		A document may be indexed when it is loaded. The index records every tag with its matching tag, parent,	*
+//*			depth and attribute spans in a single pass. Iterators obtained from an indexed parser use the index for	*
+//*			scope lookups, iteration and attribute access instead of scanning the document text.					*
+//*	2.		Indexed lookups follow the scanning rules, a scope lookup passes over <name/> and an element ends at	*
+//*			the first </name> that follows it (so nested elements with the same name end at the inner close).		*
+//*			Tags inside comments, CDATA sections and other <! or <? constructs are not in the index.				*
+//*	3.		The index is built from a vectorised (SSE2/AVX2) classification of the document, 32 bytes at a time,	*
+//*			into masks of the structural ('<' and '>') characters, the tags are then built from those positions.	*
 //*																													*
 //*******************************************************************************************************************
 //*																													*
@@ -25,6 +32,9 @@
 //*	1.0.0 -		03/12/2017	-	Initial Release																		*
 //* 1.1.0 -		12/02/2025	-	Added getAttributeDateTime()														*
 //*							-	Added marshallAttributes()															*
+//* 1.2.0 -		19/10/2026	-	Added optional document index (XMLIndex)											*
+//*							-	SIMD structural scanner for building the index										*
+//* 1.2.1 -		19/10/2026	-	Indexed scopes and element ends follow the scanning rules							*
 //*																													*
 //*******************************************************************************************************************/
 
@@ -37,35 +47,995 @@
 #include	"StringThing.h"																		//  String manipulations
 #include	"MISC/PairColl.h"																	//  Pairs Collection
 
+//  SIMD support for the structural scanner
+#if defined(__AVX2__)
+#include	<immintrin.h>																		//  AVX2 intrinsics
+#define		XY_XML_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include	<emmintrin.h>																		//  SSE2 intrinsics
+#define		XY_XML_SSE2
+#endif
+
 namespace xymorg {
 
-	//
-	//   GLOBAL DEFINITIONS
-	//
+	//
+	//   GLOBAL DEFINITIONS
+	//
+
+#define			XMP_MAX_NODE_NAME			250													//  Maximum size of an XML Node Name
+#define			XMP_MAX_NODE_PATH			1024												//  Maximum size of a node XPATH
+
+//
+//  XMLMicroParser Class Definition
+//
+	class XMLMicroParser {
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Conxstants		                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		static const int	cMaxNodeName = 250;												//  Max size for an individual node name
+		static const int	cMaxNodePath = 1024;											//  Max size for a node XPATH
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Nested Classes	                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   XMLIndex Class		                                                                                        *
+		//*																													*
+		//*	  The XMLIndex class holds a structural index of an XML document built in a single pass over the document.		*
+		//*	  Each tag (opening, closing or self-closing) is recorded in document order with the offsets of the tag, the	*
+		//*	  matching tag, the parent, the depth and the spans of the attributes.											*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class XMLIndex {
+		public:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Constants		                                                                                        *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			static const BYTE		OpenTag = 0;														//  Opening tag <name ...>
+			static const BYTE		CloseTag = 1;														//  Closing tag </name>
+			static const BYTE		EmptyTag = 2;														//  Self-closing tag <name ... />
+			static const size_t		NoTag = SIZE_MAX;													//  Not a tag
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Types			                                                                                        *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Tag
+			typedef struct Tag {
+				size_t			Pos;																	//  Offset of the '<'
+				size_t			Match;																	//  Index of the matching tag (self for empty tags)
+				size_t			End;																	//  Index of the tag that ends the element when scanning
+				size_t			Parent;																	//  Index of the enclosing opening tag
+				size_t			FirstAttr;																//  Index of the first attribute
+				uint32_t		Len;																	//  Offset of the '>' from the '<'
+				uint32_t		Depth;																	//  Nesting depth (root is 0)
+				uint16_t		NameLen;																//  Length of the tag name
+				uint16_t		NAttrs;																	//  Number of attributes
+				BYTE			Kind;																	//  Kind of tag
+			} Tag;
+
+			//  Attribute
+			typedef struct Attr {
+				uint32_t		Name;																	//  Offset of the attribute name in the tag
+				uint32_t		Value;																	//  Offset of the attribute value in the tag
+				uint32_t		NameLen;																//  Length of the name
+				uint32_t		ValueLen;																//  Length of the value
+			} Attr;
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Constructors			                                                                                        *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Default Constructor 
+			//
+			//  Constructs an empty (unbuilt) index
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//
+
+			XMLIndex() : pDoc(nullptr), pTags(nullptr), NTags(0), CapTags(0), pAttrs(nullptr), NAttrs(0), CapAttrs(0),
+				pNames(nullptr), NNames(0), CapNames(0), pNameBkt(nullptr), NBkt(0), pByName(nullptr) {}
+
+			//  Indexes are not copyable
+			XMLIndex(const XMLIndex& Src) = delete;
+			XMLIndex& operator = (const XMLIndex& rhs) = delete;
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Destructor			                                                                                        *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Destructor
+			//
+			//  Destroys the index releasing all storage
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//  
+
+			~XMLIndex() {
+				dismiss();
+				return;
+			}
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Public Functions                                                                                              *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  dismiss
+			//
+			//  Releases all storage and returns the index to the unbuilt state
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//  
+
+			void	dismiss() {
+				if (pTags != nullptr) free(pTags);
+				if (pAttrs != nullptr) free(pAttrs);
+				if (pNames != nullptr) free(pNames);
+				if (pNameBkt != nullptr) free(pNameBkt);
+				if (pByName != nullptr) free(pByName);
+				pDoc = nullptr;
+				pTags = nullptr;
+				NTags = 0;
+				CapTags = 0;
+				pAttrs = nullptr;
+				NAttrs = 0;
+				CapAttrs = 0;
+				pNames = nullptr;
+				NNames = 0;
+				CapNames = 0;
+				pNameBkt = nullptr;
+				NBkt = 0;
+				pByName = nullptr;
+				return;
+			}
+
+			//  isBuilt
+			//
+			//  Returns an indication if the index has been built
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the index is available, otherwise false
+			//
+			//  NOTES:
+			//  
+
+			bool	isBuilt() const { return pDoc != nullptr; }
+
+			//  build
+			//
+			//  Builds the index from a single pass over the document
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the XML document (null terminated)
+			//		char*				-		Const pointer to the root node of the document
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the index was built, false if the document is not well-formed
+			//
+			//  NOTES:
+			//
+			//		1.	Comments, processing instructions, declarations and CDATA sections are not indexed
+			//		2.	If the index cannot be built it is left unbuilt and the document is handled by scanning
+			//  
+
+			bool	build(const char* pXMLDoc, const char* pStart) {
+				const char*		pScan = pStart;															//  Scanning pointer
+				const char*		pEnd = nullptr;															//  End of the current tag
+				size_t*			pStack = nullptr;														//  Stack of open tags
+				size_t			StackDepth = 0;															//  Depth of the stack
+				size_t			StackCap = 0;															//  Capacity of the stack
+				StructScan		SS = {};																//  Structural scanner
+				bool			Valid = true;															//  Document is well-formed
+
+				dismiss();
+				if (pXMLDoc == nullptr || pStart == nullptr) return false;
+				pDoc = pXMLDoc;
+				SS.pStart = pStart;
+				SS.ScanLen = strlen(pStart);
+
+				while (Valid && nextStructural(SS, pScan)) {
+
+					//  Locate the next tag opener
+					if (*pScan != '<') continue;
+
+					//  Skip comments, CDATA, processing instructions and declarations
+					if (pScan[1] == '!' || pScan[1] == '?') {
+						if (strncmp(pScan, "<!--", 4) == 0) Valid = skipTo(SS, pScan + 6, "--");
+						else if (strncmp(pScan, "<![CDATA[", 9) == 0) Valid = skipTo(SS, pScan + 11, "]]");
+						else if (pScan[1] == '?') Valid = skipTo(SS, pScan + 3, "?");
+						else Valid = skipTo(SS, pScan + 1, "");
+						continue;
+					}
+
+					//  Locate the end of the tag
+					pEnd = pScan;
+					while (*pEnd != '>') {
+						if (!nextStructural(SS, pEnd)) break;
+					}
+					if (*pEnd != '>' || size_t(pEnd - pScan) > UINT32_MAX || !expandTags()) {
+						Valid = false;
+						continue;
+					}
+
+					Tag&		NewTag = pTags[NTags];
+					memset(&NewTag, 0, sizeof(Tag));
+					NewTag.Pos = pScan - pDoc;
+					NewTag.Len = uint32_t(pEnd - pScan);
+					NewTag.FirstAttr = NAttrs;
+
+					if (pScan[1] == '/') {
+						//  Closing tag - must match the innermost open tag
+						const char*		pName = pScan + 2;
+						while (*pName > ' ' && *pName != '>') pName++;
+						NewTag.NameLen = uint16_t(pName - (pScan + 2));
+						NewTag.Kind = CloseTag;
+						if (StackDepth == 0 || size_t(pName - (pScan + 2)) > UINT16_MAX) {
+							Valid = false;
+							continue;
+						}
+						size_t		OpenX = pStack[--StackDepth];
+						if (pTags[OpenX].NameLen != NewTag.NameLen || memcmp(pDoc + pTags[OpenX].Pos + 1, pScan + 2, NewTag.NameLen) != 0) {
+							Valid = false;
+							continue;
+						}
+						NewTag.Match = OpenX;
+						NewTag.Parent = pTags[OpenX].Parent;
+						NewTag.Depth = pTags[OpenX].Depth;
+						pTags[OpenX].Match = NTags;
+					}
+					else {
+						//  Opening or self-closing tag
+						const char*		pName = pScan + 1;
+						while (*pName > ' ' && *pName != '>' && *pName != '/') pName++;
+						NewTag.NameLen = uint16_t(pName - (pScan + 1));
+						if (NewTag.NameLen == 0 || size_t(pName - (pScan + 1)) > UINT16_MAX) {
+							Valid = false;
+							continue;
+						}
+						NewTag.Kind = (*(pEnd - 1) == '/') ? EmptyTag : OpenTag;
+						NewTag.Parent = (StackDepth > 0) ? pStack[StackDepth - 1] : NoTag;
+						NewTag.Depth = uint32_t(StackDepth);
+						if (internName(pScan + 1, NewTag.NameLen) == NoTag || !indexAttributes(NewTag, pName, (NewTag.Kind == EmptyTag) ? pEnd - 1 : pEnd)) {
+							Valid = false;
+							continue;
+						}
+						if (NewTag.Kind == EmptyTag) NewTag.Match = NTags;
+						else {
+							if (StackDepth == StackCap) {
+								size_t		NewCap = (StackCap == 0) ? 64 : StackCap * 2;
+								size_t*		pNewStack = (size_t*) realloc(pStack, NewCap * sizeof(size_t));
+								if (pNewStack == nullptr) {
+									Valid = false;
+									continue;
+								}
+								pStack = pNewStack;
+								StackCap = NewCap;
+							}
+							pStack[StackDepth++] = NTags;
+						}
+					}
+
+					NTags++;
+				}
+
+				//  Every opened tag must have been closed
+				if (StackDepth > 0 || NTags == 0) Valid = false;
+				if (pStack != nullptr) free(pStack);
+
+				//  Build the occurrence lists for the tag names and the scanning ends of the elements
+				if (Valid) Valid = buildNameLists();
+				if (Valid) Valid = bindEnds();
+
+				if (!Valid) dismiss();
+				return Valid;
+			}
+
+			//  getDoc
+			//
+			//  Returns the indexed document, all offsets in the index are relative to the start of the document
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the document
+			//
+			//  NOTES:
+			//  
+
+			const char*		getDoc() const { return pDoc; }
+
+			//  getTagCount
+			//
+			//  Returns the number of tags in the index
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Number of tags
+			//
+			//  NOTES:
+			//  
+
+			size_t		getTagCount() const { return NTags; }
+
+			//  getTag
+			//
+			//  Returns the description of a tag
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the tag
+			//
+			//  RETURNS:
+			//
+			//		Tag&				-		Const reference to the tag
+			//
+			//  NOTES:
+			//  
+
+			const Tag&		getTag(size_t TX) const { return pTags[TX]; }
+
+			//  getNode
+			//
+			//  Returns a pointer to a tag in the document
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the tag
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the '<' of the tag, NULL for NoTag
+			//
+			//  NOTES:
+			//  
+
+			const char*		getNode(size_t TX) const {
+				if (TX >= NTags) return nullptr;
+				return pDoc + pTags[TX].Pos;
+			}
+
+			//  getAttr
+			//
+			//  Returns the description of an attribute
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the attribute
+			//
+			//  RETURNS:
+			//
+			//		Attr&				-		Const reference to the attribute
+			//
+			//  NOTES:
+			//  
+
+			const Attr&		getAttr(size_t AX) const { return pAttrs[AX]; }
+
+			//  locate
+			//
+			//  Returns the index of the first tag that starts at or after the passed position in the document
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer into the document
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Index of the tag, NoTag if there is none
+			//
+			//  NOTES:
+			//  
+
+			size_t		locate(const char* pNode) const {
+				size_t		Lo = 0, Hi = NTags;													//  Search bounds
+				size_t		Off = 0;															//  Offset of the position
+
+				if (pNode == nullptr || pNode < pDoc) return NoTag;
+				Off = pNode - pDoc;
+				while (Lo < Hi) {
+					size_t		Mid = Lo + (Hi - Lo) / 2;
+					if (pTags[Mid].Pos < Off) Lo = Mid + 1;
+					else Hi = Mid;
+				}
+				if (Lo == NTags) return NoTag;
+				return Lo;
+			}
+
+			//  findTag
+			//
+			//  Returns the index of the first opening or self-closing tag with the passed name in a range of tags that
+			//  would be selected by a scan of the document
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the tag name
+			//		size_t				-		Index of the first tag in the range
+			//		size_t				-		Index of the tag that ends the range (not included)
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Index of the tag, NoTag if not found
+			//
+			//  NOTES:
+			//
+			//		1.	As when scanning, only a tag where the name is followed by a space or '>' is selected, <name/> and
+			//			a name followed by any other white space are passed over
+			//  
+
+			size_t		findTag(const char* szTag, size_t FromX, size_t ToX) const {
+				size_t		NameLen = 0;														//  Length of the name
+				size_t		NX = 0;																//  Name index
+				size_t		Lo = 0, Hi = 0;														//  Search bounds
+
+				if (szTag == nullptr || NBkt == 0) return NoTag;
+				NameLen = strlen(szTag);
+				NX = lookupName(szTag, NameLen, hashName(szTag, NameLen));
+				if (NX == NoTag) return NoTag;
+
+				//  Binary search the occurrences for the first at or after the start of the range
+				Lo = pNames[NX].First;
+				Hi = Lo + pNames[NX].Count;
+				while (Lo < Hi) {
+					size_t		Mid = Lo + (Hi - Lo) / 2;
+					if (pByName[Mid] < FromX) Lo = Mid + 1;
+					else Hi = Mid;
+				}
+				Hi = pNames[NX].First + pNames[NX].Count;
+				while (Lo < Hi && pByName[Lo] < ToX) {
+					const char*		pAfter = pDoc + pTags[pByName[Lo]].Pos + 1 + NameLen;
+					if (*pAfter == ' ' || *pAfter == '>') return pByName[Lo];
+					Lo++;
+				}
+				return NoTag;
+			}
+
+			//  getAttribute
+			//
+			//  Returns a pointer to the value of the named attribute of a tag
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the tag
+			//		char*				-		Const pointer to the attribute name
+			//		size_t&				-		Reference to the variable to hold the length of the attribute value
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the attribute value, NULL if not present
+			//
+			//  NOTES:
+			//  
+
+			const char*		getAttribute(size_t TX, const char* szAttrName, size_t& AttrLen) const {
+				size_t		NameLen = 0;														//  Length of the name
+
+				AttrLen = 0;
+				if (TX >= NTags || szAttrName == nullptr) return nullptr;
+				NameLen = strlen(szAttrName);
+				if (NameLen == 0) return nullptr;
+
+				for (size_t AX = pTags[TX].FirstAttr; AX < pTags[TX].FirstAttr + pTags[TX].NAttrs; AX++) {
+					if (pAttrs[AX].NameLen == NameLen && memcmp(pDoc + pTags[TX].Pos + pAttrs[AX].Name, szAttrName, NameLen) == 0) {
+						AttrLen = pAttrs[AX].ValueLen;
+						return pDoc + pTags[TX].Pos + pAttrs[AX].Value;
+					}
+				}
+
+				return nullptr;
+			}
+
+		private:
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Types			                                                                                        *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  Structural Scanner
+			typedef struct StructScan {
+				const char*		pStart;																	//  Start of the scan
+				size_t			ScanLen;																//  Number of bytes to scan
+				size_t			BX;																		//  Offset of the next block
+				uint32_t		Mask;																	//  Unconsumed structural mask of the current block
+			} StructScan;
+
+			//  Tag Name
+			typedef struct Name {
+				size_t			TX;																		//  First tag with the name
+				uint32_t		Hash;																	//  Hash of the name
+				size_t			First;																	//  First occurrence in the by-name list
+				size_t			Count;																	//  Number of occurrences
+			} Name;
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Members			                                                                                    *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			const char*		pDoc;																		//  Indexed document
+			Tag*			pTags;																		//  Tags in document order
+			size_t			NTags;																		//  Number of tags
+			size_t			CapTags;																	//  Capacity of the tags array
+			Attr*			pAttrs;																		//  Attributes in document order
+			size_t			NAttrs;																		//  Number of attributes
+			size_t			CapAttrs;																	//  Capacity of the attributes array
+			Name*			pNames;																		//  Distinct tag names
+			size_t			NNames;																		//  Number of names
+			size_t			CapNames;																	//  Capacity of the names array
+			size_t*			pNameBkt;																	//  Name hash table (name index + 1)
+			size_t			NBkt;																		//  Number of name buckets
+			size_t*			pByName;																	//  Tag indexes grouped by name
+
+			//*******************************************************************************************************************
+			//*                                                                                                                 *
+			//*   Private Functions			                                                                                    *
+			//*                                                                                                                 *
+			//*******************************************************************************************************************
+
+			//  hashName
+			//
+			//  Computes the (FNV-1a) hash of a name
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the name
+			//		size_t				-		Length of the name
+			//
+			//  RETURNS:
+			//
+			//		uint32_t			-		Hash of the name
+			//
+			//  NOTES:
+			//  
+
+			static uint32_t		hashName(const char* pName, size_t NameLen) {
+				uint32_t	Hash = 2166136261U;													//  Hash value
+
+				for (size_t CX = 0; CX < NameLen; CX++) {
+					Hash ^= uint32_t(BYTE(pName[CX]));
+					Hash *= 16777619U;
+				}
+
+				return Hash;
+			}
+
+			//  lowestBit
+			//
+			//  Returns the index of the lowest set bit in a (non-zero) mask
+			//
+			//  PARAMETERS:
+			//
+			//		uint32_t			-		Mask
+			//
+			//  RETURNS:
+			//
+			//		unsigned int		-		Index of the lowest set bit
+			//
+			//  NOTES:
+			//  
+
+			static unsigned int		lowestBit(uint32_t Mask) {
+#if defined(_MSC_VER)
+				unsigned long		BX = 0;
+				_BitScanForward(&BX, Mask);
+				return (unsigned int) BX;
+#else
+				return (unsigned int) __builtin_ctz(Mask);
+#endif
+			}
+
+			//  classifyBlock
+			//
+			//  Classifies a block of up to 32 bytes of the document returning the mask of structural ('<' and '>') characters
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the block
+			//		size_t				-		Number of bytes in the block
+			//
+			//  RETURNS:
+			//
+			//		uint32_t			-		Mask with a bit set for each structural character
+			//
+			//  NOTES:
+			//
+			//		1.	A full block is classified with one AVX2 or two SSE2 compares, a partial block is classified by bytes
+			//  
+
+			static uint32_t		classifyBlock(const char* pBlock, size_t BlockLen) {
+				uint32_t	Mask = 0;															//  Structural mask
+
+				if (BlockLen >= 32) {
+#if defined(XY_XML_AVX2)
+					__m256i		Block = _mm256_loadu_si256((const __m256i*) pBlock);
+					return uint32_t(_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(Block, _mm256_set1_epi8('<')), _mm256_cmpeq_epi8(Block, _mm256_set1_epi8('>')))));
+#elif defined(XY_XML_SSE2)
+					__m128i		BlockLo = _mm_loadu_si128((const __m128i*) pBlock);
+					__m128i		BlockHi = _mm_loadu_si128((const __m128i*) (pBlock + 16));
+					__m128i		LT = _mm_set1_epi8('<');
+					__m128i		GT = _mm_set1_epi8('>');
+					Mask = uint32_t(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(BlockLo, LT), _mm_cmpeq_epi8(BlockLo, GT))));
+					Mask |= uint32_t(_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(BlockHi, LT), _mm_cmpeq_epi8(BlockHi, GT)))) << 16;
+					return Mask;
+#else
+					BlockLen = 32;
+#endif
+				}
+
+				for (size_t CX = 0; CX < BlockLen; CX++) {
+					if (pBlock[CX] == '<' || pBlock[CX] == '>') Mask |= uint32_t(1) << CX;
+				}
+				return Mask;
+			}
+
+			//  nextStructural
+			//
+			//  Returns the next structural ('<' or '>') character in the document
+			//
+			//  PARAMETERS:
+			//
+			//		StructScan&			-		Reference to the structural scanner
+			//		char*&				-		Reference to the pointer to receive the position of the structural character
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if a structural character was found, false at the end of the document
+			//
+			//  NOTES:
+			//
+			//		1.	The mask for the current block is consumed one bit at a time, the next block is classified when
+			//			the mask is exhausted
+			//  
+
+			static bool	nextStructural(StructScan& SS, const char*& pNext) {
+
+				while (SS.Mask == 0) {
+					if (SS.BX >= SS.ScanLen) return false;
+					SS.Mask = classifyBlock(SS.pStart + SS.BX, SS.ScanLen - SS.BX);
+					SS.BX += 32;
+				}
 
-#define			XMP_MAX_NODE_NAME			250													//  Maximum size of an XML Node Name
-#define			XMP_MAX_NODE_PATH			1024												//  Maximum size of a node XPATH
+				pNext = SS.pStart + (SS.BX - 32) + lowestBit(SS.Mask);
+				SS.Mask &= SS.Mask - 1;
+				return true;
+			}
 
-//
-//  XMLMicroParser Class Definition
-//
-	class XMLMicroParser {
-	public:
+			//  skipTo
+			//
+			//  Advances the structural scanner past the '>' that ends a construct
+			//
+			//  PARAMETERS:
+			//
+			//		StructScan&			-		Reference to the structural scanner
+			//		char*				-		Const pointer to the earliest position of the ending '>'
+			//		char*				-		Const pointer to the characters that must precede the ending '>'
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the end of the construct was found, otherwise false
+			//
+			//  NOTES:
+			//  
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Public Conxstants		                                                                                        *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
+			static bool	skipTo(StructScan& SS, const char* pFrom, const char* szPrefix) {
+				const char*		pNext = nullptr;												//  Next structural character
+				size_t			PLen = strlen(szPrefix);										//  Length of the prefix
 
-		static const int	cMaxNodeName = 250;												//  Max size for an individual node name
-		static const int	cMaxNodePath = 1024;											//  Max size for a node XPATH
+				while (nextStructural(SS, pNext)) {
+					if (pNext < pFrom || *pNext != '>') continue;
+					if (PLen == 0 || memcmp(pNext - PLen, szPrefix, PLen) == 0) return true;
+				}
 
-		//*******************************************************************************************************************
-		//*                                                                                                                 *
-		//*   Public Nested Classes	                                                                                        *
-		//*                                                                                                                 *
-		//*******************************************************************************************************************
+				return false;
+			}
+
+			//  lookupName
+			//
+			//  Locates a name in the name hash table
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the name
+			//		size_t				-		Length of the name
+			//		uint32_t			-		Hash of the name
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Index of the name, NoTag if not present
+			//
+			//  NOTES:
+			//  
+
+			size_t		lookupName(const char* pName, size_t NameLen, uint32_t Hash) const {
+				size_t		BX = Hash & (NBkt - 1);												//  Bucket index
+
+				while (pNameBkt[BX] != 0) {
+					const Name&		Cand = pNames[pNameBkt[BX] - 1];
+					if (Cand.Hash == Hash && pTags[Cand.TX].NameLen == NameLen && memcmp(pDoc + pTags[Cand.TX].Pos + 1, pName, NameLen) == 0) return pNameBkt[BX] - 1;
+					BX = (BX + 1) & (NBkt - 1);
+				}
+
+				return NoTag;
+			}
+
+			//  internName
+			//
+			//  Returns the index of a tag name, adding it to the names if it is new
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the name
+			//		size_t				-		Length of the name
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Index of the name, NoTag if storage is exhausted
+			//
+			//  NOTES:
+			//
+			//		1.	The name table is kept at most half full
+			//  
+
+			size_t		internName(const char* pName, size_t NameLen) {
+				uint32_t	Hash = hashName(pName, NameLen);										//  Hash of the name
+				size_t		NX = NoTag;															//  Name index
+
+				//  Grow the hash table
+				if ((NNames + 1) * 2 > NBkt) {
+					size_t		NewBkt = (NBkt == 0) ? 64 : NBkt * 2;
+					size_t*		pNewBkt = (size_t*) malloc(NewBkt * sizeof(size_t));
+					if (pNewBkt == nullptr) return NoTag;
+					memset(pNewBkt, 0, NewBkt * sizeof(size_t));
+					for (size_t X = 0; X < NNames; X++) {
+						size_t		BX = pNames[X].Hash & (NewBkt - 1);
+						while (pNewBkt[BX] != 0) BX = (BX + 1) & (NewBkt - 1);
+						pNewBkt[BX] = X + 1;
+					}
+					if (pNameBkt != nullptr) free(pNameBkt);
+					pNameBkt = pNewBkt;
+					NBkt = NewBkt;
+				}
+
+				//  Existing name
+				NX = lookupName(pName, NameLen, Hash);
+				if (NX != NoTag) {
+					pNames[NX].Count++;
+					return NX;
+				}
+
+				//  New name
+				if (NNames == CapNames) {
+					size_t		NewCap = (CapNames == 0) ? 64 : CapNames * 2;
+					Name*		pNewNames = (Name*) realloc(pNames, NewCap * sizeof(Name));
+					if (pNewNames == nullptr) return NoTag;
+					pNames = pNewNames;
+					CapNames = NewCap;
+				}
+				pNames[NNames].TX = NTags;
+				pNames[NNames].Hash = Hash;
+				pNames[NNames].First = 0;
+				pNames[NNames].Count = 1;
+
+				size_t		BX = Hash & (NBkt - 1);
+				while (pNameBkt[BX] != 0) BX = (BX + 1) & (NBkt - 1);
+				pNameBkt[BX] = NNames + 1;
+
+				return NNames++;
+			}
+
+			//  buildNameLists
+			//
+			//  Builds the lists of tags grouped by name (each list is in document order)
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the lists were built, otherwise false
+			//
+			//  NOTES:
+			//  
+
+			bool	buildNameLists() {
+				size_t		Next = 0;															//  Next free slot
+
+				pByName = (size_t*) malloc((NTags + 1) * sizeof(size_t));
+				if (pByName == nullptr) return false;
+
+				//  Allocate the slots for each name
+				for (size_t NX = 0; NX < NNames; NX++) {
+					pNames[NX].First = Next;
+					Next += pNames[NX].Count;
+					pNames[NX].Count = 0;
+				}
+
+				//  Fill the slots in document order
+				for (size_t TX = 0; TX < NTags; TX++) {
+					if (pTags[TX].Kind == CloseTag) continue;
+					const char*	pName = pDoc + pTags[TX].Pos + 1;
+					Name&		TName = pNames[lookupName(pName, pTags[TX].NameLen, hashName(pName, pTags[TX].NameLen))];
+					pByName[TName.First + TName.Count++] = TX;
+				}
+
+				return true;
+			}
+
+			//  bindEnds
+			//
+			//  Sets the scanning end of each element, this is the first closing tag with the same name that follows it
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the ends were bound, otherwise false
+			//
+			//  NOTES:
+			//
+			//		1.	The end is the tag that a scan of the document for "</name>" locates, for nested elements with the
+			//			same name this is the first (inner) closing tag rather than the matching one. Scanning and indexed
+			//			iterators therefore give the same scopes, element values and iteration ends.
+			//		2.	A closing tag is only located if it has no white space before the '>'
+			//  
+
+			bool	bindEnds() {
+				size_t*		pNextClose = (size_t*) malloc((NNames + 1) * sizeof(size_t));			//  Next closing tag for each name
+
+				if (pNextClose == nullptr) return false;
+				for (size_t NX = 0; NX < NNames; NX++) pNextClose[NX] = NoTag;
+
+				//  Walk the tags backwards tracking the next closing tag for each name
+				for (size_t TX = NTags; TX > 0; TX--) {
+					Tag&		Node = pTags[TX - 1];
+					const char*	pName = pDoc + Node.Pos + ((Node.Kind == CloseTag) ? 2 : 1);
+					size_t		NX = lookupName(pName, Node.NameLen, hashName(pName, Node.NameLen));
+
+					if (Node.Kind == EmptyTag) Node.End = TX - 1;
+					else if (Node.Kind == OpenTag) Node.End = (NX == NoTag) ? NoTag : pNextClose[NX];
+					else {
+						Node.End = TX - 1;
+						if (NX != NoTag && Node.Len == size_t(Node.NameLen) + 2) pNextClose[NX] = TX - 1;
+					}
+				}
+
+				free(pNextClose);
+				return true;
+			}
+
+			//  indexAttributes
+			//
+			//  Records the spans of the attributes of a tag
+			//
+			//  PARAMETERS:
+			//
+			//		Tag&				-		Reference to the tag being indexed
+			//		char*				-		Const pointer to the end of the tag name
+			//		char*				-		Const pointer to the end of the attributes
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true unless storage is exhausted
+			//
+			//  NOTES:
+			//
+			//		1.	Scanning stops at the first attribute that is not of the form name = "value"
+			//  
+
+			bool	indexAttributes(Tag& NewTag, const char* pScan, const char* pEnd) {
+				const char*		pName = nullptr;														//  Attribute name
+				size_t			NameLen = 0;															//  Length of the name
+				const char*		pValue = nullptr;														//  Attribute value
+				char			EQVal = 0;																//  Ending quote value
+
+				while (pScan < pEnd) {
+					while (pScan < pEnd && *pScan <= ' ') pScan++;
+					if (pScan >= pEnd) break;
+
+					//  Attribute name
+					pName = pScan;
+					while (pScan < pEnd && *pScan > ' ' && *pScan != '=') pScan++;
+					NameLen = pScan - pName;
+					while (pScan < pEnd && (*pScan <= ' ' || *pScan == '=')) pScan++;
+					if (pScan >= pEnd || NameLen == 0) break;
+
+					//  Quoted value
+					if (*pScan != SCHAR_SQUOTE && *pScan != SCHAR_DQUOTE && *pScan != SCHAR_PSQUOTE) break;
+					EQVal = *pScan;
+					if (EQVal == SCHAR_PSQUOTE) EQVal = SCHAR_PEQUOTE;
+					pScan++;
+					pValue = pScan;
+					while (pScan < pEnd && *pScan != EQVal) pScan++;
+					if (pScan >= pEnd) break;
+
+					//  Record the attribute
+					if (NewTag.NAttrs == UINT16_MAX) return false;
+					if (NAttrs == CapAttrs) {
+						size_t		NewCap = (CapAttrs == 0) ? 256 : CapAttrs * 2;
+						Attr*		pNewAttrs = (Attr*) realloc(pAttrs, NewCap * sizeof(Attr));
+						if (pNewAttrs == nullptr) return false;
+						pAttrs = pNewAttrs;
+						CapAttrs = NewCap;
+					}
+					pAttrs[NAttrs].Name = uint32_t((pName - pDoc) - NewTag.Pos);
+					pAttrs[NAttrs].NameLen = uint32_t(NameLen);
+					pAttrs[NAttrs].Value = uint32_t((pValue - pDoc) - NewTag.Pos);
+					pAttrs[NAttrs].ValueLen = uint32_t(pScan - pValue);
+					NAttrs++;
+					NewTag.NAttrs++;
+					pScan++;
+				}
+
+				return true;
+			}
+
+			//  expandTags
+			//
+			//  Makes sure that the tags array has capacity for an additional tag
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the array has capacity, otherwise false
+			//
+			//  NOTES:
+			//  
+
+			bool	expandTags() {
+				if (NTags < CapTags) return true;
+
+				size_t		NewCap = (CapTags == 0) ? 256 : CapTags * 2;
+				Tag*		pNewTags = (Tag*) realloc(pTags, NewCap * sizeof(Tag));
+				if (pNewTags == nullptr) return false;
+				pTags = pNewTags;
+				CapTags = NewCap;
+				return true;
+			}
+		};
 
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
@@ -102,6 +1072,8 @@ namespace xymorg {
 				pElement = nullptr;
 				ElementSize = 0;
 				pName = nullptr;
+				pIndex = nullptr;
+				TagX = XMLIndex::NoTag;
 
 				Depth = 0;
 				XPATH[0] = '\0';
@@ -130,6 +1102,8 @@ namespace xymorg {
 				pElement = nullptr;
 				ElementSize = 0;
 				pName = nullptr;
+				pIndex = nullptr;
+				TagX = XMLIndex::NoTag;
 
 				Depth = 0;
 				XPATH[0] = '\0';
@@ -176,13 +1150,34 @@ namespace xymorg {
 			//  NOTES:
 			//
 
-			XMLIterator(char* PPath, const char* pVRoot) {
+			XMLIterator(char* PPath, const char* pVRoot) : XMLIterator(PPath, pVRoot, nullptr) {}
+
+			//  Constructor 
+			//
+			//  Constructs the XML Iterator over the span of a particuar node, at a specified path, using a document index 
+			//
+			//  PARAMETERS:
+			//
+			//		char*			-		Const pointer to the existing path
+			//		char*			-		Const pointer to XML Node that is to be iterated
+			//		XMLIndex*		-		Const pointer to the index of the document (may be NULL)
+			//
+			//  RETURNS:
+			//
+			//  NOTES:
+			//
+			//		1.	The index must outlive the iterator
+			//
+
+			XMLIterator(const char* PPath, const char* pVRoot, const XMLIndex* pIdx) {
 				pStartNode = pVRoot;
 				pEndNode = nullptr;
 				pPosition = nullptr;
 				pElement = nullptr;
 				ElementSize = 0;
 				pName = nullptr;
+				pIndex = pIdx;
+				TagX = XMLIndex::NoTag;
 
 				strcpy_s(XPATH, cMaxNodePath + 1, PPath);
 				//  Determine the initial depth from the path
@@ -240,6 +1235,8 @@ namespace xymorg {
 				pElement = Src.pElement;
 				ElementSize = Src.ElementSize;
 				pName = Src.pName;
+				pIndex = Src.pIndex;
+				TagX = Src.TagX;
 
 				Depth = Src.Depth;
 				strcpy_s(XPATH, cMaxNodePath, Src.XPATH);
@@ -274,6 +1271,9 @@ namespace xymorg {
 				Src.ElementSize = 0;
 				pName = Src.pName;
 				Src.pName = nullptr;
+				pIndex = Src.pIndex;
+				TagX = Src.TagX;
+				Src.TagX = XMLIndex::NoTag;
 
 				Depth = Src.Depth;
 				Src.Depth = 0;
@@ -372,6 +1372,14 @@ namespace xymorg {
 					if (pEndScope == nullptr || pEndScope == pStartScope || pEndScope == pEndNode) return XMLIterator(nullptr);
 				}
 
+				//  Use the index to locate the first node with the desired tag in the scope
+				if (pIndex != nullptr) {
+					if (pStartScope == nullptr) return XMLIterator(nullptr);
+					size_t	FX = pIndex->findTag(szTag, tagOf(pStartScope), tagOf(pEndScope));
+					if (FX == XMLIndex::NoTag) return XMLIterator(nullptr);
+					return XMLIterator(XPATH, pIndex->getNode(FX), pIndex);
+				}
+
 				//  Search the scope of the current iterator for a node with the desired tag
 				pNode = strstr(pStartScope, szTag);
 
@@ -600,6 +1608,7 @@ namespace xymorg {
 			const char*		getAttribute(const char* szAttrName, size_t& AttrLen) {
 				if (pPosition == nullptr) return nullptr;
 				if (pPosition[1] == '/') return nullptr;
+				if (pIndex != nullptr) return pIndex->getAttribute(TagX, szAttrName, AttrLen);
 				return getAttribute(pPosition, szAttrName, AttrLen);
 			}
 
@@ -735,6 +1744,17 @@ namespace xymorg {
 				if (isNull()) return nullptr;
 				if (isClosing()) return nullptr;
 
+				//  Use the attribute spans from the index
+				if (pIndex != nullptr && pIndex->getTag(TagX).NAttrs > 0) {
+					const XMLIndex::Tag&	Node = pIndex->getTag(TagX);
+					pAC = new PairColl();
+					for (size_t AX = Node.FirstAttr; AX < Node.FirstAttr + Node.NAttrs; AX++) {
+						const XMLIndex::Attr&	NVP = pIndex->getAttr(AX);
+						pAC->addVariable(pPosition + NVP.Name, NVP.NameLen, pPosition + NVP.Value, NVP.ValueLen);
+					}
+					return pAC;
+				}
+
 				//  Locate the end of the node
 				pENode = strchr(pPosition, '>');
 				if (pENode == nullptr) return nullptr;
@@ -1091,6 +2111,8 @@ namespace xymorg {
 				pElement = Src.pElement;
 				ElementSize = Src.ElementSize;
 				pName = Src.pName;
+				pIndex = Src.pIndex;
+				TagX = Src.TagX;
 
 				Depth = Src.Depth;
 				strcpy_s(XPATH, cMaxNodePath, Src.XPATH);
@@ -1128,6 +2150,9 @@ namespace xymorg {
 				Src.ElementSize = 0;
 				pName = Src.pName;
 				Src.pName = nullptr;
+				pIndex = Src.pIndex;
+				TagX = Src.TagX;
+				Src.TagX = XMLIndex::NoTag;
 
 				Depth = Src.Depth;
 				Src.Depth = 0;
@@ -1156,12 +2181,40 @@ namespace xymorg {
 			const char*			pName;																		//  Pointer to the current node name
 			char				XPATH[cMaxNodePath + 1];													//  XPATH storage
 
+			const XMLIndex*		pIndex;																		//  Document index (if any)
+			size_t				TagX;																		//  Index of the current tag
+
 			//*******************************************************************************************************************
 			//*                                                                                                                 *
 			//*   Private Functions			                                                                                    *
 			//*                                                                                                                 *
 			//*******************************************************************************************************************
 
+			//  tagOf
+			//
+			//  This function will return the index of the tag at the passed node
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the node
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Index of the tag, NoTag if the node is not a tag in the index
+			//
+			//  NOTES:
+			//  
+
+			size_t		tagOf(const char* pNode) {
+				size_t		NX = XMLIndex::NoTag;
+
+				if (pNode == nullptr) return XMLIndex::NoTag;
+				if (TagX != XMLIndex::NoTag && pIndex->getNode(TagX) == pNode) return TagX;
+				NX = pIndex->locate(pNode);
+				if (pIndex->getNode(NX) != pNode) return XMLIndex::NoTag;
+				return NX;
+			}
+
 			//  advance
 			//
 			//  This function will advance the position of the iterator to the next node
@@ -1181,6 +2234,33 @@ namespace xymorg {
 				//  Safety
 				if (pPosition == nullptr) return;
 
+				//  Step to the next tag in the index
+				if (pIndex != nullptr) {
+					SCNode = pIndex->getTag(TagX).Kind == XMLIndex::EmptyTag;
+					if (pIndex->getTag(TagX).Kind == XMLIndex::CloseTag || SCNode) {
+						removeLastFromXPATH();
+						Depth--;
+					}
+
+					TagX++;
+					pPosition = pIndex->getNode(TagX);
+					if (pPosition == nullptr) {
+						TagX = XMLIndex::NoTag;
+						pElement = nullptr;
+						ElementSize = 0;
+						XPATH[0] = '\0';
+						pName = nullptr;
+						return;
+					}
+
+					if (pIndex->getTag(TagX).Kind != XMLIndex::CloseTag) {
+						appendToXPATH();
+						Depth++;
+						if (pIndex->getTag(TagX).Kind == XMLIndex::OpenTag) setElement();
+					}
+					return;
+				}
+
 				//  Determine if the current node is self-closing
 				pTemp = strchr(pPosition, '>');
 				pTemp--;
@@ -1241,6 +2321,17 @@ namespace xymorg {
 			const char*		setStartNode(const char* pNode) {
 				if (pNode == nullptr) return nullptr;
 				if (*pNode == '\0') return nullptr;
+
+				//  Locate the first opening tag at or after the node in the index
+				if (pIndex != nullptr) {
+					TagX = pIndex->locate(pNode);
+					while (TagX != XMLIndex::NoTag && pIndex->getTag(TagX).Kind == XMLIndex::CloseTag) {
+						TagX++;
+						if (TagX >= pIndex->getTagCount()) TagX = XMLIndex::NoTag;
+					}
+					return pIndex->getNode(TagX);
+				}
+
 				pNode = strchr(pNode, '<');
 				if (pNode == nullptr) return nullptr;
 
@@ -1274,6 +2365,13 @@ namespace xymorg {
 				
 				if (pNode == nullptr) return nullptr;
 
+				//  The index holds the end of the element
+				if (pIndex != nullptr) {
+					size_t		NX = tagOf(pNode);
+					if (NX == XMLIndex::NoTag) return nullptr;
+					return pIndex->getNode(pIndex->getTag(NX).End);
+				}
+
 				//
 				//  If the node is self closing then return the pointer to passed node
 				//
@@ -1324,6 +2422,16 @@ namespace xymorg {
 
 				if (pPosition == nullptr) return;
 
+				//  The index holds the extent of the element
+				if (pIndex != nullptr) {
+					const XMLIndex::Tag&	Node = pIndex->getTag(TagX);
+					if (Node.Kind != XMLIndex::OpenTag || Node.End == XMLIndex::NoTag) return;
+					pElement = pPosition + Node.Len + 1;
+					ElementSize = pIndex->getTag(Node.End).Pos - (Node.Pos + Node.Len + 1);
+					if (ElementSize == 0) pElement = nullptr;
+					return;
+				}
+
 				pEndOfNode = findCloseNode(pPosition);
 
 				if (pEndOfNode == nullptr) return;
@@ -1564,7 +2672,7 @@ namespace xymorg {
 		//  NOTES:
 		//
 
-		XMLMicroParser() {
+		XMLMicroParser() : Index() {
 
 			//  Clear persistent members
 			pDoc = nullptr;
@@ -1584,21 +2692,81 @@ namespace xymorg {
 		//  PARAMETERS:
 		//
 		//		char *			-		Const Pointer to XML Document (nullptr terminated)
+		//		bool			-		true if the document is to be indexed
 		//
 		//  RETURNS:
 		//
 		//  NOTES:
 		//
 
-		XMLMicroParser(const char *szXMLDoc) {
+		XMLMicroParser(const char *szXMLDoc, bool Indexed = false) : Index() {
 
 			//  Load the passed document
-			XMLIsValid = loadDocument(szXMLDoc);
+			XMLIsValid = loadDocument(szXMLDoc, Indexed);
+
+			//  Return to caller
+			return;
+		}
+
+		//  Copy Constructor 
+		//
+		//  Constructs the XML Micro Parser on the same document as an existing parser
+		//
+		//  PARAMETERS:
+		//
+		//		XMLMicroParser&		-		Const reference to the source parser
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The index (if any) is rebuilt for the new parser
+		//
+
+		XMLMicroParser(const XMLMicroParser& Src) : Index() {
+
+			//  Load the document of the source parser
+			XMLIsValid = loadDocument(Src.pDoc, Src.Index.isBuilt());
 
 			//  Return to caller
 			return;
 		}
 
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Operator Overload Functions                                                                                   *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Copy Assignment
+		//
+		//  Repositions the XML Micro Parser on the same document as an existing parser
+		//
+		//  PARAMETERS:
+		//
+		//		XMLMicroParser&		-		Const reference to the source parser
+		//
+		//  RETURNS:
+		//
+		//		XMLMicroParser&		-		Reference to this parser
+		//
+		//  NOTES:
+		//
+		//		1.	The current index (if any) is discarded and the index is rebuilt if the source parser is indexed
+		//
+
+		XMLMicroParser& operator = (const XMLMicroParser& Src) {
+
+			//  Self assignment leaves the parser unchanged
+			if (this == &Src) return *this;
+
+			//  Load the document of the source parser
+			XMLIsValid = loadDocument(Src.pDoc, Src.Index.isBuilt());
+
+			//  Return to caller
+			return *this;
+		}
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Destructor			                                                                                        *
@@ -1676,6 +2844,22 @@ namespace xymorg {
 
 		bool   isValid() const { return XMLIsValid; }
 
+		//  isIndexed
+		//
+		//  Returns an indication if the XML document has been indexed
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the document is indexed, otherwise false
+		//
+		//  NOTES:
+		//
+		//  
+
+		bool   isIndexed() const { return Index.isBuilt(); }
+
 		//  getScope
 		//
 		//  This function returns an iterator over the scope of the complete XML document
@@ -1690,6 +2874,7 @@ namespace xymorg {
 		//  
 
 		XMLIterator		getScope() {
+			if (Index.isBuilt()) return XMLIterator("", pRoot, &Index);
 			return XMLIterator(pRoot);
 		}
 
@@ -1715,6 +2900,13 @@ namespace xymorg {
 			if (szTag == nullptr) return XMLIterator(nullptr);
 			if (szTag[0] == '\0') return XMLIterator(nullptr);
 
+			//  Use the index to locate the first matching tag
+			if (Index.isBuilt()) {
+				size_t	FX = Index.findTag(szTag, 0, Index.getTagCount());
+				if (FX == XMLIndex::NoTag) return XMLIterator(nullptr);
+				return XMLIterator("", Index.getNode(FX), &Index);
+			}
+
 			//
 			//  Search the complete document for a matching tag
 			//
@@ -1744,6 +2936,7 @@ namespace xymorg {
 		//  PARAMETERS:
 		//
 		//		cost char*				-		Const pointer to the XML document to be loaded (nullptr terminated)
+		//		bool					-		true if the document is to be indexed
 		//
 		//  RETURNS:
 		//
@@ -1752,9 +2945,11 @@ namespace xymorg {
 		//  NOTES:
 		//
 		//		Loading does not perform a complete validationof the XML document, only trivial checks are performed
+		//		An indexed document is scanned once, scope lookups, iteration and attribute access then use the index.
+		//		If the index cannot be built the document is handled without it.
 		//  
 
-		bool   loadDocument(const char *pXMLDoc) {
+		bool   loadDocument(const char *pXMLDoc, bool Indexed = false) {
 			XMLIterator				itX(nullptr);																//  Iterator
 
 			//  Clear persistent members
@@ -1763,6 +2958,7 @@ namespace xymorg {
 			pXMLDecl = nullptr;
 			pXMLDTD = nullptr;
 			XMLIsValid = false;
+			Index.dismiss();
 
 			//  Safety checks
 			if (pXMLDoc == nullptr) return false;
@@ -1830,10 +3026,13 @@ namespace xymorg {
 			//  We are now positioned at the root node of the XML document
 			pRoot = pXMLDoc;
 
+			//  Build the index (if requested)
+			if (Indexed) Index.build(pDoc, pRoot);
+
 			//
 			//  Perform an iteration over the XML document -- if the document is valid this should end up at the end-root node
 			//
-			for (itX = XMLIterator(pRoot); !itX.isAtEnd(); itX++);
+			for (itX = getScope(); !itX.isAtEnd(); itX++);
 			
 			pXMLDoc = itX.getNode();
 			if (pXMLDoc == nullptr) return false;
@@ -2164,6 +3363,9 @@ namespace xymorg {
 		//  Validity Flag
 		bool		XMLIsValid;																		//  Validity of the XML Document
 
+		//  Document Index
+		XMLIndex	Index;																			//  Structural index of the document
+
 		//*******************************************************************************************************************
 		//*                                                                                                                 *
 		//*   Private Functions                                                                                             *
@@ -0,0 +1,1118 @@
+#pragma once
+//*******************************************************************************************************************
+//*																													*
+//*   File:       XMLStreamParser.h																					*
+//*   Suite:      xymorg Integration																				*
+//*   Version:    1.0.0	(Build: 01)																					*
+//*   Author:     Ian Tree/HMNL																						*
+//*																													*
+//*   Copyright 2017 - 2026 Ian J. Tree.																			*
+//*******************************************************************************************************************
+//*																													*
+//*	This header file contains the definition for the XMLStreamParser class. The XMLStreamParser class provides		*
+//* an event driven (SAX style) parse of XML documents that are too large to be loaded as a single image.			*
+//*																													*
+//*	USAGE:																											*
+//*																													*
+//*		Derive a handler from XMLStreamParser::Handler overriding the events of interest, construct a parser		*
+//*		on the handler and call parse() with a file descriptor or ByteStream. Alternatively the document may		*
+//*		be pushed through the parser in chunks of any size with feed() followed by finish().						*
+//*																													*
+//*	NOTES:																											*
+//*																													*
+//*	1.		Memory use is bounded by the nesting depth of the document and the size of the largest tag, it does		*
+//*			not depend on the size of the document.																	*
+//*	2.		Tags are recognised with the same rules as the XMLMicroParser. Comments, processing instructions		*
+//*			and declarations are skipped, CDATA sections are delivered as character data.							*
+//*	3.		Character data may be delivered in more than one call, character data outside of any element is			*
+//*			not delivered.																							*
+//*	4.		Names and attribute values delivered to the handler are null terminated and remain valid only for		*
+//*			the duration of the call.																				*
+//*	5.		A document may contain more than one top level element, e.g. a log of records.							*
+//*																													*
+//*******************************************************************************************************************
+//*																													*
+//*   History:																										*
+//*																													*
+//*	1.0.0 -		19/10/2026	-	Initial Release																		*
+//*																													*
+//*******************************************************************************************************************/
+
+//  Include xymorg headers
+#include	"LPBHdrs.h"																			//  Language and Platform base headers
+#include	"types.h"																			//  xymorg type definitions
+#include	"consts.h"																			//  xymorg constant definitions
+
+//  Additional component headers
+#include	"MISC/PairColl.h"																	//  Pairs Collection
+#include	"CODECS/Bitstreams.h"																//  ByteStream
+
+//  Platform file descriptor I/O
+#if  (defined(_WIN32) || defined(_WIN64))
+#include	<io.h>																				//  Low level I/O
+#define		XSP_READ(f,b,l)		_read(f, b, (unsigned int) (l))
+#else
+#define		XSP_READ(f,b,l)		read(f, b, l)
+#endif
+
+//
+//  All components are defined within the xymorg namespace
+//
+namespace xymorg {
+
+	//
+	//   GLOBAL DEFINITIONS
+	//
+
+#define			XSP_CHUNK_SIZE				65536												//  Default size of a read from the source
+#define			XSP_TEXT_FLUSH				65536												//  CDATA delivery threshold
+#define			XSP_MAX_TAG_SIZE			16777216											//  Maximum size of a single tag
+
+	//
+	//  XMLStreamParser Class Definition
+	//
+
+	class XMLStreamParser {
+	public:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Element Class		                                                                                            *
+		//*																													*
+		//*	  The Element class describes the opening tag of an element as it is delivered to the handler.					*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class Element {
+		public:
+
+			//  Allow the parser to populate the element
+			friend class XMLStreamParser;
+
+			//  getName
+			//
+			//  Returns the name of the element
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the null terminated name
+			//
+			//  NOTES:
+			//
+
+			const char*		getName() const { return pName; }
+
+			//  getNameLength
+			//
+			//  Returns the length of the name of the element
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Length of the name
+			//
+			//  NOTES:
+			//
+
+			size_t		getNameLength() const { return NameLen; }
+
+			//  getDepth
+			//
+			//  Returns the depth of the element, a top level element has a depth of zero
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Depth of the element
+			//
+			//  NOTES:
+			//
+
+			size_t		getDepth() const { return Depth; }
+
+			//  isEmpty
+			//
+			//  Returns an indication if the element is self-closing (<name/>), the end of the element is delivered
+			//	immediately after the start
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the element is self-closing, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool		isEmpty() const { return Empty; }
+
+			//  getAttributeCount
+			//
+			//  Returns the number of attributes of the element
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		size_t				-		Number of attributes
+			//
+			//  NOTES:
+			//
+
+			size_t		getAttributeCount() const { return NAttrs; }
+
+			//  getAttributeName
+			//
+			//  Returns the name of an attribute by position
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the attribute
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the null terminated name, nullptr if out of range
+			//
+			//  NOTES:
+			//
+
+			const char*		getAttributeName(size_t AX) const {
+				if (AX >= NAttrs) return nullptr;
+				return pTag + pAttrs[AX].Name;
+			}
+
+			//  getAttributeValue
+			//
+			//  Returns the value of an attribute by position
+			//
+			//  PARAMETERS:
+			//
+			//		size_t				-		Index of the attribute
+			//		size_t&				-		Reference to the variable to hold the length of the value
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the null terminated value, nullptr if out of range
+			//
+			//  NOTES:
+			//
+
+			const char*		getAttributeValue(size_t AX, size_t& AttrLen) const {
+				AttrLen = 0;
+				if (AX >= NAttrs) return nullptr;
+				AttrLen = pAttrs[AX].ValueLen;
+				return pTag + pAttrs[AX].Value;
+			}
+
+			//  hasAttribute
+			//
+			//  Returns an indication if the named attribute is present on the element
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Pointer to the name of the attribute
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true if the attribute is present, otherwise false
+			//
+			//  NOTES:
+			//
+
+			bool	hasAttribute(const char* szAttrName) const {
+				size_t		AttrLen = 0;
+				return getAttribute(szAttrName, AttrLen) != nullptr;
+			}
+
+			//  getAttribute
+			//
+			//  Returns the value of the named attribute
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Pointer to the name of the attribute
+			//		size_t&				-		Reference to the variable to hold the length of the value
+			//
+			//  RETURNS:
+			//
+			//		char*				-		Const pointer to the null terminated value, nullptr if not present
+			//
+			//  NOTES:
+			//
+			//		1.	Attribute names are matched case insensitively
+			//
+
+			const char*		getAttribute(const char* szAttrName, size_t& AttrLen) const {
+				size_t		ANLen = 0;																//  Length of the attribute name
+
+				AttrLen = 0;
+				if (szAttrName == nullptr) return nullptr;
+				ANLen = strlen(szAttrName);
+
+				for (size_t AX = 0; AX < NAttrs; AX++) {
+					if (pAttrs[AX].NameLen == ANLen && _memicmp(pTag + pAttrs[AX].Name, szAttrName, ANLen) == 0) {
+						AttrLen = pAttrs[AX].ValueLen;
+						return pTag + pAttrs[AX].Value;
+					}
+				}
+
+				return nullptr;
+			}
+
+			//  marshallAttributes
+			//
+			//  This function will return a pointer to a new Pairs collection containing the name and value of each attribute
+			//	of the element.
+			//
+			//  PARAMETERS:
+			//
+			//  RETURNS:
+			//
+			//		ParColl*				-		Pointer to the attribute values in a pairs collection, nullptr if none
+			//
+			//  NOTES:
+			//
+			//		1.	The caller is responsible for deleting the collection
+			//
+
+			PairColl*	marshallAttributes() const {
+				PairColl*		pAC = nullptr;															//  Pairs Attributes collection
+
+				if (NAttrs == 0) return nullptr;
+
+				pAC = new PairColl();
+				for (size_t AX = 0; AX < NAttrs; AX++) {
+					pAC->addVariable(pTag + pAttrs[AX].Name, pAttrs[AX].NameLen, pTag + pAttrs[AX].Value, pAttrs[AX].ValueLen);
+				}
+
+				return pAC;
+			}
+
+		private:
+
+			//  Attribute span within the tag
+			typedef struct Attr {
+				size_t		Name;																		//  Offset of the name
+				size_t		NameLen;																	//  Length of the name
+				size_t		Value;																		//  Offset of the value
+				size_t		ValueLen;																	//  Length of the value
+			} Attr;
+
+			const char*		pTag = nullptr;																//  Tag text
+			const char*		pName = nullptr;															//  Element name
+			size_t			NameLen = 0;																//  Length of the name
+			size_t			Depth = 0;																	//  Depth of the element
+			bool			Empty = false;																//  Self-closing element
+			const Attr*		pAttrs = nullptr;															//  Attribute spans
+			size_t			NAttrs = 0;																	//  Number of attributes
+		};
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Handler Class		                                                                                            *
+		//*																													*
+		//*	  The Handler class is the base class for the receiver of the parse events. The default implementation of		*
+		//*	  each event ignores the event.																					*
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		class Handler {
+		public:
+
+			//  Destructor
+			virtual ~Handler() {}
+
+			//  startElement
+			//
+			//  Called when the opening tag of an element has been parsed
+			//
+			//  PARAMETERS:
+			//
+			//		Element&			-		Const reference to the element
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true to continue parsing, false to stop
+			//
+			//  NOTES:
+			//
+
+			virtual bool	startElement(const Element&) { return true; }
+
+			//  endElement
+			//
+			//  Called when the closing tag of an element has been parsed
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the null terminated name of the element
+			//		size_t				-		Depth of the element
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true to continue parsing, false to stop
+			//
+			//  NOTES:
+			//
+
+			virtual bool	endElement(const char*, size_t) { return true; }
+
+			//  characters
+			//
+			//  Called with character data from the content of an element
+			//
+			//  PARAMETERS:
+			//
+			//		char*				-		Const pointer to the character data (not null terminated)
+			//		size_t				-		Length of the character data
+			//		size_t				-		Depth of the element that contains the data
+			//
+			//  RETURNS:
+			//
+			//		bool				-		true to continue parsing, false to stop
+			//
+			//  NOTES:
+			//
+
+			virtual bool	characters(const char*, size_t, size_t) { return true; }
+		};
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Constructors			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Constructor
+		//
+		//  Constructs the parser to deliver events to the passed handler
+		//
+		//  PARAMETERS:
+		//
+		//		Handler&			-		Reference to the handler for the events
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		XMLStreamParser(Handler& EvtHandler) : pHandler(&EvtHandler) {
+
+			//  Set the initial state
+			reset();
+
+			//  Return to caller
+			return;
+		}
+
+		//  Copy and move are not supported
+		XMLStreamParser(const XMLStreamParser&) = delete;
+		XMLStreamParser& operator = (const XMLStreamParser&) = delete;
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Destructor			                                                                                        *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Destructor
+		//
+		//  Destroys the parser, releasing the working storage
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		~XMLStreamParser() {
+
+			if (pTagBuf != nullptr) free(pTagBuf);
+			if (pTextBuf != nullptr) free(pTextBuf);
+			if (pNames != nullptr) free(pNames);
+			if (pNameX != nullptr) free(pNameX);
+			if (pAttrs != nullptr) free(pAttrs);
+
+			//  Return to caller
+			return;
+		}
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Public Functions                                                                                              *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  parse
+		//
+		//  Parses the document read from a file descriptor
+		//
+		//  PARAMETERS:
+		//
+		//		int					-		File descriptor open for reading, positioned at the start of the document
+		//		size_t				-		Size of each read from the descriptor
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the complete document was parsed, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The descriptor is read until end of file, it is not closed
+		//
+
+		bool	parse(int FD, size_t ChunkSize = XSP_CHUNK_SIZE) {
+			char*		pChunk = nullptr;															//  Read buffer
+			int64_t		ReadLen = 0;																//  Length of the last read
+
+			reset();
+			if (ChunkSize == 0) ChunkSize = XSP_CHUNK_SIZE;
+			pChunk = (char*) malloc(ChunkSize);
+			if (pChunk == nullptr) {
+				Failed = true;
+				return false;
+			}
+
+			for (;;) {
+				ReadLen = int64_t(XSP_READ(FD, pChunk, ChunkSize));
+				if (ReadLen < 0 && errno == EINTR) continue;
+				if (ReadLen < 0) Failed = true;
+				if (ReadLen <= 0) break;
+				if (!feed(pChunk, size_t(ReadLen))) break;
+			}
+
+			free(pChunk);
+			return finish();
+		}
+
+		//  parse
+		//
+		//  Parses the document read from a ByteStream
+		//
+		//  PARAMETERS:
+		//
+		//		ByteStream&			-		Reference to the stream positioned at the start of the document
+		//		size_t				-		Size of each chunk drawn from the stream
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the complete document was parsed, otherwise false
+		//
+		//  NOTES:
+		//
+		//		1.	The stream is read through next() so that specialised streams deliver their decoded content
+		//
+
+		bool	parse(ByteStream& Src, size_t ChunkSize = XSP_CHUNK_SIZE) {
+			char*		pChunk = nullptr;															//  Chunk buffer
+			size_t		ChunkLen = 0;																//  Bytes in the chunk
+
+			reset();
+			if (ChunkSize == 0) ChunkSize = XSP_CHUNK_SIZE;
+			pChunk = (char*) malloc(ChunkSize);
+			if (pChunk == nullptr) {
+				Failed = true;
+				return false;
+			}
+
+			while (!Src.eos()) {
+				ChunkLen = 0;
+				while (ChunkLen < ChunkSize && !Src.eos()) pChunk[ChunkLen++] = char(Src.next());
+				if (!feed(pChunk, ChunkLen)) break;
+			}
+
+			free(pChunk);
+			return finish();
+		}
+
+		//  feed
+		//
+		//  Pushes the next part of the document through the parser
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the data
+		//		size_t				-		Length of the data
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if parsing may continue, false if the document is not well-formed or the
+		//									handler has stopped the parse
+		//
+		//  NOTES:
+		//
+		//		1.	The document may be divided at any point
+		//
+
+		bool	feed(const char* pData, size_t DataLen) {
+			const char*		pScan = pData;															//  Scanning pointer
+			const char*		pEnd = pData + DataLen;													//  End of the data
+			const char*		pStop = nullptr;														//  End of the current span
+			char			NextChar = 0;															//  Classified character
+
+			if (Failed || Stopped) return false;
+			if (pData == nullptr) return DataLen == 0;
+
+			while (pScan < pEnd && !Failed && !Stopped) {
+				switch (State) {
+
+				case InText:
+					//  Deliver the character data up to the next tag
+					pStop = (const char*) memchr(pScan, '<', pEnd - pScan);
+					if (pStop == nullptr) pStop = pEnd;
+					if (pStop > pScan && Depth > 0 && !pHandler->characters(pScan, pStop - pScan, Depth - 1)) Stopped = true;
+					pScan = pStop;
+					if (pScan < pEnd) {
+						TagLen = 0;
+						appendTag(pScan++, 1);
+						State = InTag;
+					}
+					break;
+
+				case InTag:
+					//  Classify the markup from the first characters
+					if (TagLen == 1 || pTagBuf[1] == '!') {
+						NextChar = *pScan;
+						appendTag(pScan++, 1);
+						if (TagLen == 2 && NextChar == '?') beginSkip("?>", InSkip);
+						else if (TagLen == 2 && NextChar == '>') Failed = true;
+						else if (pTagBuf[1] == '!') {
+							if (TagLen == 4 && memcmp(pTagBuf, "<!--", 4) == 0) beginSkip("-->", InSkip);
+							else if (TagLen == 9 && memcmp(pTagBuf, "<![CDATA[", 9) == 0) {
+								TextLen = 0;
+								beginSkip("]]>", InCData);
+							}
+							else if (memcmp(pTagBuf, "<!--", (TagLen < 4) ? TagLen : 4) != 0 &&
+									 memcmp(pTagBuf, "<![CDATA[", (TagLen < 9) ? TagLen : 9) != 0) {
+								//  Any other declaration
+								if (NextChar == '>') State = InText;
+								else beginSkip(">", InSkip);
+							}
+						}
+						break;
+					}
+
+					//  Accumulate the tag up to the closing '>'
+					pStop = (const char*) memchr(pScan, '>', pEnd - pScan);
+					if (pStop == nullptr) pStop = pEnd;
+					appendTag(pScan, pStop - pScan);
+					pScan = pStop;
+					if (pScan < pEnd && !Failed) {
+						pScan++;
+						State = InText;
+						processTag();
+					}
+					break;
+
+				case InSkip:
+					//  Skip to the end of the comment, processing instruction or declaration
+					if (scanToTerm(pScan, pEnd)) State = InText;
+					break;
+
+				case InCData:
+					//  Accumulate the CDATA section, delivering it as character data
+					pStop = pScan;
+					if (scanToTerm(pScan, pEnd)) {
+						appendText(pStop, pScan - pStop);
+						State = InText;
+						if (!Failed && TextLen > 3 && Depth > 0 && !pHandler->characters(pTextBuf, TextLen - 3, Depth - 1)) Stopped = true;
+						TextLen = 0;
+					}
+					else {
+						appendText(pStop, pScan - pStop);
+						if (!Failed && TextLen >= XSP_TEXT_FLUSH) {
+							//  Hold back a possible partial terminator
+							if (Depth > 0 && !pHandler->characters(pTextBuf, TextLen - 2, Depth - 1)) Stopped = true;
+							memmove(pTextBuf, pTextBuf + TextLen - 2, 2);
+							TextLen = 2;
+						}
+					}
+					break;
+				}
+			}
+
+			//  Update the position in the document
+			Offset += pScan - pData;
+			return !Failed && !Stopped;
+		}
+
+		//  finish
+		//
+		//  Completes the parse after the last part of the document has been fed
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the complete document was parsed, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	finish() {
+			if (Failed || Stopped) return false;
+			if (State != InText || Depth > 0 || Elements == 0) Failed = true;
+			return !Failed;
+		}
+
+		//  reset
+		//
+		//  Resets the parser ready for a new document, the working storage is retained
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	reset() {
+			State = InText;
+			TagLen = 0;
+			TextLen = 0;
+			NamesLen = 0;
+			Depth = 0;
+			NAttrs = 0;
+			HistLen = 0;
+			Elements = 0;
+			Offset = 0;
+			Failed = false;
+			Stopped = false;
+
+			//  Return to caller
+			return;
+		}
+
+		//  hasFailed
+		//
+		//  Returns an indication if the document was found not to be well-formed (or storage was exhausted)
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the parse failed, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	hasFailed() const { return Failed; }
+
+		//  wasStopped
+		//
+		//  Returns an indication if the handler stopped the parse
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the handler stopped the parse, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	wasStopped() const { return Stopped; }
+
+		//  getOffset
+		//
+		//  Returns the number of bytes of the document that have been consumed
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//		size_t				-		Offset in the document, following a failure this is just beyond the point of failure
+		//
+		//  NOTES:
+		//
+
+		size_t	getOffset() const { return Offset; }
+
+	private:
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Members			                                                                                    *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  Parse states
+		static const int	InText = 0;																	//  Character data
+		static const int	InTag = 1;																	//  Accumulating a tag
+		static const int	InSkip = 2;																	//  Skipping a comment, PI or declaration
+		static const int	InCData = 3;																//  Accumulating a CDATA section
+
+		Handler*		pHandler;																		//  Event handler
+		int				State = InText;																	//  Current parse state
+
+		//  Current tag
+		char*			pTagBuf = nullptr;																//  Tag buffer
+		size_t			TagLen = 0;																		//  Length of the tag
+		size_t			TagCap = 0;																		//  Capacity of the tag buffer
+		Element::Attr*	pAttrs = nullptr;																//  Attribute spans
+		size_t			NAttrs = 0;																		//  Number of attributes
+		size_t			CapAttrs = 0;																	//  Capacity of the spans
+
+		//  CDATA content
+		char*			pTextBuf = nullptr;																//  Text buffer
+		size_t			TextLen = 0;																	//  Length of the text
+		size_t			TextCap = 0;																	//  Capacity of the text buffer
+
+		//  Open element names
+		char*			pNames = nullptr;																//  Names of the open elements (null terminated)
+		size_t			NamesLen = 0;																	//  Length of the names
+		size_t			NamesCap = 0;																	//  Capacity of the names
+		size_t*			pNameX = nullptr;																//  Offset of the name at each depth
+		size_t			Depth = 0;																		//  Number of open elements
+		size_t			DepthCap = 0;																	//  Capacity of the offsets
+
+		//  Terminator matching
+		const char*		szTerm = nullptr;																//  Terminator being searched for
+		size_t			TermLen = 0;																	//  Length of the terminator
+		char			History[2] = {};																//  Last characters scanned
+		size_t			HistLen = 0;																	//  Number of characters in the history
+
+		//  Status
+		size_t			Elements = 0;																	//  Number of elements parsed
+		size_t			Offset = 0;																		//  Bytes consumed
+		bool			Failed = false;																	//  Document is not well-formed
+		bool			Stopped = false;																//  Handler stopped the parse
+
+		//*******************************************************************************************************************
+		//*                                                                                                                 *
+		//*   Private Functions                                                                                             *
+		//*                                                                                                                 *
+		//*******************************************************************************************************************
+
+		//  processTag
+		//
+		//  Processes a complete opening, closing or self-closing tag, delivering the events to the handler
+		//
+		//  PARAMETERS:
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+		//		1.	The tag buffer holds the tag from the '<' up to (not including) the '>'
+		//
+
+		void	processTag() {
+			char*		pName = nullptr;																//  Element name
+			size_t		NameLen = 0;																	//  Length of the name
+			Element		El;																				//  Element description
+
+			if (!appendTag("", 1)) return;
+			TagLen--;
+
+			if (pTagBuf[1] == '/') {
+				//  Closing tag - must match the innermost open element
+				pName = pTagBuf + 2;
+				while (pName[NameLen] > ' ') NameLen++;
+				if (Depth == 0 || NamesLen - pNameX[Depth - 1] - 1 != NameLen || memcmp(pNames + pNameX[Depth - 1], pName, NameLen) != 0) {
+					Failed = true;
+					return;
+				}
+				Depth--;
+				NamesLen = pNameX[Depth];
+				if (!pHandler->endElement(pNames + NamesLen, Depth)) Stopped = true;
+				return;
+			}
+
+			//  Opening or self-closing tag
+			pName = pTagBuf + 1;
+			while (pName[NameLen] > ' ' && pName[NameLen] != '/') NameLen++;
+			if (NameLen == 0) {
+				Failed = true;
+				return;
+			}
+			El.Empty = (pTagBuf[TagLen - 1] == '/');
+			if (!scanAttributes(1 + NameLen, El.Empty ? TagLen - 1 : TagLen)) return;
+
+			//  Terminate the name and the attribute values in place
+			pName[NameLen] = '\0';
+			for (size_t AX = 0; AX < NAttrs; AX++) {
+				pTagBuf[pAttrs[AX].Name + pAttrs[AX].NameLen] = '\0';
+				pTagBuf[pAttrs[AX].Value + pAttrs[AX].ValueLen] = '\0';
+			}
+
+			El.pTag = pTagBuf;
+			El.pName = pName;
+			El.NameLen = NameLen;
+			El.Depth = Depth;
+			El.pAttrs = pAttrs;
+			El.NAttrs = NAttrs;
+			Elements++;
+
+			if (!pHandler->startElement(El)) {
+				Stopped = true;
+				return;
+			}
+			if (El.Empty) {
+				if (!pHandler->endElement(pName, Depth)) Stopped = true;
+				return;
+			}
+
+			//  Push the name onto the open element stack
+			if (Depth == DepthCap) {
+				size_t		NewCap = (DepthCap == 0) ? 64 : DepthCap * 2;
+				size_t*		pNewX = (size_t*) realloc(pNameX, NewCap * sizeof(size_t));
+				if (pNewX == nullptr) {
+					Failed = true;
+					return;
+				}
+				pNameX = pNewX;
+				DepthCap = NewCap;
+			}
+			if (!reserve(pNames, NamesCap, NamesLen + NameLen + 1)) return;
+			pNameX[Depth++] = NamesLen;
+			memcpy(pNames + NamesLen, pName, NameLen + 1);
+			NamesLen += NameLen + 1;
+			return;
+		}
+
+		//  scanAttributes
+		//
+		//  Records the spans of the attributes of the current tag
+		//
+		//  PARAMETERS:
+		//
+		//		size_t				-		Offset of the end of the tag name
+		//		size_t				-		Offset of the end of the attributes
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true unless storage is exhausted
+		//
+		//  NOTES:
+		//
+		//		1.	Scanning stops at the first attribute that is not of the form name = "value"
+		//
+
+		bool	scanAttributes(size_t AX, size_t EndX) {
+			size_t		NameX = 0;																		//  Offset of the attribute name
+			size_t		NameLen = 0;																	//  Length of the name
+			size_t		ValueX = 0;																		//  Offset of the value
+			char		EQVal = 0;																		//  Ending quote value
+
+			NAttrs = 0;
+			while (AX < EndX) {
+				while (AX < EndX && pTagBuf[AX] <= ' ') AX++;
+				if (AX >= EndX) break;
+
+				//  Attribute name
+				NameX = AX;
+				while (AX < EndX && pTagBuf[AX] > ' ' && pTagBuf[AX] != '=') AX++;
+				NameLen = AX - NameX;
+				while (AX < EndX && (pTagBuf[AX] <= ' ' || pTagBuf[AX] == '=')) AX++;
+				if (AX >= EndX || NameLen == 0) break;
+
+				//  Quoted value
+				if (pTagBuf[AX] != SCHAR_SQUOTE && pTagBuf[AX] != SCHAR_DQUOTE && pTagBuf[AX] != SCHAR_PSQUOTE) break;
+				EQVal = pTagBuf[AX];
+				if (EQVal == SCHAR_PSQUOTE) EQVal = SCHAR_PEQUOTE;
+				AX++;
+				ValueX = AX;
+				while (AX < EndX && pTagBuf[AX] != EQVal) AX++;
+				if (AX >= EndX) break;
+
+				//  Record the attribute
+				if (NAttrs == CapAttrs) {
+					size_t			NewCap = (CapAttrs == 0) ? 16 : CapAttrs * 2;
+					Element::Attr*	pNewAttrs = (Element::Attr*) realloc(pAttrs, NewCap * sizeof(Element::Attr));
+					if (pNewAttrs == nullptr) {
+						Failed = true;
+						return false;
+					}
+					pAttrs = pNewAttrs;
+					CapAttrs = NewCap;
+				}
+				pAttrs[NAttrs].Name = NameX;
+				pAttrs[NAttrs].NameLen = NameLen;
+				pAttrs[NAttrs].Value = ValueX;
+				pAttrs[NAttrs].ValueLen = AX - ValueX;
+				NAttrs++;
+				AX++;
+			}
+
+			return true;
+		}
+
+		//  beginSkip
+		//
+		//  Starts the search for the terminator of a comment, processing instruction, declaration or CDATA section
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the terminator (at most 3 characters)
+		//		int					-		State while searching
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	beginSkip(const char* szTerminator, int NewState) {
+			szTerm = szTerminator;
+			TermLen = strlen(szTerminator);
+			HistLen = 0;
+			State = NewState;
+
+			//  Return to caller
+			return;
+		}
+
+		//  scanToTerm
+		//
+		//  Scans forward for the current terminator, the terminator may be split between parts of the document
+		//
+		//  PARAMETERS:
+		//
+		//		char*&				-		Reference to the scanning pointer, updated to follow the terminator or to the end
+		//		char*				-		Const pointer to the end of the data
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the terminator was found, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	scanToTerm(const char*& pScan, const char* pEnd) {
+			const char*		pLast = nullptr;														//  Candidate final character
+			size_t			Needed = TermLen - 1;													//  Characters needed before the final one
+
+			while (pScan < pEnd) {
+				pLast = (const char*) memchr(pScan, szTerm[Needed], pEnd - pScan);
+				if (pLast == nullptr) {
+					remember(pScan, pEnd);
+					pScan = pEnd;
+					return false;
+				}
+				remember(pScan, pLast);
+				pScan = pLast + 1;
+				if (HistLen >= Needed && memcmp(History + HistLen - Needed, szTerm, Needed) == 0) return true;
+				remember(pLast, pScan);
+			}
+
+			return false;
+		}
+
+		//  remember
+		//
+		//  Records the trailing characters of a scanned span in the history
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the start of the span
+		//		char*				-		Const pointer to the end of the span
+		//
+		//  RETURNS:
+		//
+		//  NOTES:
+		//
+
+		void	remember(const char* pFrom, const char* pTo) {
+			if (pTo - pFrom >= 2) {
+				History[0] = pTo[-2];
+				History[1] = pTo[-1];
+				HistLen = 2;
+			}
+			else if (pTo > pFrom) {
+				if (HistLen == 2) History[0] = History[1];
+				History[(HistLen == 2) ? 1 : HistLen++] = *pFrom;
+			}
+
+			//  Return to caller
+			return;
+		}
+
+		//  appendTag
+		//
+		//  Appends characters to the tag buffer
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the characters
+		//		size_t				-		Number of characters
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if appended, false if the tag is too large or storage is exhausted
+		//
+		//  NOTES:
+		//
+
+		bool	appendTag(const char* pChars, size_t Count) {
+			if (TagLen + Count > XSP_MAX_TAG_SIZE) {
+				Failed = true;
+				return false;
+			}
+			if (!reserve(pTagBuf, TagCap, TagLen + Count)) return false;
+			memcpy(pTagBuf + TagLen, pChars, Count);
+			TagLen += Count;
+			return true;
+		}
+
+		//  appendText
+		//
+		//  Appends characters to the CDATA buffer
+		//
+		//  PARAMETERS:
+		//
+		//		char*				-		Const pointer to the characters
+		//		size_t				-		Number of characters
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if appended, false if storage is exhausted
+		//
+		//  NOTES:
+		//
+
+		bool	appendText(const char* pChars, size_t Count) {
+			if (!reserve(pTextBuf, TextCap, TextLen + Count)) return false;
+			memcpy(pTextBuf + TextLen, pChars, Count);
+			TextLen += Count;
+			return true;
+		}
+
+		//  reserve
+		//
+		//  Makes sure that a buffer has at least the required capacity
+		//
+		//  PARAMETERS:
+		//
+		//		char*&				-		Reference to the buffer pointer
+		//		size_t&				-		Reference to the buffer capacity
+		//		size_t				-		Required capacity
+		//
+		//  RETURNS:
+		//
+		//		bool				-		true if the buffer has the capacity, otherwise false
+		//
+		//  NOTES:
+		//
+
+		bool	reserve(char*& pBfr, size_t& Cap, size_t Required) {
+			size_t		NewCap = (Cap == 0) ? 256 : Cap;												//  New capacity
+			char*		pNewBfr = nullptr;																//  New buffer
+
+			if (Required <= Cap) return true;
+			while (NewCap < Required) NewCap *= 2;
+			pNewBfr = (char*) realloc(pBfr, NewCap);
+			if (pNewBfr == nullptr) {
+				Failed = true;
+				return false;
+			}
+			pBfr = pNewBfr;
+			Cap = NewCap;
+			return true;
+		}
+	};
+}